@@ -59,7 +59,7 @@ pushd objs
 %if %{build_perl}
 	--enable-perl \
 %endif
-	--prefix=%{_prefix} --libdir=%{_libdir}
+	--prefix=%{_prefix} --libdir=%{_libdir} --datadir=%{_datadir}
 make
 popd
 
@@ -80,6 +80,7 @@ rm -rf $RPM_BUILD_ROOT
 %defattr(-,root,root)
 %doc README COPYING NEWS
 %{_bindir}/cpuinfo
+%{_datadir}/%{name}
 %if %{build_shared}
 %{_libdir}/libcpuinfo.so.*
 %endif
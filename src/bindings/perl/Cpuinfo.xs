@@ -39,6 +39,28 @@ register_constants(void)
 #undef REGISTER_CONSTANT
 }
 
+static SV *
+newRV_uarch_info(const cpuinfo_uarch_info_t *uip)
+{
+    HV *rh = newHV();
+    hv_store(rh, "uarch", 5, newSViv(uip->uarch), 0);
+    hv_store(rh, "vector_width", 12, newSViv(uip->vector_width), 0);
+    hv_store(rh, "datapath_width", 14, newSViv(uip->datapath_width), 0);
+    hv_store(rh, "preferred_vector_width", 22, newSViv(uip->preferred_vector_width), 0);
+    hv_store(rh, "fma_units", 9, newSViv(uip->fma_units), 0);
+    hv_store(rh, "load_units", 10, newSViv(uip->load_units), 0);
+    hv_store(rh, "store_units", 11, newSViv(uip->store_units), 0);
+    hv_store(rh, "rob_size", 8, newSViv(uip->rob_size), 0);
+    hv_store(rh, "load_buffer_size", 16, newSViv(uip->load_buffer_size), 0);
+    hv_store(rh, "store_buffer_size", 17, newSViv(uip->store_buffer_size), 0);
+    hv_store(rh, "l1_latency", 10, newSViv(uip->l1_latency), 0);
+    hv_store(rh, "l2_latency", 10, newSViv(uip->l2_latency), 0);
+    hv_store(rh, "l3_latency", 10, newSViv(uip->l3_latency), 0);
+    hv_store(rh, "rep_movsb_threshold", 19, newSViv(uip->rep_movsb_threshold), 0);
+    hv_store(rh, "slow_insns", 10, newSViv(uip->slow_insns), 0);
+    return newRV_noinc((SV *)rh);
+}
+
 MODULE = Cpuinfo	PACKAGE = Cpuinfo
 
 BOOT:
@@ -51,6 +73,10 @@ PROTOTYPES: ENABLE
 struct cpuinfo *
 cpuinfo_new()
 
+struct cpuinfo *
+cpuinfo_new_for_cpu(cpu)
+    int cpu;
+
 void
 cpuinfo_DESTROY(cip)
     struct cpuinfo *cip;
@@ -65,6 +91,14 @@ const char *
 cpuinfo_get_model(cip)
     struct cpuinfo *cip;
 
+const char *
+cpuinfo_get_host_id(cip)
+    struct cpuinfo *cip;
+
+int
+cpuinfo_get_uarch(cip)
+    struct cpuinfo *cip;
+
 int
 cpuinfo_get_frequency(cip)
     struct cpuinfo *cip;
@@ -81,6 +115,10 @@ int
 cpuinfo_get_threads(cip)
     struct cpuinfo *cip;
 
+int
+cpuinfo_get_prefetch_size(cip)
+    struct cpuinfo *cip;
+
 void
 cpuinfo_get_caches(cip)
     struct cpuinfo *cip;
@@ -97,15 +135,295 @@ PPCODE:
 	    hv_store(rh, "type",  4, newSVnv(cdp->type), 0);
 	    hv_store(rh, "level", 5, newSVnv(cdp->level), 0);
 	    hv_store(rh, "size",  4, newSVnv(cdp->size), 0);
+	    hv_store(rh, "sharing", 7, newSVnv(cdp->sharing), 0);
+	    hv_store(rh, "line_size", 9, newSVnv(cdp->line_size), 0);
+	    hv_store(rh, "ways", 4, newSVnv(cdp->ways), 0);
+	    PUSHs(sv_2mortal(newRV((SV *)rh)));
+	}
+    }
+
+void
+cpuinfo_get_cache_blocking(cip, n_threads, placement)
+    struct cpuinfo *cip;
+    int n_threads;
+    int placement;
+PREINIT:
+    int i, n_blocks;
+    cpuinfo_cache_blocking_t blocks[8];
+PPCODE:
+    n_blocks = cpuinfo_get_cache_blocking(cip, n_threads, placement, blocks, sizeof(blocks) / sizeof(blocks[0]));
+    if (n_blocks > 0) {
+	EXTEND(SP, n_blocks);
+	for (i = 0; i < n_blocks; i++) {
+	    const cpuinfo_cache_blocking_t *bp = &blocks[i];
+	    HV *rh = newHV();
+	    hv_store(rh, "level", 5, newSViv(bp->level), 0);
+	    hv_store(rh, "line_size", 9, newSViv(bp->line_size), 0);
+	    hv_store(rh, "ways", 4, newSViv(bp->ways), 0);
+	    hv_store(rh, "threads", 7, newSViv(bp->threads), 0);
+	    hv_store(rh, "capacity", 8, newSVuv(bp->capacity), 0);
+	    hv_store(rh, "streaming", 9, newSVuv(bp->block_size[CPUINFO_ACCESS_STREAMING]), 0);
+	    hv_store(rh, "tiles", 5, newSVuv(bp->block_size[CPUINFO_ACCESS_TILES]), 0);
+	    hv_store(rh, "hash_table", 10, newSVuv(bp->block_size[CPUINFO_ACCESS_HASH_TABLE]), 0);
+	    PUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+	}
+    }
+
+void
+cpuinfo_get_tlbs(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    int i;
+    const cpuinfo_tlb_t *ctp;
+PPCODE:
+    ctp = cpuinfo_get_tlbs(cip);
+    if (ctp && ctp->count > 0) {
+	EXTEND(SP, ctp->count);
+	for (i = 0; i < ctp->count; i++) {
+	    const cpuinfo_tlb_descriptor_t *tdp = &ctp->descriptors[i];
+	    HV *rh = newHV();
+	    hv_store(rh, "type", 4, newSViv(tdp->type), 0);
+	    hv_store(rh, "level", 5, newSViv(tdp->level), 0);
+	    hv_store(rh, "page_sizes", 10, newSViv(tdp->page_sizes), 0);
+	    hv_store(rh, "entries", 7, newSViv(tdp->entries), 0);
+	    hv_store(rh, "ways", 4, newSViv(tdp->ways), 0);
+	    hv_store(rh, "sharing", 7, newSViv(tdp->sharing), 0);
+	    PUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+	}
+    }
+
+unsigned long
+cpuinfo_get_tlb_reach(cip, page_size)
+    struct cpuinfo *cip;
+    int page_size;
+
+void
+cpuinfo_get_page_info(cip, node)
+    struct cpuinfo *cip;
+    int node;
+PREINIT:
+    int i, n_pages;
+    cpuinfo_page_info_t pages[16];
+PPCODE:
+    n_pages = cpuinfo_get_page_info(cip, node, pages, sizeof(pages) / sizeof(pages[0]));
+    if (n_pages > 0) {
+	EXTEND(SP, n_pages);
+	for (i = 0; i < n_pages; i++) {
+	    HV *rh = newHV();
+	    hv_store(rh, "size", 4, newSViv(pages[i].size), 0);
+	    hv_store(rh, "flags", 5, newSViv(pages[i].flags), 0);
+	    hv_store(rh, "nr_pages", 8, newSViv(pages[i].nr_pages), 0);
+	    hv_store(rh, "free_pages", 10, newSViv(pages[i].free_pages), 0);
+	    PUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+	}
+    }
+
+int
+cpuinfo_get_node_distance(cip, from, to)
+    struct cpuinfo *cip;
+    int from;
+    int to;
+
+void
+cpuinfo_get_core_complexes(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    int i, j;
+    const cpuinfo_core_complexes_t *cxp;
+PPCODE:
+    cxp = cpuinfo_get_core_complexes(cip);
+    if (cxp && cxp->count > 0) {
+	EXTEND(SP, cxp->count);
+	for (i = 0; i < cxp->count; i++) {
+	    const cpuinfo_core_complex_t *ccxp = &cxp->complexes[i];
+	    HV *rh = newHV();
+	    AV *cpus = newAV();
+	    for (j = 0; j < ccxp->n_cpus; j++)
+		av_push(cpus, newSViv(ccxp->cpus[j]));
+	    hv_store(rh, "cpus", 4, newRV_noinc((SV *)cpus), 0);
+	    hv_store(rh, "n_cores", 7, newSViv(ccxp->n_cores), 0);
+	    hv_store(rh, "cache_level", 11, newSViv(ccxp->cache_level), 0);
+	    hv_store(rh, "cache_size", 10, newSViv(ccxp->cache_size), 0);
+	    hv_store(rh, "node", 4, newSViv(ccxp->node), 0);
 	    PUSHs(sv_2mortal(newRV((SV *)rh)));
 	}
     }
 
+void
+cpuinfo_get_processors(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    int i;
+    const cpuinfo_processors_t *psp;
+PPCODE:
+    psp = cpuinfo_get_processors(cip);
+    if (psp && psp->count > 0) {
+	EXTEND(SP, psp->count);
+	for (i = 0; i < psp->count; i++) {
+	    const cpuinfo_processor_t *pp = &psp->processors[i];
+	    HV *rh = newHV();
+	    hv_store(rh, "id", 2, newSViv(pp->id), 0);
+	    hv_store(rh, "package", 7, newSViv(pp->package), 0);
+	    hv_store(rh, "core", 4, newSViv(pp->core), 0);
+	    hv_store(rh, "core_type", 9, newSViv(pp->core_type), 0);
+	    hv_store(rh, "native_model", 12, newSViv(pp->native_model), 0);
+	    hv_store(rh, "uarch", 5, newSViv(pp->uarch), 0);
+	    hv_store(rh, "capacity", 8, newSViv(pp->capacity), 0);
+	    hv_store(rh, "highest_perf", 12, newSViv(pp->highest_perf), 0);
+	    hv_store(rh, "nominal_perf", 12, newSViv(pp->nominal_perf), 0);
+	    hv_store(rh, "base_frequency", 14, newSViv(pp->base_frequency), 0);
+	    hv_store(rh, "max_frequency", 13, newSViv(pp->max_frequency), 0);
+	    hv_store(rh, "tier", 4, newSViv(pp->tier), 0);
+	    PUSHs(sv_2mortal(newRV((SV *)rh)));
+	}
+    }
+
+void
+cpuinfo_get_fastest_cpus(cip, n)
+    struct cpuinfo *cip;
+    int n;
+PREINIT:
+    int i, count, *cpus;
+PPCODE:
+    if (n > 0) {
+	Newx(cpus, n, int);
+	count = cpuinfo_get_fastest_cpus(cip, cpus, n);
+	EXTEND(SP, count);
+	for (i = 0; i < count; i++)
+	    PUSHs(sv_2mortal(newSViv(cpus[i])));
+	Safefree(cpus);
+    }
+
+void
+cpuinfo_get_cpu_budget(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    cpuinfo_cpu_budget_t budget;
+PPCODE:
+    if (cpuinfo_get_cpu_budget(cip, &budget) == 0) {
+	HV *rh = newHV();
+	hv_store(rh, "n_cpus", 6, newSViv(budget.n_cpus), 0);
+	hv_store(rh, "n_cores", 7, newSViv(budget.n_cores), 0);
+	hv_store(rh, "quota", 5, newSVnv(budget.quota), 0);
+	hv_store(rh, "n_workers", 9, newSViv(budget.n_workers), 0);
+	XPUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+    }
+
+void
+cpuinfo_get_xsave_info(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    int i;
+    const cpuinfo_xsave_t *xsp;
+PPCODE:
+    xsp = cpuinfo_get_xsave_info(cip);
+    if (xsp && xsp->count > 0) {
+	HV *rh = newHV();
+	AV *components = newAV();
+	for (i = 0; i < xsp->count; i++) {
+	    const cpuinfo_xsave_component_t *xcp = &xsp->components[i];
+	    HV *ch = newHV();
+	    hv_store(ch, "id", 2, newSViv(xcp->id), 0);
+	    hv_store(ch, "size", 4, newSViv(xcp->size), 0);
+	    hv_store(ch, "offset", 6, newSViv(xcp->offset), 0);
+	    hv_store(ch, "aligned", 7, newSViv(xcp->aligned), 0);
+	    av_push(components, newRV_noinc((SV *)ch));
+	}
+	hv_store(rh, "components", 10, newRV_noinc((SV *)components), 0);
+	hv_store(rh, "size", 4, newSViv(xsp->size), 0);
+	hv_store(rh, "compacted_size", 14, newSViv(xsp->compacted_size), 0);
+	hv_store(rh, "max_size", 8, newSViv(xsp->max_size), 0);
+	hv_store(rh, "save_insn", 9, newSViv(xsp->save_insn), 0);
+	XPUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+    }
+
+void
+cpuinfo_get_tile_info(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    cpuinfo_tile_info_t tile_info;
+PPCODE:
+    if (cpuinfo_get_tile_info(cip, &tile_info) == 0) {
+	HV *rh = newHV();
+	hv_store(rh, "max_palette", 11, newSViv(tile_info.max_palette), 0);
+	hv_store(rh, "total_tile_bytes", 16, newSViv(tile_info.total_tile_bytes), 0);
+	hv_store(rh, "bytes_per_tile", 14, newSViv(tile_info.bytes_per_tile), 0);
+	hv_store(rh, "bytes_per_row", 13, newSViv(tile_info.bytes_per_row), 0);
+	hv_store(rh, "max_names", 9, newSViv(tile_info.max_names), 0);
+	hv_store(rh, "max_rows", 8, newSViv(tile_info.max_rows), 0);
+	hv_store(rh, "tmul_maxk", 9, newSViv(tile_info.tmul_maxk), 0);
+	hv_store(rh, "tmul_maxn", 9, newSViv(tile_info.tmul_maxn), 0);
+	XPUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+    }
+
+int
+cpuinfo_request_tile_permission(cip)
+    struct cpuinfo *cip;
+
+int
+cpuinfo_get_virtualizer(cip)
+    struct cpuinfo *cip;
+
+void
+cpuinfo_get_virtualizer_info(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    const cpuinfo_virtualizer_info_t *vip;
+PPCODE:
+    vip = cpuinfo_get_virtualizer_info(cip);
+    if (vip) {
+	HV *rh = newHV();
+	hv_store(rh, "id", 2, newSViv(vip->id), 0);
+	hv_store(rh, "tsc_frequency", 13, newSViv(vip->tsc_frequency), 0);
+	hv_store(rh, "apic_frequency", 14, newSViv(vip->apic_frequency), 0);
+	hv_store(rh, "has_pvclock", 11, newSViv(vip->has_pvclock), 0);
+	hv_store(rh, "cpuid_cost", 10, newSViv(vip->cpuid_cost), 0);
+	XPUSHs(sv_2mortal(newRV_noinc((SV *)rh)));
+    }
+
+void
+cpuinfo_get_uarch_info(cip)
+    struct cpuinfo *cip;
+PREINIT:
+    const cpuinfo_uarch_info_t *uip;
+PPCODE:
+    uip = cpuinfo_get_uarch_info(cip);
+    if (uip)
+	XPUSHs(sv_2mortal(newRV_uarch_info(uip)));
+
+void
+cpuinfo_lookup_uarch_info(cip, uarch)
+    struct cpuinfo *cip;
+    int uarch;
+PREINIT:
+    const cpuinfo_uarch_info_t *uip;
+PPCODE:
+    uip = cpuinfo_lookup_uarch_info(cip, uarch);
+    if (uip)
+	XPUSHs(sv_2mortal(newRV_uarch_info(uip)));
+
 int
 cpuinfo_has_feature(cip, feature)
     struct cpuinfo *cip;
     int feature;
 
+int
+cpuinfo_get_feature_status(cip, feature)
+    struct cpuinfo *cip;
+    int feature;
+
+int
+cpuinfo_verify_features(cip)
+    struct cpuinfo *cip;
+
+int
+cpuinfo_get_x86_level(cip)
+    struct cpuinfo *cip;
+
+int
+cpuinfo_x86_level_of_feature(feature)
+    int feature;
+
 const char *
 cpuinfo_string_of_vendor(vendor)
     int vendor;
@@ -114,10 +432,42 @@ const char *
 cpuinfo_string_of_socket(socket)
     int socket;
 
+const char *
+cpuinfo_string_of_uarch(uarch)
+    int uarch;
+
 const char *
 cpuinfo_string_of_cache_type(cache_type)
     int cache_type;
 
+const char *
+cpuinfo_string_of_page_size(page_size)
+    int page_size;
+
+const char *
+cpuinfo_string_of_core_type(core_type)
+    int core_type;
+
+const char *
+cpuinfo_string_of_xsave_component(component)
+    int component;
+
+const char *
+cpuinfo_string_of_xsave_insn(insn)
+    int insn;
+
+const char *
+cpuinfo_string_of_virtualizer(virtualizer)
+    int virtualizer;
+
+const char *
+cpuinfo_string_of_slow_insn(slow_insn)
+    int slow_insn;
+
+const char *
+cpuinfo_string_of_x86_level(level)
+    int level;
+
 const char *
 cpuinfo_string_of_feature(feature)
     int feature;
@@ -66,6 +66,9 @@ foreach my $cache ($cpuinfo->get_caches()) {
         else {
             print $size, " KB";
         }
+        if ($cache->{sharing} > 1) {
+            print ", shared by ", $cache->{sharing}, " threads";
+        }
     }
     print "\n";
 }
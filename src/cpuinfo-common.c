@@ -21,7 +21,15 @@
 #include "sysdeps.h"
 #include <signal.h>
 #include <setjmp.h>
+#include <stdarg.h>
+#include <limits.h>
+#include <strings.h>
 #include <assert.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+#ifdef HAVE_GETAUXVAL
+#include <sys/auxv.h>
+#endif
 #include "cpuinfo.h"
 #include "cpuinfo-private.h"
 
@@ -36,12 +44,30 @@ struct cpuinfo *cpuinfo_new(void)
   if (cip) {
 	cip->vendor = -1;
 	cip->model = NULL;
+	cip->host_id[0] = '\0';
+	cip->uarch = -1;
 	cip->frequency = -1;
 	cip->socket = -1;
 	cip->n_cores = -1;
 	cip->n_threads = -1;
+	cip->prefetch_size = -1;
 	cip->cache_info.count = -1;
 	cip->cache_info.descriptors = NULL;
+	cip->tlb_info.count = -1;
+	cip->tlb_info.descriptors = NULL;
+	cip->core_complexes.count = -1;
+	cip->core_complexes.complexes = NULL;
+	cip->processors.count = -1;
+	cip->processors.processors = NULL;
+	cip->xsave_info.count = -1;
+	cip->xsave_info.components = NULL;
+	cip->virtualizer_info.id = -1;
+	cip->uarch_infos = NULL;
+	cip->n_uarch_infos = -1;
+	cip->os_flags = NULL;
+	cip->has_os_flags = -1;
+	cip->os_version = 0;
+	cip->faulted_features = NULL;
 	cip->opaque = NULL;
 	memset(cip->features, 0, sizeof(cip->features));
 	if (cpuinfo_arch_new(cip) < 0) {
@@ -61,6 +87,15 @@ void cpuinfo_destroy(struct cpuinfo *cip)
 	  free(cip->model);
 	if (cip->cache_info.descriptors)
 	  free((void *)cip->cache_info.descriptors);
+	if (cip->tlb_info.descriptors)
+	  free((void *)cip->tlb_info.descriptors);
+	if (cip->xsave_info.components)
+	  free((void *)cip->xsave_info.components);
+	if (cip->os_flags)
+	  free(cip->os_flags);
+	cpuinfo_list_clear(&cip->faulted_features);
+	cpuinfo_uarch_info_destroy(cip);
+	cpuinfo_topology_destroy(cip);
 	free(cip);
   }
 }
@@ -95,6 +130,65 @@ const char *cpuinfo_get_model(struct cpuinfo *cip)
   return cip->model;
 }
 
+static uint64_t hash_int(uint64_t hash, uint32_t value)
+{
+  uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+  return cpuinfo_hash_bytes(hash, bytes, sizeof(bytes));
+}
+
+// Get host identifier, a hash of the processor signature and features
+const char *cpuinfo_get_host_id(struct cpuinfo *cip)
+{
+  static const int feature_classes[][2] = {
+	{ CPUINFO_FEATURE_COMMON, CPUINFO_FEATURE_COMMON_MAX },
+	{ CPUINFO_FEATURE_X86, CPUINFO_FEATURE_X86_MAX },
+	{ CPUINFO_FEATURE_IA64, CPUINFO_FEATURE_IA64_MAX },
+	{ CPUINFO_FEATURE_PPC, CPUINFO_FEATURE_PPC_MAX },
+	{ CPUINFO_FEATURE_MIPS, CPUINFO_FEATURE_MIPS_MAX }
+  };
+
+  if (cip == NULL)
+	return NULL;
+  if (cip->host_id[0] == '\0') {
+	uint64_t hash = CPUINFO_HASH_INIT;
+	hash = hash_int(hash, cpuinfo_get_vendor(cip));
+	// the uarch of hybrid processors depends on the core the caller runs on, use the performance cores
+	hash = hash_int(hash, cpuinfo_arch_get_uarch(cip, CPUINFO_CORE_TYPE_PERFORMANCE));
+	hash = hash_int(hash, cpuinfo_arch_get_signature(cip));
+	const char *model = cpuinfo_get_model(cip);
+	if (model)
+	  hash = cpuinfo_hash_bytes(hash, model, strlen(model) + 1);
+	// usability depends on the OS too, so the status is part of the identifier, but not faults
+	// found by cpuinfo_verify_features() in this process
+	int i, feature;
+	for (i = 0; i < sizeof(feature_classes) / sizeof(feature_classes[0]); i++) {
+	  for (feature = feature_classes[i][0] + 1; feature < feature_classes[i][1]; feature++) {
+		int status = cpuinfo_get_feature_status(cip, feature)
+		  & (CPUINFO_FEATURE_STATUS_HARDWARE | CPUINFO_FEATURE_STATUS_OS);
+		if (status != 0) {
+		  hash = hash_int(hash, feature);
+		  hash = hash_int(hash, status);
+		}
+	  }
+	}
+	sprintf(cip->host_id, "%016llx", (unsigned long long)hash);
+  }
+  return cip->host_id;
+}
+
+// Get processor microarchitecture
+int cpuinfo_get_uarch(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return -1;
+  if (cip->uarch < 0) {
+	cip->uarch = cpuinfo_arch_get_uarch(cip, CPUINFO_CORE_TYPE_UNKNOWN);
+	if (cip->uarch < 0)
+	  cip->uarch = CPUINFO_UARCH_UNKNOWN;
+  }
+  return cip->uarch;
+}
+
 // Get processor frequency in MHz
 int cpuinfo_get_frequency(struct cpuinfo *cip)
 {
@@ -144,6 +238,115 @@ int cpuinfo_get_threads(struct cpuinfo *cip)
   return cip->n_threads;
 }
 
+// Get extended state components enabled by the OS (returns read-only descriptors)
+const cpuinfo_xsave_t *cpuinfo_get_xsave_info(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return NULL;
+  if (cip->xsave_info.count < 0) {
+	memset(&cip->xsave_info, 0, sizeof(cip->xsave_info));
+	if (cpuinfo_arch_get_xsave_info(cip, &cip->xsave_info) < 0) {
+	  if (cip->xsave_info.components)
+		free((void *)cip->xsave_info.components);
+	  memset(&cip->xsave_info, 0, sizeof(cip->xsave_info));
+	}
+  }
+  return &cip->xsave_info;
+}
+
+// Get AMX tile palette information (returns -1 if tiles are not supported)
+int cpuinfo_get_tile_info(struct cpuinfo *cip, cpuinfo_tile_info_t *tip)
+{
+  if (cip == NULL || tip == NULL)
+	return -1;
+  memset(tip, 0, sizeof(*tip));
+  return cpuinfo_arch_get_tile_info(cip, tip);
+}
+
+// Request permission to use AMX tile data (returns 1 if tiles are usable)
+int cpuinfo_request_tile_permission(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return 0;
+  return cpuinfo_arch_request_tile_permission(cip);
+}
+
+// Get virtualizer from the OS, in case the hypervisor CPUID bit is hidden
+static int os_get_virtualizer(void)
+{
+  static const struct {
+	const char *file;
+	const char *prefix;
+	int id;
+  } dmi_virtualizers[] = {
+	{ "sys_vendor",		"QEMU",				CPUINFO_VIRTUALIZER_QEMU		},
+	{ "sys_vendor",		"VMware",			CPUINFO_VIRTUALIZER_VMWARE		},
+	{ "sys_vendor",		"innotek GmbH",		CPUINFO_VIRTUALIZER_VIRTUALBOX	},
+	{ "sys_vendor",		"Xen",				CPUINFO_VIRTUALIZER_XEN			},
+	{ "sys_vendor",		"Parallels",		CPUINFO_VIRTUALIZER_PARALLELS	},
+	{ "product_name",	"KVM",				CPUINFO_VIRTUALIZER_KVM			},
+	{ "product_name",	"VirtualBox",		CPUINFO_VIRTUALIZER_VIRTUALBOX	},
+	{ "product_name",	"Virtual Machine",	CPUINFO_VIRTUALIZER_HYPERV		},
+	{ "bios_vendor",	"BHYVE",			CPUINFO_VIRTUALIZER_BHYVE		},
+	{ NULL,				NULL,				-1								}
+  };
+  char str[256];
+  int i;
+
+  if (cpuinfo_sysfs_read_string(str, sizeof(str), "/sys/hypervisor/type") == 0 && strcmp(str, "xen") == 0)
+	return CPUINFO_VIRTUALIZER_XEN;
+
+  for (i = 0; dmi_virtualizers[i].file != NULL; i++) {
+	const char *prefix = dmi_virtualizers[i].prefix;
+	if (cpuinfo_sysfs_read_string(str, sizeof(str), "/sys/class/dmi/id/%s", dmi_virtualizers[i].file) == 0
+		&& strncmp(str, prefix, strlen(prefix)) == 0)
+	  return dmi_virtualizers[i].id;
+  }
+  return CPUINFO_VIRTUALIZER_NONE;
+}
+
+// Check whether the OS has a paravirtual clock source
+static int os_has_pvclock(void)
+{
+  char str[256];
+  if (cpuinfo_sysfs_read_string(str, sizeof(str), "/sys/devices/system/clocksource/clocksource0/available_clocksource") < 0)
+	return 0;
+  return (strstr(str, "kvm-clock") != NULL ||
+		  strstr(str, "xen") != NULL ||
+		  strstr(str, "hyperv_clocksource_tsc_page") != NULL);
+}
+
+// Get virtualizer and paravirtual timing information
+const cpuinfo_virtualizer_info_t *cpuinfo_get_virtualizer_info(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return NULL;
+  if (cip->virtualizer_info.id < 0) {
+	cpuinfo_virtualizer_info_t *vip = &cip->virtualizer_info;
+	memset(vip, 0, sizeof(*vip));
+	vip->cpuid_cost = -1;
+	if (cpuinfo_arch_get_virtualizer(cip, vip) < 0)
+	  vip->id = CPUINFO_VIRTUALIZER_NONE;
+	if (vip->id == CPUINFO_VIRTUALIZER_NONE || vip->id == CPUINFO_VIRTUALIZER_UNKNOWN) {
+	  int id = os_get_virtualizer();
+	  if (id != CPUINFO_VIRTUALIZER_NONE)
+		vip->id = id;
+	}
+	if (vip->id != CPUINFO_VIRTUALIZER_NONE && !vip->has_pvclock)
+	  vip->has_pvclock = os_has_pvclock();
+  }
+  return &cip->virtualizer_info;
+}
+
+// Get virtualizer the program is running under
+int cpuinfo_get_virtualizer(struct cpuinfo *cip)
+{
+  const cpuinfo_virtualizer_info_t *vip = cpuinfo_get_virtualizer_info(cip);
+  if (vip == NULL)
+	return -1;
+  return vip->id;
+}
+
 // Cache descriptor comparator
 static int cache_desc_compare(const void *a, const void *b)
 {
@@ -207,29 +410,311 @@ const cpuinfo_cache_t *cpuinfo_get_caches(struct cpuinfo *cip)
 	  }
 	  cpuinfo_list_clear(&caches_list);
 	}
+	memset(cip->cache_index, 0, sizeof(cip->cache_index));
+	if (descs) {
+	  int i;
+	  for (i = count - 1; i >= 0; i--) {
+		const cpuinfo_cache_descriptor_t *cdp = &descs[i];
+		// the first descriptor of a kind wins
+		if (cdp->level >= 0 && cdp->level < CPUINFO_CACHE_LEVELS && cdp->type >= 0 && cdp->type <= CPUINFO_CACHE_TYPE_TRACE)
+		  cip->cache_index[cdp->level][cdp->type] = cdp;
+	  }
+	}
 	cip->cache_info.count = count;
 	cip->cache_info.descriptors = descs;
   }
   return &cip->cache_info;
 }
 
+// Get cache of LEVEL and TYPE, data caches fall back to the unified cache of LEVEL
+const cpuinfo_cache_descriptor_t *cpuinfo_get_cache(struct cpuinfo *cip, int level, int type)
+{
+  if (cpuinfo_get_caches(cip) == NULL)
+	return NULL;
+  if (level < 0 || level >= CPUINFO_CACHE_LEVELS || type < 0 || type > CPUINFO_CACHE_TYPE_TRACE)
+	return NULL;
+  const cpuinfo_cache_descriptor_t *cdp = cip->cache_index[level][type];
+  if (cdp == NULL && type == CPUINFO_CACHE_TYPE_DATA)
+	cdp = cip->cache_index[level][CPUINFO_CACHE_TYPE_UNIFIED];
+  return cdp;
+}
+
+// Get number of bytes fetched by the hardware prefetcher at once (0 if unknown)
+int cpuinfo_get_prefetch_size(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return -1;
+  if (cip->prefetch_size < 0) {
+	cip->prefetch_size = cpuinfo_arch_get_prefetch_size(cip);
+	if (cip->prefetch_size < 0)
+	  cip->prefetch_size = 0;
+  }
+  return cip->prefetch_size;
+}
+
+// Number of threads of a group of N_THREADS placed as PLACEMENT sharing a cache of SHARING
+// logical processors, out of N_CPUS
+static int get_cache_threads(int sharing, int n_threads, int n_cpus, int placement)
+{
+  if (sharing > n_cpus)
+	sharing = n_cpus;
+  if (placement == CPUINFO_PLACEMENT_COMPACT)
+	return n_threads < sharing ? n_threads : sharing;
+
+  // threads are evenly distributed over the instances of the cache
+  int n_caches = n_cpus / sharing;
+  if (n_caches < 1)
+	n_caches = 1;
+  int threads = (n_threads + n_caches - 1) / n_caches;
+  return threads < sharing ? threads : sharing;
+}
+
+// Get data cache blocking parameters, from level 1 up, for each of N_THREADS threads placed as PLACEMENT
+int cpuinfo_get_cache_blocking(struct cpuinfo *cip, int n_threads, int placement, cpuinfo_cache_blocking_t *blocks, int n)
+{
+  if (cip == NULL || blocks == NULL || n <= 0)
+	return -1;
+
+  const cpuinfo_processors_t *cpp = cpuinfo_get_processors(cip);
+  int n_cpus = cpp && cpp->count > 0 ? cpp->count : 1;
+  int n_smt = cpuinfo_get_threads(cip);
+  if (n_smt < 1)
+	n_smt = 1;
+  if (n_threads <= 0 || n_threads > n_cpus)
+	n_threads = n_cpus;
+  unsigned long tlb_reach = cpuinfo_get_tlb_reach(cip, CPUINFO_PAGE_SIZE_4K) * 1024;
+
+  int level, count = 0;
+  for (level = 1; level < CPUINFO_CACHE_LEVELS && count < n; level++) {
+	const cpuinfo_cache_descriptor_t *cdp = cpuinfo_get_cache(cip, level, CPUINFO_CACHE_TYPE_DATA);
+	if (cdp == NULL || cdp->size <= 0)
+	  break;
+
+	// caches of unknown sharing are private to a core, except the last level
+	int sharing = cdp->sharing;
+	if (sharing <= 0)
+	  sharing = cpuinfo_get_cache(cip, level + 1, CPUINFO_CACHE_TYPE_DATA) ? n_smt : n_cpus;
+
+	cpuinfo_cache_blocking_t *bp = &blocks[count++];
+	bp->level = level;
+	bp->line_size = cdp->line_size > 0 ? cdp->line_size : 64;
+	bp->ways = cdp->ways;
+	bp->threads = get_cache_threads(sharing, n_threads, n_cpus, placement);
+	bp->capacity = (unsigned long)cdp->size * 1024 / bp->threads;
+
+	// leave a way for other data so that conflict misses don't evict the block
+	unsigned long usable;
+	if (cdp->ways > 1)
+	  usable = bp->capacity / cdp->ways * (cdp->ways - 1);
+	else if (cdp->ways == 1)
+	  usable = bp->capacity / 2;
+	else if (cdp->ways < 0)
+	  usable = bp->capacity;
+	else
+	  usable = bp->capacity / 4 * 3;
+
+	// streaming leaves room for the output and the lines being prefetched
+	bp->block_size[CPUINFO_ACCESS_STREAMING] = bp->capacity / 2;
+	bp->block_size[CPUINFO_ACCESS_TILES] = usable;
+	// random accesses also miss in the TLBs beyond their reach
+	bp->block_size[CPUINFO_ACCESS_HASH_TABLE] = usable / 2;
+	if (tlb_reach > 0 && bp->block_size[CPUINFO_ACCESS_HASH_TABLE] > tlb_reach)
+	  bp->block_size[CPUINFO_ACCESS_HASH_TABLE] = tlb_reach;
+
+	int i;
+	for (i = 0; i < CPUINFO_ACCESS_MAX; i++)
+	  bp->block_size[i] -= bp->block_size[i] % bp->line_size;
+  }
+  return count;
+}
+
+// Get edge, in elements of ELEM_SIZE bytes, of square tiles such that tiles of N_ARRAYS arrays fit into the block of BP
+int cpuinfo_get_tile_edge(const cpuinfo_cache_blocking_t *bp, int n_arrays, int elem_size)
+{
+  if (bp == NULL || n_arrays <= 0 || elem_size <= 0)
+	return 0;
+
+  unsigned long n_elems = bp->block_size[CPUINFO_ACCESS_TILES] / ((unsigned long)n_arrays * elem_size);
+  unsigned long edge = 0;
+  while ((edge + 1) * (edge + 1) <= n_elems)
+	edge++;
+
+  // rows of whole lines
+  int line_elems = bp->line_size / elem_size;
+  if (line_elems > 1 && edge >= line_elems)
+	edge -= edge % line_elems;
+  return edge;
+}
+
+// TLB descriptor comparator
+static int tlb_desc_compare(const void *a, const void *b)
+{
+  const cpuinfo_tlb_descriptor_t *tdp1 = (const cpuinfo_tlb_descriptor_t *)a;
+  const cpuinfo_tlb_descriptor_t *tdp2 = (const cpuinfo_tlb_descriptor_t *)b;
+
+  if (tdp1->level != tdp2->level)
+	return tdp1->level - tdp2->level;
+
+  // code TLB first, then data TLB
+  if (tdp1->type != tdp2->type) {
+	if (tdp1->type == CPUINFO_CACHE_TYPE_CODE)
+	  return -1;
+	if (tdp2->type == CPUINFO_CACHE_TYPE_CODE)
+	  return +1;
+	if (tdp1->type == CPUINFO_CACHE_TYPE_DATA)
+	  return -1;
+	if (tdp2->type == CPUINFO_CACHE_TYPE_DATA)
+	  return +1;
+  }
+
+  return tdp1->page_sizes - tdp2->page_sizes;
+}
+
+// Get TLB information (returns read-only descriptors)
+const cpuinfo_tlb_t *cpuinfo_get_tlbs(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return NULL;
+  if (cip->tlb_info.count < 0) {
+	int count = 0;
+	cpuinfo_tlb_descriptor_t *descs = NULL;
+	cpuinfo_list_t tlbs_list = cpuinfo_arch_get_tlbs(cip);
+	if (tlbs_list) {
+	  int i;
+	  cpuinfo_list_t p = tlbs_list;
+	  while (p) {
+		++count;
+		p = p->next;
+	  }
+	  if ((descs = (cpuinfo_tlb_descriptor_t *)malloc(count * sizeof(*descs))) != NULL) {
+		p = tlbs_list;
+		for (i = 0; i < count; i++) {
+		  memcpy(&descs[i], p->data, sizeof(*descs));
+		  p = p->next;
+		}
+		qsort(descs, count, sizeof(*descs), tlb_desc_compare);
+	  }
+	  else
+		count = 0;
+	  cpuinfo_list_clear(&tlbs_list);
+	}
+	cip->tlb_info.count = count;
+	cip->tlb_info.descriptors = descs;
+  }
+  return &cip->tlb_info;
+}
+
+// Get memory covered by the data TLBs for pages of PAGE_SIZE, in KB (0 if unknown)
+unsigned long cpuinfo_get_tlb_reach(struct cpuinfo *cip, int page_size)
+{
+  unsigned long page_kb, reach = 0;
+  switch (page_size) {
+  case CPUINFO_PAGE_SIZE_4K:	page_kb = 4;			break;
+  case CPUINFO_PAGE_SIZE_2M:	page_kb = 2048;			break;
+  case CPUINFO_PAGE_SIZE_4M:	page_kb = 4096;			break;
+  case CPUINFO_PAGE_SIZE_1G:	page_kb = 1024 * 1024;	break;
+  default:						return 0;
+  }
+
+  const cpuinfo_tlb_t *tlbs = cpuinfo_get_tlbs(cip);
+  if (tlbs) {
+	int i;
+	// the largest TLB that holds data translations bounds the reach
+	for (i = 0; i < tlbs->count; i++) {
+	  const cpuinfo_tlb_descriptor_t *tdp = &tlbs->descriptors[i];
+	  if (tdp->type == CPUINFO_CACHE_TYPE_CODE || (tdp->page_sizes & page_size) == 0)
+		continue;
+	  if (reach < tdp->entries * page_kb)
+		reach = tdp->entries * page_kb;
+	}
+  }
+  return reach;
+}
+
 // Returns 1 if CPU supports the specified feature
 int cpuinfo_has_feature(struct cpuinfo *cip, int feature)
 {
   return cpuinfo_arch_has_feature(cip, feature);
 }
 
+// x86-64 psABI levels, long mode implies CX8, FPU, FXSR and SCE
+static const struct {
+  int feature;
+  int level;
+} x86_level_features[] = {
+  { CPUINFO_FEATURE_X86_LM,				CPUINFO_X86_LEVEL_V1 },
+  { CPUINFO_FEATURE_X86_CMOV,			CPUINFO_X86_LEVEL_V1 },
+  { CPUINFO_FEATURE_X86_MMX,			CPUINFO_X86_LEVEL_V1 },
+  { CPUINFO_FEATURE_X86_SSE,			CPUINFO_X86_LEVEL_V1 },
+  { CPUINFO_FEATURE_X86_SSE2,			CPUINFO_X86_LEVEL_V1 },
+  { CPUINFO_FEATURE_X86_CX16,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_LAHF64,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_POPCNT,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_SSE3,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_SSSE3,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_SSE4_1,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_SSE4_2,			CPUINFO_X86_LEVEL_V2 },
+  { CPUINFO_FEATURE_X86_AVX,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_AVX2,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_BMI1,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_BMI2,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_F16C,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_FMA,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_ABM,			CPUINFO_X86_LEVEL_V3 },	// LZCNT
+  { CPUINFO_FEATURE_X86_MOVBE,			CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_OSXSAVE,		CPUINFO_X86_LEVEL_V3 },
+  { CPUINFO_FEATURE_X86_AVX512F,		CPUINFO_X86_LEVEL_V4 },
+  { CPUINFO_FEATURE_X86_AVX512BW,		CPUINFO_X86_LEVEL_V4 },
+  { CPUINFO_FEATURE_X86_AVX512CD,		CPUINFO_X86_LEVEL_V4 },
+  { CPUINFO_FEATURE_X86_AVX512DQ,		CPUINFO_X86_LEVEL_V4 },
+  { CPUINFO_FEATURE_X86_AVX512VL,		CPUINFO_X86_LEVEL_V4 },
+};
+
+// Returns the x86-64 level that requires FEATURE, or CPUINFO_X86_LEVEL_NONE if there is none
+int cpuinfo_x86_level_of_feature(int feature)
+{
+  int i;
+  for (i = 0; i < sizeof(x86_level_features) / sizeof(x86_level_features[0]); i++) {
+	if (x86_level_features[i].feature == feature)
+	  return x86_level_features[i].level;
+  }
+  return CPUINFO_X86_LEVEL_NONE;
+}
+
+// Get the highest x86-64 level usable on the processor (returns -1 if it is not x86)
+int cpuinfo_get_x86_level(struct cpuinfo *cip)
+{
+  if (cpuinfo_arch_feature_table(cip, CPUINFO_FEATURE_X86) == NULL)
+	return -1;
+
+  int i, level = CPUINFO_X86_LEVEL_V4;
+  for (i = 0; i < sizeof(x86_level_features) / sizeof(x86_level_features[0]); i++) {
+	if (x86_level_features[i].level <= level && !cpuinfo_has_feature(cip, x86_level_features[i].feature))
+	  level = x86_level_features[i].level - 1;
+  }
+  return level;
+}
+
 
 /* ========================================================================= */
 /* == Processor Features Information                                      == */
 /* ========================================================================= */
 
+// Use sigsetjmp() so that SIGILL is unblocked again after siglongjmp()
+#ifdef HAVE_SIGACTION
+static sigjmp_buf cpuinfo_env; // XXX use a lock!
+#define cpuinfo_setjmp(ENV)			sigsetjmp(ENV, 1)
+#define cpuinfo_longjmp(ENV, VAL)	siglongjmp(ENV, VAL)
+#else
 static jmp_buf cpuinfo_env; // XXX use a lock!
+#define cpuinfo_setjmp(ENV)			setjmp(ENV)
+#define cpuinfo_longjmp(ENV, VAL)	longjmp(ENV, VAL)
+#endif
 
 static void sigill_handler(int sig)
 {
   assert(sig == SIGILL);
-  longjmp(cpuinfo_env, 1);
+  cpuinfo_longjmp(cpuinfo_env, 1);
 }
 
 // Returns true if function succeeds, false if SIGILL was caught
@@ -249,7 +734,7 @@ int cpuinfo_feature_test_function(cpuinfo_feature_test_function_t func)
 #endif
 
   int has_feature = 0;
-  if (setjmp(cpuinfo_env) == 0) {
+  if (cpuinfo_setjmp(cpuinfo_env) == 0) {
 	func();
 	has_feature = 1;
   }
@@ -282,6 +767,183 @@ void cpuinfo_feature_set_bit(struct cpuinfo *cip, int feature)
   }
 }
 
+void cpuinfo_feature_clear_bit(struct cpuinfo *cip, int feature)
+{
+  uint32_t *ftp = cpuinfo_arch_feature_table(cip, feature);
+  if (ftp) {
+	feature &= CPUINFO_FEATURE_MASK;
+	ftp[feature / 32] &= ~(1 << (feature % 32));
+  }
+}
+
+// Mark feature as advertised but faulting when executed
+void cpuinfo_feature_set_faulted(struct cpuinfo *cip, int feature)
+{
+  cpuinfo_feature_clear_bit(cip, feature);
+  cpuinfo_list_insert(&cip->faulted_features, &feature);
+}
+
+// Returns 1 if the feature faulted when executed
+static int feature_faulted(struct cpuinfo *cip, int feature)
+{
+  cpuinfo_list_t p;
+  for (p = cip->faulted_features; p != NULL; p = p->next) {
+	if (*(const int *)p->data == feature)
+	  return 1;
+  }
+  return 0;
+}
+
+// Execute advertised features to make sure they don't fault, returns the number of features disabled
+int cpuinfo_verify_features(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return -1;
+  return cpuinfo_arch_verify_features(cip);
+}
+
+// Fill BITS with the usable features of the processor, returns their class or -1
+attribute_no_stack_protector
+int cpuinfo_resolver_features(uint64_t *bits, unsigned long hwcap)
+{
+  // keep to plain loops, memset() may not be relocated yet
+  uint32_t features[2 * CPUINFO_RESOLVER_WORDS];
+  int i;
+  if (bits == NULL)
+	return -1;
+  for (i = 0; i < 2 * CPUINFO_RESOLVER_WORDS; i++)
+	features[i] = 0;
+  int feature_class = cpuinfo_arch_resolver_features(features, hwcap);
+  for (i = 0; i < CPUINFO_RESOLVER_WORDS; i++)
+	bits[i] = ((uint64_t)features[2 * i + 1] << 32) | features[2 * i];
+  return feature_class;
+}
+
+// Read the features line of /proc/cpuinfo
+static int get_os_flags(struct cpuinfo *cip)
+{
+  if (cip->has_os_flags < 0) {
+	cip->has_os_flags = 0;
+
+	// older kernels, or emulated ones, don't report features they don't know about
+	struct utsname un;
+	int major, minor, patch = 0;
+	if (uname(&un) == 0 && strcmp(un.sysname, "Linux") == 0
+		&& sscanf(un.release, "%d.%d.%d", &major, &minor, &patch) >= 2)
+	  cip->os_version = CPUINFO_LINUX_VERSION(major, minor, patch > 255 ? 255 : patch);
+
+	FILE *fp = fopen("/proc/cpuinfo", "r");
+	if (fp) {
+	  char *line = NULL;
+	  size_t line_size = 0;
+	  while (getline(&line, &line_size, fp) > 0) {
+		if (strncmp(line, "flags", 5) != 0)
+		  continue;
+		char *cp = strchr(line, ':');
+		if (cp) {
+		  int len = strlen(++cp);
+		  if (len > 0 && cp[len - 1] == '\n')
+			cp[--len] = '\0';
+		  // pad with spaces so that each flag can be looked up as " NAME "
+		  if ((cip->os_flags = (char *)malloc(len + 3)) != NULL) {
+			sprintf(cip->os_flags, " %s ", cp);
+			cip->has_os_flags = 1;
+		  }
+		}
+		break;
+	  }
+	  if (line)
+		free(line);
+	  fclose(fp);
+	}
+  }
+  return cip->has_os_flags;
+}
+
+// Returns 1 if the OS reports the feature NAME
+static int has_os_flag(struct cpuinfo *cip, const char *name)
+{
+  char flag[64];
+  if (snprintf(flag, sizeof(flag), " %s ", name) >= sizeof(flag))
+	return 0;
+  return strstr(cip->os_flags, flag) != NULL;
+}
+
+// Get AT_HWCAP (HWCAP = 1) or AT_HWCAP2 (HWCAP = 2) from the auxiliary vector
+static int get_hwcap(int hwcap, unsigned long *hwcaps)
+{
+  // AT_HWCAP and AT_HWCAP2 values are the same on all Linux platforms
+  const unsigned long type = hwcap == 2 ? 26 : 16;
+
+  // glibc rewrites AT_HWCAP on x86, so prefer what the kernel passed
+  FILE *fp = fopen("/proc/self/auxv", "r");
+  if (fp) {
+	unsigned long auxv[2];
+	int found = 0;
+	while (fread(auxv, sizeof(auxv), 1, fp) == 1 && auxv[0] != 0) {
+	  if (auxv[0] == type) {
+		*hwcaps = auxv[1];
+		found = 1;
+		break;
+	  }
+	}
+	fclose(fp);
+	return found ? 0 : -1;
+  }
+#ifdef HAVE_GETAUXVAL
+  *hwcaps = getauxval(type);
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+// Returns the feature status flags, reconciling the processor and OS views
+int cpuinfo_get_feature_status(struct cpuinfo *cip, int feature)
+{
+  if (cip == NULL)
+	return 0;
+
+  int status = 0;
+  if ((feature & CPUINFO_FEATURE_ARCH) == CPUINFO_FEATURE_COMMON) {
+	if (cpuinfo_arch_has_feature(cip, feature))
+	  status = CPUINFO_FEATURE_STATUS_HARDWARE | CPUINFO_FEATURE_STATUS_OS;
+  }
+  else {
+	int has_hw = cpuinfo_arch_has_hardware_feature(cip, feature);
+	if (has_hw)
+	  status |= CPUINFO_FEATURE_STATUS_HARDWARE;
+
+	// the arch code drops features whose state is not enabled by the OS
+	int has_faulted = feature_faulted(cip, feature);
+	if (has_faulted)
+	  status |= CPUINFO_FEATURE_STATUS_FAULTED;
+	int has_os = cpuinfo_arch_has_feature(cip, feature) || !has_hw || has_faulted;
+
+	// the kernel clears features disabled on the command line or by microcode, a feature it
+	// doesn't know about is left to the processor view and the auxiliary vector
+	int linux_version;
+	const char *name = cpuinfo_arch_feature_os_name(feature, &linux_version);
+	if (name && get_os_flags(cip) && cip->os_version >= linux_version && !has_os_flag(cip, name))
+	  has_os = 0;
+
+	int hwcap;
+	unsigned long hwcaps, mask;
+	if (cpuinfo_arch_feature_hwcap(feature, &hwcap, &mask) == 0 && get_hwcap(hwcap, &hwcaps) == 0) {
+	  if ((hwcaps & mask) == 0)
+		has_os = 0;
+	}
+
+	if (has_os)
+	  status |= CPUINFO_FEATURE_STATUS_OS;
+  }
+
+  if ((status & (CPUINFO_FEATURE_STATUS_HARDWARE | CPUINFO_FEATURE_STATUS_OS | CPUINFO_FEATURE_STATUS_FAULTED)) ==
+	  (CPUINFO_FEATURE_STATUS_HARDWARE | CPUINFO_FEATURE_STATUS_OS))
+	status |= CPUINFO_FEATURE_STATUS_USABLE;
+  return status;
+}
+
 
 /* ========================================================================= */
 /* == Stringification of CPU Information bits                             == */
@@ -306,6 +968,7 @@ const char *cpuinfo_string_of_vendor(int vendor)
   case CPUINFO_VENDOR_TRANSMETA:	str = "Transmeta";	break;
   case CPUINFO_VENDOR_UMC:		    str = "UMC";		break;
   case CPUINFO_VENDOR_PASEMI:		str = "P.A. Semi";	break;
+  case CPUINFO_VENDOR_HYGON:		str = "Hygon";		break;
   }
   return str;
 }
@@ -341,6 +1004,169 @@ const char *cpuinfo_string_of_cache_type(int cache_type)
   return str;
 }
 
+const char *cpuinfo_string_of_core_type(int core_type)
+{
+  const char *str = "<unknown>";
+  switch (core_type) {
+  case CPUINFO_CORE_TYPE_PERFORMANCE:	str = "performance";	break;
+  case CPUINFO_CORE_TYPE_EFFICIENCY:	str = "efficiency";		break;
+  }
+  return str;
+}
+
+const char *cpuinfo_string_of_xsave_component(int component)
+{
+  static const char *xsave_component_names[] = {
+	"x87", "sse", "avx", "bndregs", "bndcsr", "opmask", "zmm_hi256", "hi16_zmm",
+	"pt", "pkru", "pasid", "cet_u", "cet_s", "hdc", "uintr", "lbr", "hwp",
+	"tilecfg", "tiledata", "apx"
+  };
+  const char *str = "<unknown>";
+  if (component >= 0 && component < sizeof(xsave_component_names) / sizeof(xsave_component_names[0]))
+	str = xsave_component_names[component];
+  return str;
+}
+
+const char *cpuinfo_string_of_xsave_insn(int insn)
+{
+  const char *str = "<unknown>";
+  switch (insn) {
+  case CPUINFO_XSAVE_INSN_FXSAVE:	str = "fxsave";		break;
+  case CPUINFO_XSAVE_INSN_XSAVE:	str = "xsave";		break;
+  case CPUINFO_XSAVE_INSN_XSAVEOPT:	str = "xsaveopt";	break;
+  case CPUINFO_XSAVE_INSN_XSAVEC:	str = "xsavec";		break;
+  }
+  return str;
+}
+
+static const struct {
+  int uarch;
+  const char *name;
+} uarch_strings[] = {
+  { CPUINFO_UARCH_P5,				"P5"				},
+  { CPUINFO_UARCH_P6,				"P6"				},
+  { CPUINFO_UARCH_PENTIUM_M,		"Pentium M"			},
+  { CPUINFO_UARCH_NETBURST,			"NetBurst"			},
+  { CPUINFO_UARCH_CORE,				"Core"				},
+  { CPUINFO_UARCH_CORE2,			"Core 2"			},
+  { CPUINFO_UARCH_PENRYN,			"Penryn"			},
+  { CPUINFO_UARCH_NEHALEM,			"Nehalem"			},
+  { CPUINFO_UARCH_WESTMERE,			"Westmere"			},
+  { CPUINFO_UARCH_SANDY_BRIDGE,		"Sandy Bridge"		},
+  { CPUINFO_UARCH_IVY_BRIDGE,		"Ivy Bridge"		},
+  { CPUINFO_UARCH_HASWELL,			"Haswell"			},
+  { CPUINFO_UARCH_BROADWELL,		"Broadwell"			},
+  { CPUINFO_UARCH_SKYLAKE,			"Skylake"			},
+  { CPUINFO_UARCH_SKYLAKE_SP,		"Skylake-SP"		},
+  { CPUINFO_UARCH_CASCADE_LAKE,		"Cascade Lake"		},
+  { CPUINFO_UARCH_COOPER_LAKE,		"Cooper Lake"		},
+  { CPUINFO_UARCH_CANNON_LAKE,		"Cannon Lake"		},
+  { CPUINFO_UARCH_ICE_LAKE,			"Ice Lake"			},
+  { CPUINFO_UARCH_ICE_LAKE_SP,		"Ice Lake-SP"		},
+  { CPUINFO_UARCH_TIGER_LAKE,		"Tiger Lake"		},
+  { CPUINFO_UARCH_ROCKET_LAKE,		"Rocket Lake"		},
+  { CPUINFO_UARCH_SAPPHIRE_RAPIDS,	"Sapphire Rapids"	},
+  { CPUINFO_UARCH_EMERALD_RAPIDS,	"Emerald Rapids"	},
+  { CPUINFO_UARCH_GRANITE_RAPIDS,	"Granite Rapids"	},
+  { CPUINFO_UARCH_GOLDEN_COVE,		"Golden Cove"		},
+  { CPUINFO_UARCH_RAPTOR_COVE,		"Raptor Cove"		},
+  { CPUINFO_UARCH_REDWOOD_COVE,		"Redwood Cove"		},
+  { CPUINFO_UARCH_LION_COVE,		"Lion Cove"			},
+  { CPUINFO_UARCH_BONNELL,			"Bonnell"			},
+  { CPUINFO_UARCH_SALTWELL,			"Saltwell"			},
+  { CPUINFO_UARCH_SILVERMONT,		"Silvermont"		},
+  { CPUINFO_UARCH_AIRMONT,			"Airmont"			},
+  { CPUINFO_UARCH_GOLDMONT,			"Goldmont"			},
+  { CPUINFO_UARCH_GOLDMONT_PLUS,	"Goldmont Plus"		},
+  { CPUINFO_UARCH_TREMONT,			"Tremont"			},
+  { CPUINFO_UARCH_GRACEMONT,		"Gracemont"			},
+  { CPUINFO_UARCH_CRESTMONT,		"Crestmont"			},
+  { CPUINFO_UARCH_SKYMONT,			"Skymont"			},
+  { CPUINFO_UARCH_KNIGHTS_LANDING,	"Knights Landing"	},
+  { CPUINFO_UARCH_KNIGHTS_MILL,		"Knights Mill"		},
+  { CPUINFO_UARCH_K6,				"K6"				},
+  { CPUINFO_UARCH_K7,				"K7"				},
+  { CPUINFO_UARCH_K8,				"K8"				},
+  { CPUINFO_UARCH_K10,				"K10"				},
+  { CPUINFO_UARCH_BOBCAT,			"Bobcat"			},
+  { CPUINFO_UARCH_BULLDOZER,		"Bulldozer"			},
+  { CPUINFO_UARCH_PILEDRIVER,		"Piledriver"		},
+  { CPUINFO_UARCH_STEAMROLLER,		"Steamroller"		},
+  { CPUINFO_UARCH_EXCAVATOR,		"Excavator"			},
+  { CPUINFO_UARCH_JAGUAR,			"Jaguar"			},
+  { CPUINFO_UARCH_PUMA,				"Puma"				},
+  { CPUINFO_UARCH_ZEN,				"Zen"				},
+  { CPUINFO_UARCH_ZEN_PLUS,			"Zen+"				},
+  { CPUINFO_UARCH_ZEN2,				"Zen 2"				},
+  { CPUINFO_UARCH_ZEN3,				"Zen 3"				},
+  { CPUINFO_UARCH_ZEN4,				"Zen 4"				},
+  { CPUINFO_UARCH_ZEN5,				"Zen 5"				},
+  { -1,								NULL				}
+};
+
+const char *cpuinfo_string_of_uarch(int uarch)
+{
+  int i;
+  for (i = 0; uarch_strings[i].name != NULL; i++) {
+	if (uarch_strings[i].uarch == uarch)
+	  return uarch_strings[i].name;
+  }
+  return "<unknown>";
+}
+
+int cpuinfo_uarch_of_string(const char *name)
+{
+  int i;
+  for (i = 0; uarch_strings[i].name != NULL; i++) {
+	if (strcasecmp(uarch_strings[i].name, name) == 0)
+	  return uarch_strings[i].uarch;
+  }
+  return -1;
+}
+
+const char *cpuinfo_string_of_page_size(int page_size)
+{
+  const char *str = "<unknown>";
+  switch (page_size) {
+  case CPUINFO_PAGE_SIZE_4K:	str = "4K";		break;
+  case CPUINFO_PAGE_SIZE_2M:	str = "2M";		break;
+  case CPUINFO_PAGE_SIZE_4M:	str = "4M";		break;
+  case CPUINFO_PAGE_SIZE_1G:	str = "1G";		break;
+  }
+  return str;
+}
+
+const char *cpuinfo_string_of_x86_level(int level)
+{
+  const char *str = "<unknown>";
+  switch (level) {
+  case CPUINFO_X86_LEVEL_NONE:	str = "none";		break;
+  case CPUINFO_X86_LEVEL_V1:	str = "x86-64";		break;
+  case CPUINFO_X86_LEVEL_V2:	str = "x86-64-v2";	break;
+  case CPUINFO_X86_LEVEL_V3:	str = "x86-64-v3";	break;
+  case CPUINFO_X86_LEVEL_V4:	str = "x86-64-v4";	break;
+  }
+  return str;
+}
+
+const char *cpuinfo_string_of_virtualizer(int virtualizer)
+{
+  const char *str = "<unknown>";
+  switch (virtualizer) {
+  case CPUINFO_VIRTUALIZER_NONE:		str = "none";		break;
+  case CPUINFO_VIRTUALIZER_KVM:			str = "KVM";		break;
+  case CPUINFO_VIRTUALIZER_XEN:			str = "Xen";		break;
+  case CPUINFO_VIRTUALIZER_HYPERV:		str = "Hyper-V";	break;
+  case CPUINFO_VIRTUALIZER_VMWARE:		str = "VMware";		break;
+  case CPUINFO_VIRTUALIZER_VIRTUALBOX:	str = "VirtualBox";	break;
+  case CPUINFO_VIRTUALIZER_PARALLELS:	str = "Parallels";	break;
+  case CPUINFO_VIRTUALIZER_QEMU:		str = "QEMU";		break;
+  case CPUINFO_VIRTUALIZER_BHYVE:		str = "bhyve";		break;
+  case CPUINFO_VIRTUALIZER_ACRN:		str = "ACRN";		break;
+  }
+  return str;
+}
+
 typedef struct {
 #ifndef HAVE_DESIGNATED_INITIALIZERS
   int feature;
@@ -392,6 +1218,86 @@ static const cpuinfo_feature_string_t x86_feature_strings[] = {
   DEFINE_(X86_TM2,		"tm2",		"Thermal Monitor 2"									),
   DEFINE_(X86_EIST,		"eist",		"Enhanced Intel Speedstep Technology"				),
   DEFINE_(X86_NX,		"nx",		"No eXecute (AMD NX) / Execute Disable (Intel XD)"	),
+  DEFINE_(X86_CX16,		"cx16",		"CMPXCHG16B instruction"							),
+  DEFINE_(X86_MOVBE,	"movbe",	"MOVBE instruction"									),
+  DEFINE_(X86_PCLMULQDQ, "pclmulqdq", "Carry-less Multiplication instruction"			),
+  DEFINE_(X86_AES,		"aes",		"AES New Instructions (AES-NI)"						),
+  DEFINE_(X86_RDRAND,	"rdrand",	"RDRAND instruction"								),
+  DEFINE_(X86_RDSEED,	"rdseed",	"RDSEED instruction"								),
+  DEFINE_(X86_XSAVE,	"xsave",	"XSAVE/XRSTOR/XSETBV/XGETBV instructions"			),
+  DEFINE_(X86_OSXSAVE,	"osxsave",	"XSAVE enabled by the OS"							),
+  DEFINE_(X86_XSAVEOPT,	"xsaveopt",	"XSAVEOPT instruction"								),
+  DEFINE_(X86_XSAVEC,	"xsavec",	"XSAVEC instruction"								),
+  DEFINE_(X86_XGETBV1,	"xgetbv1",	"XGETBV with ECX = 1"								),
+  DEFINE_(X86_XSAVES,	"xsaves",	"XSAVES/XRSTORS instructions"						),
+  DEFINE_(X86_AVX,		"avx",		"Advanced Vector Extensions"						),
+  DEFINE_(X86_AVX2,		"avx2",		"Advanced Vector Extensions 2"						),
+  DEFINE_(X86_FMA,		"fma",		"Fused Multiply-Add (FMA3) instructions"			),
+  DEFINE_(X86_FMA4,		"fma4",		"Fused Multiply-Add (FMA4) instructions"			),
+  DEFINE_(X86_F16C,		"f16c",		"16-bit floating-point conversion instructions"		),
+  DEFINE_(X86_BMI1,		"bmi1",		"Bit Manipulation Instructions 1"					),
+  DEFINE_(X86_BMI2,		"bmi2",		"Bit Manipulation Instructions 2"					),
+  DEFINE_(X86_TBM,		"tbm",		"Trailing Bit Manipulation instructions"			),
+  DEFINE_(X86_ADX,		"adx",		"Multi-Precision Add-Carry instructions"			),
+  DEFINE_(X86_SHA,		"sha",		"SHA-1/SHA-256 extensions"							),
+  DEFINE_(X86_SHA512,	"sha512",	"SHA-512 extensions"								),
+  DEFINE_(X86_SM3,		"sm3",		"SM3 hash extensions"								),
+  DEFINE_(X86_SM4,		"sm4",		"SM4 cipher extensions"								),
+  DEFINE_(X86_VAES,		"vaes",		"Vector AES instructions"							),
+  DEFINE_(X86_VPCLMULQDQ, "vpclmulqdq", "Vector Carry-less Multiplication instructions"	),
+  DEFINE_(X86_GFNI,		"gfni",		"Galois Field New Instructions"						),
+  DEFINE_(X86_ERMS,		"erms",		"Enhanced REP MOVSB/STOSB"							),
+  DEFINE_(X86_FSRM,		"fsrm",		"Fast Short REP MOVSB"								),
+  DEFINE_(X86_FZLRM,	"fzlrm",	"Fast Zero-Length REP MOVSB"						),
+  DEFINE_(X86_FSRS,		"fsrs",		"Fast Short REP STOSB"								),
+  DEFINE_(X86_FSRC,		"fsrc",		"Fast Short REP CMPSB/SCASB"						),
+  DEFINE_(X86_RDTSCP,	"rdtscp",	"RDTSCP instruction"								),
+  DEFINE_(X86_RDPID,	"rdpid",	"RDPID instruction"									),
+  DEFINE_(X86_PREFETCHW, "prefetchw", "PREFETCHW instruction"							),
+  DEFINE_(X86_CLFLUSHOPT, "clflushopt", "CLFLUSHOPT instruction"						),
+  DEFINE_(X86_CLWB,		"clwb",		"CLWB instruction"									),
+  DEFINE_(X86_MOVDIRI,	"movdiri",	"MOVDIRI instruction"								),
+  DEFINE_(X86_MOVDIR64B, "movdir64b", "MOVDIR64B instruction"							),
+  DEFINE_(X86_SERIALIZE, "serialize", "SERIALIZE instruction"							),
+  DEFINE_(X86_WAITPKG,	"waitpkg",	"UMONITOR/UMWAIT/TPAUSE instructions"				),
+  DEFINE_(X86_HLE,		"hle",		"Hardware Lock Elision"								),
+  DEFINE_(X86_RTM,		"rtm",		"Restricted Transactional Memory"					),
+  DEFINE_(X86_AVX_VNNI,	"avx_vnni",	"AVX Vector Neural Network Instructions"			),
+  DEFINE_(X86_AVX_VNNI_INT8, "avx_vnni_int8", "AVX VNNI INT8 instructions"				),
+  DEFINE_(X86_AVX_VNNI_INT16, "avx_vnni_int16", "AVX VNNI INT16 instructions"			),
+  DEFINE_(X86_AVX_IFMA,	"avx_ifma",	"AVX Integer Fused Multiply-Add instructions"		),
+  DEFINE_(X86_AVX_NE_CONVERT, "avx_ne_convert", "AVX No-Exception FP conversion instructions" ),
+  DEFINE_(X86_AVX512F,	"avx512f",	"AVX-512 Foundation"								),
+  DEFINE_(X86_AVX512CD,	"avx512cd",	"AVX-512 Conflict Detection instructions"			),
+  DEFINE_(X86_AVX512DQ,	"avx512dq",	"AVX-512 Doubleword and Quadword instructions"		),
+  DEFINE_(X86_AVX512BW,	"avx512bw",	"AVX-512 Byte and Word instructions"				),
+  DEFINE_(X86_AVX512VL,	"avx512vl",	"AVX-512 Vector Length extensions"					),
+  DEFINE_(X86_AVX512PF,	"avx512pf",	"AVX-512 Prefetch instructions"						),
+  DEFINE_(X86_AVX512ER,	"avx512er",	"AVX-512 Exponential and Reciprocal instructions"	),
+  DEFINE_(X86_AVX512IFMA, "avx512ifma", "AVX-512 Integer Fused Multiply-Add instructions" ),
+  DEFINE_(X86_AVX512VBMI, "avx512vbmi", "AVX-512 Vector Byte Manipulation instructions"	),
+  DEFINE_(X86_AVX512VBMI2, "avx512vbmi2", "AVX-512 Vector Byte Manipulation instructions 2" ),
+  DEFINE_(X86_AVX512VNNI, "avx512vnni", "AVX-512 Vector Neural Network instructions"	),
+  DEFINE_(X86_AVX512BITALG, "avx512bitalg", "AVX-512 Bit Algorithms"					),
+  DEFINE_(X86_AVX512VPOPCNTDQ, "avx512vpopcntdq", "AVX-512 Vector Population Count instructions" ),
+  DEFINE_(X86_AVX512_4VNNIW, "avx512_4vnniw", "AVX-512 4-iteration Vector Neural Network instructions" ),
+  DEFINE_(X86_AVX512_4FMAPS, "avx512_4fmaps", "AVX-512 4-iteration Fused Multiply-Add instructions" ),
+  DEFINE_(X86_AVX512_VP2INTERSECT, "avx512_vp2intersect", "AVX-512 VP2INTERSECT instructions" ),
+  DEFINE_(X86_AVX512_BF16, "avx512_bf16", "AVX-512 BFLOAT16 instructions"				),
+  DEFINE_(X86_AVX512_FP16, "avx512_fp16", "AVX-512 FP16 instructions"					),
+  DEFINE_(X86_AVX10_1,	"avx10.1",	"AVX10.1 converged vector ISA"						),
+  DEFINE_(X86_AVX10_2,	"avx10.2",	"AVX10.2 converged vector ISA"						),
+  DEFINE_(X86_AVX10_256, "avx10_256", "AVX10 256-bit vector length"						),
+  DEFINE_(X86_AVX10_512, "avx10_512", "AVX10 512-bit vector length"						),
+  DEFINE_(X86_APX_F,	"apx_f",	"Advanced Performance Extensions Foundation"		),
+  DEFINE_(X86_AMX_TILE,	"amx_tile",	"AMX tile architecture"								),
+  DEFINE_(X86_AMX_BF16,	"amx_bf16",	"AMX BFLOAT16 tile instructions"					),
+  DEFINE_(X86_AMX_INT8,	"amx_int8",	"AMX INT8 tile instructions"						),
+  DEFINE_(X86_AMX_FP16,	"amx_fp16",	"AMX FP16 tile instructions"						),
+  DEFINE_(X86_AMX_COMPLEX, "amx_complex", "AMX complex FP16 tile instructions"			),
+  DEFINE_(X86_PSE,		"pse",		"Page Size Extensions (2 MB / 4 MB pages)"			),
+  DEFINE_(X86_PAE,		"pae",		"Physical Address Extensions (2 MB pages)"			),
+  DEFINE_(X86_PDPE1GB,	"pdpe1gb",	"1 GB pages"										),
 };
 
 static const int n_x86_feature_strings = sizeof(x86_feature_strings) / sizeof(x86_feature_strings[0]);
@@ -479,6 +1385,124 @@ const char *cpuinfo_string_of_feature_detail(int feature)
 }
 
 
+/* ========================================================================= */
+/* == System Information                                                  == */
+/* ========================================================================= */
+
+static int sysfs_read_string(char *buf, int size, const char *format, va_list args)
+{
+  char path[PATH_MAX];
+  int ret = vsnprintf(path, sizeof(path), format, args);
+  if (ret < 0 || ret >= sizeof(path))
+	return -1;
+
+  FILE *fp = fopen(path, "r");
+  if (fp == NULL)
+	return -1;
+  if (fgets(buf, size, fp) == NULL) {
+	fclose(fp);
+	return -1;
+  }
+  fclose(fp);
+
+  int len = strlen(buf);
+  if (len > 0 && buf[len - 1] == '\n')
+	buf[len - 1] = '\0';
+  return 0;
+}
+
+// Read first line of file FORMAT into BUF (returns -1 if file doesn't exist)
+int cpuinfo_sysfs_read_string(char *buf, int size, const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int ret = sysfs_read_string(buf, size, format, args);
+  va_end(args);
+  return ret;
+}
+
+// Read integer from file FORMAT (returns -1 if file doesn't exist)
+int cpuinfo_sysfs_read_int(int *value, const char *format, ...)
+{
+  char line[64];
+  va_list args;
+  va_start(args, format);
+  int ret = sysfs_read_string(line, sizeof(line), format, args);
+  va_end(args);
+  if (ret < 0 || sscanf(line, "%d", value) != 1)
+	return -1;
+  return 0;
+}
+
+// Parse CPU list (e.g. "0-3,8-11"), returns the number of CPUs or -1 on error
+int cpuinfo_parse_cpu_list(const char *str, int **cpus)
+{
+  assert(cpus != NULL);
+  int pass, n_cpus = 0;
+  *cpus = NULL;
+  for (pass = 0; pass < 2; pass++) {
+	const char *cp = str;
+	n_cpus = 0;
+	while (*cp) {
+	  char *ep;
+	  int first = strtol(cp, &ep, 10);
+	  if (ep == cp)
+		break;
+	  int last = first;
+	  cp = ep;
+	  if (*cp == '-') {
+		last = strtol(cp + 1, &ep, 10);
+		if (ep == cp + 1 || last < first)
+		  goto error;
+		cp = ep;
+	  }
+	  for (; first <= last; first++) {
+		if (*cpus)
+		  (*cpus)[n_cpus] = first;
+		++n_cpus;
+	  }
+	  if (*cp == ',')
+		++cp;
+	}
+	if (pass == 0) {
+	  if (n_cpus == 0)
+		return 0;
+	  if ((*cpus = (int *)malloc(n_cpus * sizeof(**cpus))) == NULL)
+		return -1;
+	}
+  }
+  return n_cpus;
+
+ error:
+  if (*cpus) {
+	free(*cpus);
+	*cpus = NULL;
+  }
+  return -1;
+}
+
+// Get environment variable NAME, ignored in setuid and setgid programs
+const char *cpuinfo_getenv(const char *name)
+{
+  if (getuid() != geteuid() || getgid() != getegid())
+	return NULL;
+  const char *value = getenv(name);
+  if (value == NULL || *value == '\0')
+	return NULL;
+  return value;
+}
+
+// FNV-1a hash of SIZE bytes of DATA, continuing from HASH
+uint64_t cpuinfo_hash_bytes(uint64_t hash, const void *data, size_t size)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  while (size-- > 0) {
+	hash ^= *p++;
+	hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
 /* ========================================================================= */
 /* == Lists                                                               == */
 /* ========================================================================= */
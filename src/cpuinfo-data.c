@@ -0,0 +1,332 @@
+/*
+ *  cpuinfo-data.c - Processor identification tables
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "sysdeps.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+#include "cpuinfo.h"
+#include "cpuinfo-private.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Tables compiled from cpuinfo-data.def, see cpuinfo-mkdata.pl for the layout
+#include "cpuinfo-data.h"
+
+static const char cpuinfo_db_env[] = "CPUINFO_DB";
+
+#define DB_MAGIC			"CPUINFDB"
+#define DB_FORMAT			1
+#define DB_MAX_SIZE			(1 << 24)
+
+// Header fields (32-bit words following the magic)
+enum {
+  DB_HEADER_FORMAT,
+  DB_HEADER_REVISION,
+  DB_HEADER_SIZE,
+  DB_HEADER_N_TABLES,
+  DB_HEADER_STRINGS_OFFSET,
+  DB_HEADER_STRINGS_SIZE,
+  DB_HEADER_N_FIELDS
+};
+
+// Table directory entry fields
+enum {
+  DB_TABLE_ID,
+  DB_TABLE_N_FIELDS,
+  DB_TABLE_N_RECORDS,
+  DB_TABLE_OFFSET,
+  DB_TABLE_N_ENTRY_FIELDS
+};
+
+#define DB_HEADER_BYTES		(sizeof(DB_MAGIC) - 1 + 4 * DB_HEADER_N_FIELDS)
+#define DB_TABLE_BYTES		(4 * DB_TABLE_N_ENTRY_FIELDS)
+
+// Active tables, either the installed file or the built-in copy
+static const uint8_t *db_data;
+static const char *db_strings;
+static uint32_t db_strings_size;
+
+static inline uint32_t get_le32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint32_t db_header(const uint8_t *data, int n)
+{
+  return get_le32(data + sizeof(DB_MAGIC) - 1 + 4 * n);
+}
+
+static inline uint32_t db_table(const uint8_t *data, int i, int n)
+{
+  return get_le32(data + DB_HEADER_BYTES + DB_TABLE_BYTES * i + 4 * n);
+}
+
+// Check tables of SIZE bytes are consistent, returns the revision or -1 if invalid
+static int db_check(const uint8_t *data, uint32_t size)
+{
+  if (size < DB_HEADER_BYTES || memcmp(data, DB_MAGIC, sizeof(DB_MAGIC) - 1) != 0)
+	return -1;
+  if (db_header(data, DB_HEADER_FORMAT) != DB_FORMAT || db_header(data, DB_HEADER_SIZE) != size)
+	return -1;
+
+  uint32_t n_tables = db_header(data, DB_HEADER_N_TABLES);
+  uint32_t strings_offset = db_header(data, DB_HEADER_STRINGS_OFFSET);
+  uint32_t strings_size = db_header(data, DB_HEADER_STRINGS_SIZE);
+  if (n_tables > (size - DB_HEADER_BYTES) / DB_TABLE_BYTES)
+	return -1;
+  if (strings_offset < DB_HEADER_BYTES + DB_TABLE_BYTES * n_tables || strings_offset > size)
+	return -1;
+  if (strings_size == 0 || strings_size != size - strings_offset)
+	return -1;
+  if (data[strings_offset] != '\0' || data[size - 1] != '\0')
+	return -1;
+
+  int i, j;
+  for (i = 0; i < n_tables; i++) {
+	uint32_t n_fields = db_table(data, i, DB_TABLE_N_FIELDS);
+	uint32_t n_records = db_table(data, i, DB_TABLE_N_RECORDS);
+	uint32_t offset = db_table(data, i, DB_TABLE_OFFSET);
+	if (n_fields == 0 || n_fields > 256 || offset > strings_offset)
+	  return -1;
+	if (n_records > (strings_offset - offset) / (4 * n_fields))
+	  return -1;
+	// lookups rely on records being sorted by key
+	if ((db_table(data, i, DB_TABLE_ID) & (CPUINFO_DB_MASKS | CPUINFO_DB_INDEX)) == 0) {
+	  for (j = 1; j < n_records; j++) {
+		const uint8_t *rp = data + offset + 4 * n_fields * j;
+		if (get_le32(rp - 4 * n_fields) > get_le32(rp))
+		  return -1;
+	  }
+	}
+  }
+
+  return db_header(data, DB_HEADER_REVISION);
+}
+
+// Map tables file FILENAME into memory
+static const uint8_t *db_map_file(const char *filename, uint32_t *psize)
+{
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+	return NULL;
+
+  const uint8_t *data = NULL;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0 && st.st_size <= DB_MAX_SIZE) {
+	*psize = st.st_size;
+#ifdef HAVE_MMAP
+	void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (p != MAP_FAILED)
+	  data = p;
+#else
+	uint8_t *p = malloc(st.st_size);
+	if (p && read(fd, p, st.st_size) == st.st_size)
+	  data = p;
+	else if (p)
+	  free(p);
+#endif
+  }
+  close(fd);
+  return data;
+}
+
+static void db_unmap_file(const uint8_t *data, uint32_t size)
+{
+#ifdef HAVE_MMAP
+  munmap((void *)data, size);
+#else
+  free((void *)data);
+#endif
+}
+
+// Load tables file FILENAME if it is valid and at least of revision MIN_REVISION
+static const uint8_t *db_load_file(const char *filename, int min_revision)
+{
+  uint32_t size;
+  const uint8_t *data = db_map_file(filename, &size);
+  if (data == NULL)
+	return NULL;
+
+  int revision = db_check(data, size);
+  if (revision < min_revision) {
+	D(bug("ignoring tables file %s (revision %d)\n", filename, revision));
+	db_unmap_file(data, size);
+	return NULL;
+  }
+  return data;
+}
+
+static void db_init(void)
+{
+  static int initialized = 0; // XXX use a lock!
+  const uint8_t *data;
+
+  if (initialized)
+	return;
+
+  const char *filename = cpuinfo_getenv(cpuinfo_db_env);
+  if (filename)
+	data = db_load_file(filename, 0);
+  else {
+	// an installed file only supersedes newer built-in tables
+	data = NULL;
+#ifdef CPUINFO_DATADIR
+	data = db_load_file(CPUINFO_DATADIR "/cpuinfo.db", db_header(cpuinfo_builtin_db, DB_HEADER_REVISION));
+#endif
+  }
+  if (data == NULL) {
+	data = cpuinfo_builtin_db;
+	assert(db_check(data, sizeof(cpuinfo_builtin_db)) >= 0);
+  }
+
+  db_strings = (const char *)data + db_header(data, DB_HEADER_STRINGS_OFFSET);
+  db_strings_size = db_header(data, DB_HEADER_STRINGS_SIZE);
+  db_data = data;
+  initialized = 1;
+}
+
+// Find table ID in the directory (returns -1 if there is none)
+static int db_find_table(int id)
+{
+  int i, n_tables = db_header(db_data, DB_HEADER_N_TABLES);
+  for (i = 0; i < n_tables; i++) {
+	if (db_table(db_data, i, DB_TABLE_ID) == id)
+	  return i;
+  }
+  return -1;
+}
+
+// Get table ID with at least N_FIELDS fields per record (returns -1 if there is none)
+int cpuinfo_db_get_table(int id, int n_fields, cpuinfo_db_table_t *tp)
+{
+  db_init();
+
+  int i = db_find_table(id);
+  if (i < 0)
+	return -1;
+  // newer tables may append fields to the records
+  if (db_table(db_data, i, DB_TABLE_N_FIELDS) < n_fields)
+	return -1;
+  if (tp) {
+	tp->id = id;
+	tp->n_fields = db_table(db_data, i, DB_TABLE_N_FIELDS);
+	tp->n_records = db_table(db_data, i, DB_TABLE_N_RECORDS);
+	tp->records = (const cpuinfo_db_record_t *)(db_data + db_table(db_data, i, DB_TABLE_OFFSET));
+	tp->index = NULL;
+	// tables keyed by bytes, e.g. cpuid(2) descriptors, are indexed directly
+	if ((id & (CPUINFO_DB_MASKS | CPUINFO_DB_INDEX)) == 0 && (i = db_find_table(id | CPUINFO_DB_INDEX)) >= 0) {
+	  if (db_table(db_data, i, DB_TABLE_N_FIELDS) == 1 && db_table(db_data, i, DB_TABLE_N_RECORDS) == 256)
+		tp->index = db_data + db_table(db_data, i, DB_TABLE_OFFSET);
+	}
+  }
+  return 0;
+}
+
+static inline const uint8_t *db_record(const cpuinfo_db_table_t *tp, int i)
+{
+  return (const uint8_t *)tp->records + 4 * tp->n_fields * i;
+}
+
+// Returns the first record whose key (field 0) is KEY, or NULL if there is none
+const cpuinfo_db_record_t *cpuinfo_db_lookup(const cpuinfo_db_table_t *tp, uint32_t key)
+{
+  if (tp->index) {
+	uint32_t i = key < 256 ? get_le32(tp->index + 4 * key) : 0;
+	if (i == 0 || i > tp->n_records || get_le32(db_record(tp, i - 1)) != key)
+	  return NULL;
+	return (const cpuinfo_db_record_t *)db_record(tp, i - 1);
+  }
+
+  int lo = 0, hi = tp->n_records;
+  while (lo < hi) {
+	int mid = lo + (hi - lo) / 2;
+	if (get_le32(db_record(tp, mid)) < key)
+	  lo = mid + 1;
+	else
+	  hi = mid;
+  }
+  if (lo < tp->n_records && get_le32(db_record(tp, lo)) == key)
+	return (const cpuinfo_db_record_t *)db_record(tp, lo);
+  return NULL;
+}
+
+// Returns the record following RP if it has the same key, or NULL
+const cpuinfo_db_record_t *cpuinfo_db_next(const cpuinfo_db_table_t *tp, const cpuinfo_db_record_t *rp)
+{
+  const uint8_t *next = (const uint8_t *)rp + 4 * tp->n_fields;
+  if (next >= db_record(tp, tp->n_records))
+	return NULL;
+  if (get_le32(next) != get_le32((const uint8_t *)rp))
+	return NULL;
+  return (const cpuinfo_db_record_t *)next;
+}
+
+// Returns the most specific record such that (VALUE & field MASK_FIELD) == key, or NULL
+const cpuinfo_db_record_t *cpuinfo_db_lookup_masked(const cpuinfo_db_table_t *tp, uint32_t value, int mask_field)
+{
+  cpuinfo_db_table_t masks;
+  if (mask_field >= tp->n_fields || cpuinfo_db_get_table(tp->id | CPUINFO_DB_MASKS, 1, &masks) < 0)
+	return NULL;
+
+  int i;
+  for (i = 0; i < masks.n_records; i++) {
+	uint32_t mask = get_le32(db_record(&masks, i));
+	const cpuinfo_db_record_t *rp;
+	for (rp = cpuinfo_db_lookup(tp, value & mask); rp != NULL; rp = cpuinfo_db_next(tp, rp)) {
+	  if (cpuinfo_db_field(rp, mask_field) == mask)
+		return rp;
+	}
+  }
+  return NULL;
+}
+
+// Returns field N of record RP
+uint32_t cpuinfo_db_field(const cpuinfo_db_record_t *rp, int n)
+{
+  return get_le32((const uint8_t *)rp + 4 * n);
+}
+
+// Returns the string stored into field N of record RP, or NULL if there is none
+const char *cpuinfo_db_string(const cpuinfo_db_record_t *rp, int n)
+{
+  uint32_t offset = cpuinfo_db_field(rp, n);
+  if (offset == 0 || offset >= db_strings_size)
+	return NULL;
+  return db_strings + offset;
+}
+
+// Decode a cache descriptor packed by the generator (returns -1 if there is none)
+int cpuinfo_db_cache(const cpuinfo_db_record_t *rp, int n, cpuinfo_cache_descriptor_t *cdp)
+{
+  uint32_t value = cpuinfo_db_field(rp, n);
+  if (value == 0)
+	return -1;
+
+  memset(cdp, 0, sizeof(*cdp));
+  cdp->type = value >> 28;
+  cdp->level = (value >> 24) & 0xf;
+  cdp->size = value & 0xffffff;
+  return 0;
+}
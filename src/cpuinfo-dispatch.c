@@ -0,0 +1,445 @@
+/*
+ *  cpuinfo-dispatch.c - Function dispatch
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "sysdeps.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include "cpuinfo.h"
+#include "cpuinfo-private.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Descriptor of the current processor, for callers that don't have one
+static struct cpuinfo *get_cpuinfo(struct cpuinfo *cip)
+{
+  static struct cpuinfo *self_cip = NULL;
+
+  if (cip)
+	return cip;
+  if ((cip = __atomic_load_n(&self_cip, __ATOMIC_ACQUIRE)) != NULL)
+	return cip;
+  // threads racing to create it keep the first descriptor published
+  if ((cip = cpuinfo_new()) == NULL)
+	return NULL;
+  struct cpuinfo *expected = NULL;
+  if (!__atomic_compare_exchange_n(&self_cip, &expected, cip, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+	cpuinfo_destroy(cip);
+	cip = expected;
+  }
+  return cip;
+}
+
+// Returns 1 if all features required by the variant are usable
+int cpuinfo_dispatch_is_usable(struct cpuinfo *cip, const cpuinfo_dispatch_variant_t *vp)
+{
+  if (vp == NULL)
+	return 0;
+  // variants without requirements are fallbacks, don't probe for them
+  if (vp->features[0] == 0)
+	return 1;
+  if ((cip = get_cpuinfo(cip)) == NULL)
+	return 0;
+
+  int i;
+  for (i = 0; i < CPUINFO_DISPATCH_MAX_FEATURES && vp->features[i] != 0; i++) {
+	if ((cpuinfo_get_feature_status(cip, vp->features[i]) & CPUINFO_FEATURE_STATUS_USABLE) == 0)
+	  return 0;
+  }
+  return 1;
+}
+
+// Select the usable variant of highest priority, returns its index or -1 if none is usable
+int cpuinfo_dispatch_resolve(struct cpuinfo *cip, cpuinfo_dispatch_t *dp)
+{
+  if (dp == NULL || dp->variants == NULL)
+	return -1;
+
+  int i, selected = -1;
+  for (i = 0; dp->variants[i].name != NULL; i++) {
+	const cpuinfo_dispatch_variant_t *vp = &dp->variants[i];
+	// the first of variants with equal priorities wins
+	if (selected >= 0 && vp->priority <= dp->variants[selected].priority)
+	  continue;
+	if (cpuinfo_dispatch_is_usable(cip, vp))
+	  selected = i;
+  }
+
+  // the pointer is written once, concurrent resolutions store the same value
+  dp->selected = selected >= 0 ? &dp->variants[selected] : NULL;
+  D(bug("dispatch %s: selected %s\n", dp->name ? dp->name : "<unnamed>",
+		dp->selected ? dp->selected->name : "<none>"));
+  return selected;
+}
+
+// Returns the function of the selected variant, resolving it first if needed
+cpuinfo_function_t cpuinfo_dispatch_get_function(struct cpuinfo *cip, cpuinfo_dispatch_t *dp)
+{
+  if (dp == NULL)
+	return NULL;
+  if (dp->selected == NULL && cpuinfo_dispatch_resolve(cip, dp) < 0)
+	return NULL;
+  return dp->selected->function;
+}
+
+// Returns the table of the selected variant, resolving it first if needed
+const void *cpuinfo_dispatch_get_table(struct cpuinfo *cip, cpuinfo_dispatch_t *dp)
+{
+  if (dp == NULL)
+	return NULL;
+  if (dp->selected == NULL && cpuinfo_dispatch_resolve(cip, dp) < 0)
+	return NULL;
+  return dp->selected->table;
+}
+
+// Returns the name of the selected variant, or NULL if it is not resolved
+const char *cpuinfo_dispatch_get_variant(const cpuinfo_dispatch_t *dp)
+{
+  if (dp == NULL || dp->selected == NULL)
+	return NULL;
+  return dp->selected->name;
+}
+
+
+/* ========================================================================= */
+/* == Tuning                                                              == */
+/* ========================================================================= */
+
+static const char cpuinfo_tune_cache_env[] = "CPUINFO_TUNE_CACHE";
+
+#define TUNE_MIN_TIME		0.002	// minimum duration of a trial, in seconds
+#define TUNE_N_TRIALS		7
+#define TUNE_MAX_REPEAT		(1 << 24)
+
+typedef struct {
+  const cpuinfo_dispatch_variant_t *vp;
+  cpuinfo_tune_workload_t workload;
+  void *data;
+  double time;							// median time of a workload run, in seconds
+} tune_args_t;
+
+static double get_time(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static int compare_times(const void *a, const void *b)
+{
+  double ta = *(const double *)a, tb = *(const double *)b;
+  return ta < tb ? -1 : ta > tb;
+}
+
+// Median time of TUNE_N_TRIALS trials, each repeating the workload for at least TUNE_MIN_TIME
+static void time_variant_func(void *arg)
+{
+  tune_args_t *args = (tune_args_t *)arg;
+  const cpuinfo_dispatch_variant_t *vp = args->vp;
+  double times[TUNE_N_TRIALS];
+  int i, n;
+
+  // warm up, then scale the repeat count so that timer resolution doesn't matter
+  args->workload(vp->function, vp->table, args->data);
+  for (n = 1; n < TUNE_MAX_REPEAT; n *= 2) {
+	double start = get_time();
+	for (i = 0; i < n; i++)
+	  args->workload(vp->function, vp->table, args->data);
+	if (get_time() - start >= TUNE_MIN_TIME)
+	  break;
+  }
+
+  for (i = 0; i < TUNE_N_TRIALS; i++) {
+	int j;
+	double start = get_time();
+	for (j = 0; j < n; j++)
+	  args->workload(vp->function, vp->table, args->data);
+	times[i] = (get_time() - start) / n;
+  }
+  qsort(times, TUNE_N_TRIALS, sizeof(times[0]), compare_times);
+  args->time = times[TUNE_N_TRIALS / 2];
+}
+
+// Get tuning cache file name into PATH (returns -1 if there is none)
+static int get_tune_cache_path(char *path, int size)
+{
+  const char *filename = cpuinfo_getenv(cpuinfo_tune_cache_env);
+  if (filename)
+	return snprintf(path, size, "%s", filename) < size ? 0 : -1;
+
+  int n;
+  const char *dir = cpuinfo_getenv("XDG_CACHE_HOME");
+  if (dir)
+	n = snprintf(path, size, "%s", dir);
+  else if ((dir = cpuinfo_getenv("HOME")) != NULL)
+	n = snprintf(path, size, "%s/.cache", dir);
+  else
+	return -1;
+  if (n >= size)
+	return -1;
+  mkdir(path, 0700);
+  return snprintf(path + n, size - n, "/cpuinfo-tune") < size - n ? 0 : -1;
+}
+
+// Hash of variant names, so that results are discarded when the variants change
+static uint32_t hash_variants(const cpuinfo_dispatch_t *dp)
+{
+  uint64_t hash = CPUINFO_HASH_INIT;
+  int i;
+  for (i = 0; dp->variants[i].name != NULL; i++)
+	hash = cpuinfo_hash_bytes(hash, dp->variants[i].name, strlen(dp->variants[i].name) + 1);
+  return (uint32_t)(hash ^ (hash >> 32));
+}
+
+#define TUNE_CACHE_MAX_RECORDS	4096
+
+// Returns the length of the key of a tuning cache record, its first three fields (host, dispatcher,
+// workload), or -1 if the record does not have the five fields
+static int get_record_key_length(const char *record)
+{
+  const char *p = record, *key_end = NULL;
+  int i;
+  for (i = 0; i < 4; i++) {
+	if ((p = strchr(p, ' ')) == NULL)
+	  return -1;
+	if (i == 2)
+	  key_end = p;
+	p++;
+  }
+  return key_end - record;
+}
+
+// Returns the index of the variant saved for DP and workload KEY on host HOST_ID, or -1 if there is none
+static int tune_cache_lookup(const char *path, const char *host_id, const cpuinfo_dispatch_t *dp, const char *key)
+{
+  FILE *fp = fopen(path, "r");
+  if (fp == NULL)
+	return -1;
+
+  uint32_t variants_hash = hash_variants(dp);
+  char line[1024], id[32], name[256], workload[256], variant[256];
+  unsigned int hash;
+  int i, selected = -1;
+  // later lines supersede earlier ones
+  while (fgets(line, sizeof(line), fp)) {
+	if (sscanf(line, "%31s %255s %255s %x %255s", id, name, workload, &hash, variant) != 5)
+	  continue;
+	if (strcmp(id, host_id) != 0 || strcmp(name, dp->name) != 0 || strcmp(workload, key) != 0 || hash != variants_hash)
+	  continue;
+	for (i = 0; dp->variants[i].name != NULL; i++) {
+	  if (strcmp(dp->variants[i].name, variant) == 0) {
+		selected = i;
+		break;
+	  }
+	}
+  }
+  fclose(fp);
+  return selected;
+}
+
+// Save variant VP for DP and workload KEY on host HOST_ID, keeping the latest record of each key
+// and evicting the oldest records past TUNE_CACHE_MAX_RECORDS
+static void tune_cache_save(const char *path, const char *host_id, const cpuinfo_dispatch_t *dp, const char *key,
+							const cpuinfo_dispatch_variant_t *vp)
+{
+  char record[1024];
+  int n = snprintf(record, sizeof(record), "%s %s %s %08x %s\n", host_id, dp->name, key, hash_variants(dp), vp->name);
+  if (n >= sizeof(record))
+	return;
+
+  // serialize updates from concurrent processes, the cache file itself is replaced
+  char lock_path[1100];
+  if (snprintf(lock_path, sizeof(lock_path), "%s.lock", path) >= sizeof(lock_path))
+	return;
+  int lock_fd = open(lock_path, O_RDWR | O_CREAT, 0644);
+  if (lock_fd < 0)
+	return;
+  if (flock(lock_fd, LOCK_EX) < 0) {
+	close(lock_fd);
+	return;
+  }
+
+  char **records = NULL;
+  int i, j, n_records = 0, max_records = 0;
+  FILE *fp = fopen(path, "r");
+  if (fp) {
+	char line[1024];
+	while (fgets(line, sizeof(line), fp)) {
+	  if (get_record_key_length(line) < 0 || line[strlen(line) - 1] != '\n')
+		continue;
+	  if (n_records + 1 >= max_records) {
+		int new_max_records = max_records ? 2 * max_records : 64;
+		char **new_records = (char **)realloc(records, new_max_records * sizeof(*records));
+		if (new_records == NULL)
+		  break;
+		records = new_records;
+		max_records = new_max_records;
+	  }
+	  if ((records[n_records] = strdup(line)) != NULL)
+		n_records++;
+	}
+	fclose(fp);
+  }
+  if (n_records >= max_records) {
+	char **new_records = (char **)realloc(records, (n_records + 1) * sizeof(*records));
+	if (new_records == NULL) {
+	  for (i = 0; i < n_records; i++)
+		free(records[i]);
+	  free(records);
+	  close(lock_fd);
+	  return;
+	}
+	records = new_records;
+  }
+  records[n_records++] = record;
+
+  // drop records superseded by a later one with the same key
+  int n_kept = 0;
+  for (i = 0; i < n_records; i++) {
+	int len = get_record_key_length(records[i]);
+	for (j = i + 1; j < n_records; j++) {
+	  if (strncmp(records[j], records[i], len + 1) == 0)
+		break;
+	}
+	if (j < n_records) {
+	  free(records[i]);
+	  records[i] = NULL;
+	}
+	else
+	  n_kept++;
+  }
+
+  // then the oldest ones, the new record comes last and is always kept
+  for (i = 0; n_kept > TUNE_CACHE_MAX_RECORDS; i++) {
+	if (records[i]) {
+	  free(records[i]);
+	  records[i] = NULL;
+	  n_kept--;
+	}
+  }
+
+  // write the new file aside, so that readers never see a partial file
+  char tmp_path[1100];
+  FILE *out = NULL;
+  if (snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", path) < sizeof(tmp_path)) {
+	int fd = mkstemp(tmp_path);
+	if (fd >= 0) {
+	  fchmod(fd, 0644);
+	  if ((out = fdopen(fd, "w")) == NULL) {
+		close(fd);
+		unlink(tmp_path);
+	  }
+	}
+  }
+  if (out) {
+	for (i = 0; i < n_records; i++) {
+	  if (records[i])
+		fputs(records[i], out);
+	}
+	if (fclose(out) != 0 || rename(tmp_path, path) < 0) {
+	  D(bug("could not save tuning result to %s\n", path));
+	  unlink(tmp_path);
+	}
+  }
+  close(lock_fd);
+
+  for (i = 0; i < n_records - 1; i++)
+	free(records[i]);
+  free(records);
+}
+
+// Names are saved as single words
+static int is_cacheable_name(const char *name)
+{
+  if (name == NULL || *name == '\0')
+	return 0;
+  for (; *name; name++) {
+	if (*name <= ' ')
+	  return 0;
+  }
+  return 1;
+}
+
+// Select the usable variant that runs WORKLOAD fastest on this processor
+int cpuinfo_dispatch_tune(struct cpuinfo *cip, cpuinfo_dispatch_t *dp,
+						  cpuinfo_tune_workload_t workload, void *data)
+{
+  return cpuinfo_dispatch_tune_key(cip, dp, NULL, workload, data);
+}
+
+// Select the usable variant that runs WORKLOAD named KEY fastest on this processor
+int cpuinfo_dispatch_tune_key(struct cpuinfo *cip, cpuinfo_dispatch_t *dp, const char *key,
+							  cpuinfo_tune_workload_t workload, void *data)
+{
+  if (dp == NULL || dp->variants == NULL)
+	return -1;
+  if (workload == NULL || (cip = get_cpuinfo(cip)) == NULL)
+	return cpuinfo_dispatch_resolve(cip, dp);
+
+  char path[1024];
+  const char *host_id = cpuinfo_get_host_id(cip);
+  if (key == NULL)
+	key = "default";
+  int cacheable = host_id && is_cacheable_name(dp->name) && is_cacheable_name(key)
+	&& get_tune_cache_path(path, sizeof(path)) == 0;
+  int i, selected = -1;
+  for (i = 0; dp->variants[i].name != NULL; i++) {
+	if (!is_cacheable_name(dp->variants[i].name))
+	  cacheable = 0;
+  }
+
+  if (cacheable && (selected = tune_cache_lookup(path, host_id, dp, key)) >= 0) {
+	if (cpuinfo_dispatch_is_usable(cip, &dp->variants[selected])) {
+	  dp->selected = &dp->variants[selected];
+	  D(bug("dispatch %s: cached %s\n", dp->name, dp->selected->name));
+	  return selected;
+	}
+	selected = -1;
+  }
+
+  // time on the fastest processor, so that results don't depend on where the thread runs
+  int cpu;
+  if (cpuinfo_get_fastest_cpus(cip, &cpu, 1) != 1)
+	cpu = -1;
+  double best = 0;
+  for (i = 0; dp->variants[i].name != NULL; i++) {
+	const cpuinfo_dispatch_variant_t *vp = &dp->variants[i];
+	if (!cpuinfo_dispatch_is_usable(cip, vp))
+	  continue;
+	tune_args_t args = { vp, workload, data, 0 };
+	if (cpu < 0 || cpuinfo_run_on_cpu(cpu, time_variant_func, &args) < 0)
+	  time_variant_func(&args);
+	D(bug("dispatch %s: %s takes %g us\n", dp->name ? dp->name : "<unnamed>", vp->name, args.time * 1e6));
+	if (selected < 0 || args.time < best) {
+	  selected = i;
+	  best = args.time;
+	}
+  }
+  if (selected < 0)
+	return cpuinfo_dispatch_resolve(cip, dp);
+
+  dp->selected = &dp->variants[selected];
+  if (cacheable)
+	tune_cache_save(path, host_id, dp, key, dp->selected);
+  return selected;
+}
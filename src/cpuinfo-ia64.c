@@ -31,6 +31,7 @@
 #include "debug.h"
 
 // Extract CPUID registers
+attribute_no_stack_protector
 static uint64_t cpuid(int reg)
 {
   uint64_t value = 0;
@@ -74,6 +75,9 @@ static int cpuinfo_arch_init(ia64_cpuinfo_t *acip)
   char line[256];
   char dummy[sizeof(line)];
   cpuinfo_cache_descriptor_t cache_desc;
+  cache_desc.sharing = 0;
+  cache_desc.line_size = 0;
+  cache_desc.ways = 0;
   FILE *cache_info = fopen("/proc/pal/cpu0/cache_info", "r"); // XXX: iterate until an online processor
   if (cache_info) {
 	char cache_type[32];
@@ -103,6 +107,12 @@ static int cpuinfo_arch_init(ia64_cpuinfo_t *acip)
 	  else if (sscanf(line, "%[ \t] Size : %d bytes", dummy, &i) == 2) {
 		cache_desc.size = i / 1024;
 	  }
+	  else if (sscanf(line, "%[ \t] Line size : %d bytes", dummy, &i) == 2) {
+		cache_desc.line_size = i;
+	  }
+	  else if (sscanf(line, "%[ \t] Associativity : %d", dummy, &i) == 2) {
+		cache_desc.ways = i;
+	  }
 	}
 	if (cache_desc.level > 0)
 	  cpuinfo_list_insert(&acip->caches, &cache_desc);
@@ -111,6 +121,9 @@ static int cpuinfo_arch_init(ia64_cpuinfo_t *acip)
 #elif defined __hpux
   char line[256];
   cpuinfo_cache_descriptor_t cache_desc;
+  cache_desc.sharing = 0;
+  cache_desc.line_size = 0;
+  cache_desc.ways = 0;
   FILE *cache_info = popen("/usr/contrib/bin/machinfo", "r"); // XXX: detect machinfo path?
   if (cache_info) {
 	char cache_type[32];
@@ -129,6 +142,7 @@ static int cpuinfo_arch_init(ia64_cpuinfo_t *acip)
 		  cpuinfo_list_insert(&acip->caches, &cache_desc);
 		cache_desc.level = level;
 		cache_desc.size = size;
+		cache_desc.ways = assoc;
 		if (strcmp(cache_type, "Instruction") == 0)
 		  cache_desc.type = CPUINFO_CACHE_TYPE_CODE;
 		else if (strcmp(cache_type, "Data") == 0)
@@ -292,6 +306,21 @@ char *cpuinfo_arch_get_model(struct cpuinfo *cip)
   return NULL;
 }
 
+// Get processor signature (family, model, stepping)
+uint32_t cpuinfo_arch_get_signature(struct cpuinfo *cip)
+{
+  ia64_cpuinfo_t *acip = (ia64_cpuinfo_t *)(cip->opaque);
+  if (acip == NULL)
+	return 0;
+  return (uint32_t)(acip->cpuid[3] >> 8);
+}
+
+// Get processor microarchitecture (of the current core if CORE_TYPE is unknown)
+int cpuinfo_arch_get_uarch(struct cpuinfo *cip, int core_type)
+{
+  return -1;
+}
+
 // Get processor frequency in MHz
 int cpuinfo_arch_get_frequency(struct cpuinfo *cip)
 {
@@ -316,6 +345,55 @@ int cpuinfo_arch_get_threads(struct cpuinfo *cip)
   return -1;
 }
 
+// Get type of the current processor core
+int cpuinfo_arch_get_core_type(struct cpuinfo *cip, int *native_model)
+{
+  *native_model = -1;
+  return CPUINFO_CORE_TYPE_UNKNOWN;
+}
+
+// Get extended state components enabled by the OS
+int cpuinfo_arch_get_xsave_info(struct cpuinfo *cip, cpuinfo_xsave_t *xsp)
+{
+  return -1;
+}
+
+// Get AMX tile palette information
+int cpuinfo_arch_get_tile_info(struct cpuinfo *cip, cpuinfo_tile_info_t *tip)
+{
+  return -1;
+}
+
+// Request permission to use AMX tile data
+int cpuinfo_arch_request_tile_permission(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Returns 1 if the processor supports pages of SIZE KB, 0 if not, -1 if unknown
+int cpuinfo_arch_has_page_size(struct cpuinfo *cip, int size)
+{
+  return -1;
+}
+
+// Get hardware prefetch size in bytes
+int cpuinfo_arch_get_prefetch_size(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Get TLB information
+cpuinfo_list_t cpuinfo_arch_get_tlbs(struct cpuinfo *cip)
+{
+  return NULL;
+}
+
+// Get virtualizer and paravirtual timing information
+int cpuinfo_arch_get_virtualizer(struct cpuinfo *cip, cpuinfo_virtualizer_info_t *vip)
+{
+  return -1;
+}
+
 // Get cache information
 cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
 {
@@ -356,3 +434,43 @@ int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
 
   return cpuinfo_feature_get_bit(cip, feature);
 }
+
+// Returns 1 if the processor reports the specified feature
+int cpuinfo_arch_has_hardware_feature(struct cpuinfo *cip, int feature)
+{
+  return cpuinfo_arch_has_feature(cip, feature);
+}
+
+// Returns the name of the feature as reported by the OS, or NULL if it is not reported
+const char *cpuinfo_arch_feature_os_name(int feature, int *linux_version)
+{
+  return NULL;
+}
+
+// Get the AT_HWCAP bit for the feature (returns -1 if there is none)
+int cpuinfo_arch_feature_hwcap(int feature, int *hwcap, unsigned long *mask)
+{
+  return -1;
+}
+
+// Execute advertised features, returns the number of features that faulted
+int cpuinfo_arch_verify_features(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Fill FEATURES without allocating memory nor calling the C library, returns the feature class
+int cpuinfo_arch_resolver_features(uint32_t *features, unsigned long hwcap)
+{
+  features[0] |= 1;
+  if ((cpuid(3) & 0xff) >= 4) {
+	uint64_t cpuid_features = cpuid(4);
+	if (cpuid_features & (1 << 0))
+	  features[0] |= 1U << (CPUINFO_FEATURE_IA64_LB & CPUINFO_FEATURE_MASK);
+	if (cpuid_features & (1 << 1))
+	  features[0] |= 1U << (CPUINFO_FEATURE_IA64_SD & CPUINFO_FEATURE_MASK);
+	if (cpuid_features & (1 << 2))
+	  features[0] |= 1U << (CPUINFO_FEATURE_IA64_AO & CPUINFO_FEATURE_MASK);
+  }
+  return CPUINFO_FEATURE_IA64;
+}
@@ -0,0 +1,366 @@
+/*
+ *  cpuinfo-kernels-bench.c - Check and benchmark kernel variants
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include "sysdeps.h"
+#include <sys/time.h>
+#include "cpuinfo.h"
+#include "cpuinfo-kernels.h"
+#include "cpuinfo-kernels-private.h"
+
+#define N_CHECKS		1000
+#define MAX_CHECK_SIZE	4096
+#define BENCH_TIME		0.25
+
+static uint8_t *buffer;
+static uint8_t *copy_buffer;
+static size_t buffer_size = 256 * 1024;
+
+static double get_time(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void fill_random(void *buf, size_t size)
+{
+  uint8_t *p = buf;
+  while (size--)
+	*p++ = rand();
+}
+
+// Returns the scalar variant, the reference for others
+static const cpuinfo_dispatch_variant_t *get_reference(const cpuinfo_dispatch_t *dp)
+{
+  const cpuinfo_dispatch_variant_t *vp, *ref = NULL;
+  for (vp = dp->variants; vp->name != NULL; vp++) {
+	if (vp->features[0] == 0)
+	  ref = vp;
+  }
+  return ref;
+}
+
+// Check variant VP against REF on random sizes and alignments, returns the number of mismatches
+static int check_variant(int kernel, const cpuinfo_dispatch_variant_t *vp, const cpuinfo_dispatch_variant_t *ref)
+{
+  int i, errors = 0;
+  for (i = 0; i < N_CHECKS; i++) {
+	size_t offset = rand() % 64;
+	size_t size = rand() % (MAX_CHECK_SIZE - offset);
+	const uint8_t *p = buffer + offset;
+	switch (kernel) {
+	case CPUINFO_KERNEL_CRC32C: {
+	  uint32_t crc = rand();
+	  if (((cpuinfo_crc32c_func_t)vp->function)(crc, p, size) != ((cpuinfo_crc32c_func_t)ref->function)(crc, p, size))
+		errors++;
+	  break;
+	}
+	case CPUINFO_KERNEL_POPCOUNT:
+	  if (((cpuinfo_popcount_func_t)vp->function)(p, size) != ((cpuinfo_popcount_func_t)ref->function)(p, size))
+		errors++;
+	  break;
+	case CPUINFO_KERNEL_BITSET_SCAN: {
+	  // a single bit set, or none
+	  uint64_t *words = (uint64_t *)buffer;
+	  size_t n_words = size / 8;
+	  memset(words, 0, n_words * 8);
+	  if (n_words > 0 && (i & 7) != 0)
+		words[rand() % n_words] = 1ULL << (rand() % 64);
+	  if (((cpuinfo_bitset_scan_func_t)vp->function)(words, n_words) != ((cpuinfo_bitset_scan_func_t)ref->function)(words, n_words))
+		errors++;
+	  fill_random(buffer, n_words * 8);
+	  break;
+	}
+	}
+  }
+  return errors;
+}
+
+// Returns the throughput of variant VP in GB/s
+static double bench_variant(int kernel, const cpuinfo_dispatch_variant_t *vp)
+{
+  volatile uint64_t sink = 0;
+  double start = get_time(), elapsed;
+  uint64_t n_bytes = 0;
+
+  if (kernel == CPUINFO_KERNEL_BITSET_SCAN)
+	memset(buffer, 0, buffer_size);
+  do {
+	int i;
+	for (i = 0; i < 16; i++) {
+	  switch (kernel) {
+	  case CPUINFO_KERNEL_CRC32C:
+		sink += ((cpuinfo_crc32c_func_t)vp->function)(0, buffer, buffer_size);
+		break;
+	  case CPUINFO_KERNEL_POPCOUNT:
+		sink += ((cpuinfo_popcount_func_t)vp->function)(buffer, buffer_size);
+		break;
+	  case CPUINFO_KERNEL_BITSET_SCAN:
+		sink += ((cpuinfo_bitset_scan_func_t)vp->function)((const uint64_t *)buffer, buffer_size / 8);
+		break;
+	  }
+	  n_bytes += buffer_size;
+	}
+  } while ((elapsed = get_time() - start) < BENCH_TIME);
+  if (kernel == CPUINFO_KERNEL_BITSET_SCAN)
+	fill_random(buffer, buffer_size);
+
+  return n_bytes / elapsed * 1e-9;
+}
+
+// Check copy METHOD of variant CVP against memcpy() and memset(), returns the number of mismatches
+static int check_copy(const cpuinfo_copy_variant_t *cvp, int method)
+{
+  int i, errors = 0;
+  for (i = 0; i < N_CHECKS; i++) {
+	size_t src_offset = rand() % 64;
+	size_t dst_offset = rand() % 64;
+	size_t size = rand() % (MAX_CHECK_SIZE - 64);
+	uint8_t *dst = copy_buffer + dst_offset;
+	size_t j;
+
+	// bytes around the destination must be preserved
+	memset(copy_buffer, 0xee, MAX_CHECK_SIZE + 64);
+	cvp->copy[method](dst, buffer + src_offset, size);
+	if (memcmp(dst, buffer + src_offset, size) != 0)
+	  errors++;
+	for (j = 0; j < MAX_CHECK_SIZE + 64; j++) {
+	  if ((j < dst_offset || j >= dst_offset + size) && copy_buffer[j] != 0xee) {
+		errors++;
+		break;
+	  }
+	}
+
+	int c = rand() & 0xff;
+	memset(copy_buffer, 0xee, MAX_CHECK_SIZE + 64);
+	cvp->set[method](dst, c, size);
+	for (j = 0; j < MAX_CHECK_SIZE + 64; j++) {
+	  int expected = j < dst_offset || j >= dst_offset + size ? 0xee : c;
+	  if (copy_buffer[j] != expected) {
+		errors++;
+		break;
+	  }
+	}
+  }
+  return errors;
+}
+
+// Returns the throughput of copy METHOD of variant CVP in GB/s, for copies or fills
+static double bench_copy(const cpuinfo_copy_variant_t *cvp, int method, int fill)
+{
+  double start = get_time(), elapsed;
+  uint64_t n_bytes = 0;
+  do {
+	int i;
+	for (i = 0; i < 16; i++) {
+	  if (fill)
+		cvp->set[method](copy_buffer, i, buffer_size);
+	  else
+		cvp->copy[method](copy_buffer, buffer, buffer_size);
+	  n_bytes += buffer_size;
+	}
+  } while ((elapsed = get_time() - start) < BENCH_TIME);
+  return n_bytes / elapsed * 1e-9;
+}
+
+static void print_threshold(const char *name, size_t size)
+{
+  if (size == CPUINFO_COPY_NEVER)
+	printf(", %s never", name);
+  else if (size >= 1024 * 1024)
+	printf(", %s from %lu MB", name, (unsigned long)(size >> 20));
+  else if (size >= 1024)
+	printf(", %s from %lu KB", name, (unsigned long)(size >> 10));
+  else
+	printf(", %s from %lu bytes", name, (unsigned long)size);
+}
+
+static void print_copy_strategy(const cpuinfo_copy_strategy_t *sp)
+{
+  printf("copy strategy (%s): %s", sp->measured ? "measured" : "estimated", sp->variant);
+  print_threshold("vector", sp->vector_threshold);
+  print_threshold("rep_movsb", sp->rep_movsb_threshold);
+  print_threshold("nontemporal", sp->nontemporal_threshold);
+  printf("\n");
+}
+
+// Check the public entry points against known results
+static int check_functions(void)
+{
+  int errors = 0;
+  if (cpuinfo_crc32c(0, "123456789", 9) != 0xe3069283)
+	errors++;
+
+  // one byte at a time must give the same CRC as the whole buffer
+  uint32_t crc = 0;
+  size_t i;
+  for (i = 0; i < 1000; i++)
+	crc = cpuinfo_crc32c(crc, buffer + i, 1);
+  if (crc != cpuinfo_crc32c(0, buffer, 1000))
+	errors++;
+
+  uint64_t bits[16];
+  memset(bits, 0, sizeof(bits));
+  bits[3] = 0x10;
+  bits[9] = 0x8000000000000001ULL;
+  bits[15] = ~0ULL;
+  // bits beyond N_BITS are ignored
+  static const size_t expected[][3] = {
+	{ 1000, 0, 196 }, { 1000, 196, 196 }, { 1000, 197, 576 }, { 1000, 577, 639 },
+	{ 1000, 640, 960 }, { 1000, 999, 999 }, { 1000, 1000, 1000 }, { 950, 640, 950 }
+  };
+  for (i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+	if (cpuinfo_bitset_find_first(bits, expected[i][0], expected[i][1]) != expected[i][2])
+	  errors++;
+  }
+
+  // one copy and fill of each size class
+  size_t size;
+  for (size = 1; size <= buffer_size; size *= 4) {
+	memset(copy_buffer, 0, size);
+	if (cpuinfo_memcpy(copy_buffer, buffer, size) != copy_buffer || memcmp(copy_buffer, buffer, size) != 0)
+	  errors++;
+	cpuinfo_memset(copy_buffer, 0x55, size);
+	if (copy_buffer[0] != 0x55 || copy_buffer[size - 1] != 0x55)
+	  errors++;
+  }
+  return errors;
+}
+
+// Check variants needing AMX tile data are only selected once Linux permits it,
+// this must run before anything in the process requests the permission
+static int check_dispatch(cpuinfo_t *cip)
+{
+  static const cpuinfo_dispatch_variant_t variants[] = {
+	{ "scalar",		0,	{ 0 } },
+	{ "amx",		1,	{ CPUINFO_FEATURE_X86_AMX_TILE, 0 } },
+	{ NULL }
+  };
+  cpuinfo_dispatch_t dispatch = { "amx", variants, NULL };
+
+  int errors = 0;
+  if (cpuinfo_dispatch_resolve(cip, &dispatch) != 0)
+	errors++;
+  dispatch.selected = NULL;
+  int expected = cpuinfo_request_tile_permission(cip) ? 1 : 0;
+  if (cpuinfo_dispatch_resolve(cip, &dispatch) != expected)
+	errors++;
+  return errors;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) {
+	char *end;
+	buffer_size = strtoul(argv[1], &end, 0);
+	if (*end == 'K' || *end == 'k')
+	  buffer_size *= 1024;
+	else if (*end == 'M' || *end == 'm')
+	  buffer_size *= 1024 * 1024;
+	if (buffer_size < 64) {
+	  fprintf(stderr, "usage: %s [BUFFER_SIZE]\n", argv[0]);
+	  return 1;
+	}
+	buffer_size &= ~(size_t)63;
+  }
+
+  size_t alloc_size = buffer_size > MAX_CHECK_SIZE ? buffer_size : MAX_CHECK_SIZE;
+  if ((buffer = malloc(alloc_size)) == NULL) {
+	fprintf(stderr, "ERROR: could not allocate %lu bytes\n", (unsigned long)alloc_size);
+	return 1;
+  }
+  fill_random(buffer, alloc_size);
+  if ((copy_buffer = malloc(alloc_size + 64)) == NULL) {
+	fprintf(stderr, "ERROR: could not allocate %lu bytes\n", (unsigned long)alloc_size + 64);
+	return 1;
+  }
+
+  cpuinfo_t *cip = cpuinfo_new();
+  if (cip == NULL) {
+	fprintf(stderr, "ERROR: could not allocate cpuinfo descriptor\n");
+	return 1;
+  }
+
+  int kernel, errors = 0;
+  if (check_dispatch(cip) != 0) {
+	printf("ERROR: dispatch selected a variant that is not usable\n");
+	errors++;
+  }
+
+  for (kernel = 0; kernel < CPUINFO_KERNEL_MAX; kernel++) {
+	cpuinfo_dispatch_t *dp = cpuinfo_kernel_get_dispatch(kernel);
+	const cpuinfo_dispatch_variant_t *ref = get_reference(dp);
+	if (kernel == CPUINFO_KERNEL_COPY)
+	  cpuinfo_get_copy_strategy();
+	else
+	  cpuinfo_dispatch_resolve(cip, dp);
+	const char *selected = cpuinfo_dispatch_get_variant(dp);
+	printf("%s:\n", cpuinfo_string_of_kernel(kernel));
+
+	const cpuinfo_dispatch_variant_t *vp;
+	for (vp = dp->variants; vp->name != NULL; vp++) {
+	  printf("  %-16s", vp->name);
+	  if (!cpuinfo_dispatch_is_usable(cip, vp)) {
+		printf(" not usable\n");
+		continue;
+	  }
+	  if (kernel == CPUINFO_KERNEL_COPY) {
+		// the copy strategy picks the method, check and time all of them
+		const cpuinfo_copy_variant_t *cvp = vp->table;
+		int method;
+		printf("%s\n", selected && strcmp(vp->name, selected) == 0 ? " (selected)" : "");
+		for (method = 0; method < CPUINFO_COPY_MAX; method++) {
+		  if (cvp->copy[method] == NULL)
+			continue;
+		  printf("    %-14s", cpuinfo_string_of_copy_method(method));
+		  int n_errors = check_copy(cvp, method);
+		  if (n_errors) {
+			printf(" FAILED (%d mismatches)\n", n_errors);
+			errors += n_errors;
+			continue;
+		  }
+		  printf(" %8.2f GB/s copy, %8.2f GB/s fill\n", bench_copy(cvp, method, 0), bench_copy(cvp, method, 1));
+		}
+		continue;
+	  }
+	  int n_errors = vp == ref ? 0 : check_variant(kernel, vp, ref);
+	  if (n_errors) {
+		printf(" FAILED (%d mismatches)\n", n_errors);
+		errors += n_errors;
+		continue;
+	  }
+	  printf(" %8.2f GB/s%s\n", bench_variant(kernel, vp), selected && strcmp(vp->name, selected) == 0 ? " (selected)" : "");
+	}
+  }
+
+  print_copy_strategy(cpuinfo_get_copy_strategy());
+  print_copy_strategy(cpuinfo_measure_copy_strategy());
+
+  if (check_functions() != 0) {
+	printf("ERROR: public functions returned wrong results\n");
+	errors++;
+  }
+
+  cpuinfo_destroy(cip);
+  free(buffer);
+  free(copy_buffer);
+  return errors ? 1 : 0;
+}
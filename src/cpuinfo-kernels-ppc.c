@@ -0,0 +1,55 @@
+/*
+ *  cpuinfo-kernels-ppc.c - Dispatched primitives, PowerPC variants
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include "sysdeps.h"
+#include "cpuinfo-kernels.h"
+#include "cpuinfo-kernels-private.h"
+
+#ifdef HAVE_PPC_POPCNTB_ATTRIBUTE
+
+// Count the bits set in each byte of V
+__attribute__((target("popcntb")))
+static inline unsigned long popcntb(unsigned long v)
+{
+  unsigned long r;
+  __asm__ ("popcntb %0,%1" : "=r" (r) : "r" (v));
+  return r;
+}
+
+__attribute__((target("popcntb")))
+uint64_t cpuinfo_popcount_popcntb(const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  uint64_t count = 0;
+
+  // byte counts are at most 8, sum them with a multiply
+  unsigned long v;
+  const unsigned long ones = ~0UL / 0xff;
+  for (; size >= sizeof(v); p += sizeof(v), size -= sizeof(v)) {
+	memcpy(&v, p, sizeof(v));
+	count += (popcntb(v) * ones) >> (8 * (sizeof(v) - 1));
+  }
+  while (size--)
+	count += popcntb(*p++);
+  return count;
+}
+
+#endif
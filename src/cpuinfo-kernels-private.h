@@ -0,0 +1,49 @@
+/*
+ *  cpuinfo-kernels-private.h - Private interface to kernel variants
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef CPUINFO_KERNELS_PRIVATE_H
+#define CPUINFO_KERNELS_PRIVATE_H
+
+// Copy routines of a variant, indexed by copy method (NULL if unsupported)
+typedef void *(*cpuinfo_copy_func_t)(void *dst, const void *src, size_t size);
+typedef void *(*cpuinfo_set_func_t)(void *dst, int c, size_t size);
+
+typedef struct {
+  int vector_width;
+  cpuinfo_copy_func_t copy[CPUINFO_COPY_MAX];
+  cpuinfo_set_func_t set[CPUINFO_COPY_MAX];
+} cpuinfo_copy_variant_t;
+
+// Processor specific variants, used only if the processor supports them
+extern uint32_t cpuinfo_crc32c_sse42(uint32_t crc, const void *buf, size_t size) attribute_hidden;
+extern uint32_t cpuinfo_crc32c_pclmul(uint32_t crc, const void *buf, size_t size) attribute_hidden;
+extern uint32_t cpuinfo_crc32c_avx512(uint32_t crc, const void *buf, size_t size) attribute_hidden;
+extern uint64_t cpuinfo_popcount_popcnt(const void *buf, size_t size) attribute_hidden;
+extern uint64_t cpuinfo_popcount_avx2(const void *buf, size_t size) attribute_hidden;
+extern uint64_t cpuinfo_popcount_avx512(const void *buf, size_t size) attribute_hidden;
+extern uint64_t cpuinfo_popcount_popcntb(const void *buf, size_t size) attribute_hidden;
+extern size_t cpuinfo_bitset_scan_avx2(const uint64_t *words, size_t n_words) attribute_hidden;
+extern size_t cpuinfo_bitset_scan_avx512(const uint64_t *words, size_t n_words) attribute_hidden;
+extern const cpuinfo_copy_variant_t cpuinfo_copy_sse2 attribute_hidden;
+extern const cpuinfo_copy_variant_t cpuinfo_copy_avx attribute_hidden;
+extern const cpuinfo_copy_variant_t cpuinfo_copy_avx512 attribute_hidden;
+
+#endif /* CPUINFO_KERNELS_PRIVATE_H */
@@ -0,0 +1,435 @@
+/*
+ *  cpuinfo-kernels-x86.c - Dispatched primitives, x86 variants
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include "sysdeps.h"
+#include "cpuinfo-kernels.h"
+#include "cpuinfo-kernels-private.h"
+
+#ifdef HAVE_X86_INTRINSICS
+#include <immintrin.h>
+
+#if defined __x86_64__
+#define popcnt_word(v)		_mm_popcnt_u64(v)
+typedef uint64_t word_t;
+#else
+#define popcnt_word(v)		_mm_popcnt_u32(v)
+typedef uint32_t word_t;
+#endif
+
+// CRC-32C folding constants (x^(D+31) mod P and x^(D-33) mod P, bit-reflected)
+#define CRC32C_FOLD_128_LO	0xf20c0dfe
+#define CRC32C_FOLD_128_HI	0x493c7d27
+#define CRC32C_FOLD_512_LO	0x740eef02
+#define CRC32C_FOLD_512_HI	0x9e4addf8
+#define CRC32C_FOLD_2048_LO	0xdcb17aa4
+#define CRC32C_FOLD_2048_HI	0xb9e02b86
+
+/* ========================================================================= */
+/* == CRC-32C                                                             == */
+/* ========================================================================= */
+
+__attribute__((target("sse4.2")))
+static inline uint32_t crc32c_update(uint32_t crc, const uint8_t *p, size_t size)
+{
+  word_t v;
+  for (; size >= sizeof(v); p += sizeof(v), size -= sizeof(v)) {
+	memcpy(&v, p, sizeof(v));
+#if defined __x86_64__
+	crc = _mm_crc32_u64(crc, v);
+#else
+	crc = _mm_crc32_u32(crc, v);
+#endif
+  }
+  while (size--)
+	crc = _mm_crc32_u8(crc, *p++);
+  return crc;
+}
+
+// Reduce the 128-bit remainder X to a CRC
+__attribute__((target("sse4.2")))
+static inline uint32_t crc32c_reduce(__m128i x)
+{
+  uint32_t v[4];
+  _mm_storeu_si128((__m128i *)v, x);
+  uint32_t crc = 0;
+  crc = _mm_crc32_u32(crc, v[0]);
+  crc = _mm_crc32_u32(crc, v[1]);
+  crc = _mm_crc32_u32(crc, v[2]);
+  crc = _mm_crc32_u32(crc, v[3]);
+  return crc;
+}
+
+// Fold X forward onto NEXT, K holds the constants for the distance
+__attribute__((target("sse4.2,pclmul")))
+static inline __m128i crc32c_fold(__m128i x, __m128i k, __m128i next)
+{
+  __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+  __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+// Fold the 128-bit remainder X over the remaining 16-byte blocks of P
+__attribute__((target("sse4.2,pclmul")))
+static inline __m128i crc32c_fold_blocks(__m128i x, const uint8_t **pp, size_t *psize)
+{
+  const __m128i k128 = _mm_set_epi64x(CRC32C_FOLD_128_HI, CRC32C_FOLD_128_LO);
+  for (; *psize >= 16; *pp += 16, *psize -= 16)
+	x = crc32c_fold(x, k128, _mm_loadu_si128((const __m128i *)*pp));
+  return x;
+}
+
+__attribute__((target("sse4.2")))
+uint32_t cpuinfo_crc32c_sse42(uint32_t crc, const void *buf, size_t size)
+{
+  return ~crc32c_update(~crc, buf, size);
+}
+
+__attribute__((target("sse4.2,pclmul")))
+uint32_t cpuinfo_crc32c_pclmul(uint32_t crc, const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  crc = ~crc;
+
+  // four streams of 16 bytes, each folded 64 bytes forward
+  if (size >= 128) {
+	const __m128i k128 = _mm_set_epi64x(CRC32C_FOLD_128_HI, CRC32C_FOLD_128_LO);
+	const __m128i k512 = _mm_set_epi64x(CRC32C_FOLD_512_HI, CRC32C_FOLD_512_LO);
+	__m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)p), _mm_cvtsi32_si128(crc));
+	__m128i x1 = _mm_loadu_si128((const __m128i *)(p + 16));
+	__m128i x2 = _mm_loadu_si128((const __m128i *)(p + 32));
+	__m128i x3 = _mm_loadu_si128((const __m128i *)(p + 48));
+	for (p += 64, size -= 64; size >= 64; p += 64, size -= 64) {
+	  x0 = crc32c_fold(x0, k512, _mm_loadu_si128((const __m128i *)p));
+	  x1 = crc32c_fold(x1, k512, _mm_loadu_si128((const __m128i *)(p + 16)));
+	  x2 = crc32c_fold(x2, k512, _mm_loadu_si128((const __m128i *)(p + 32)));
+	  x3 = crc32c_fold(x3, k512, _mm_loadu_si128((const __m128i *)(p + 48)));
+	}
+	x0 = crc32c_fold(x0, k128, x1);
+	x0 = crc32c_fold(x0, k128, x2);
+	x0 = crc32c_fold(x0, k128, x3);
+	crc = crc32c_reduce(crc32c_fold_blocks(x0, &p, &size));
+  }
+
+  return ~crc32c_update(crc, p, size);
+}
+
+#ifdef HAVE_X86_AVX512_INTRINSICS
+__attribute__((target("avx512f,vpclmulqdq,sse4.2,pclmul")))
+static inline __m512i crc32c_fold_512(__m512i x, __m512i k, __m512i next)
+{
+  __m512i lo = _mm512_clmulepi64_epi128(x, k, 0x00);
+  __m512i hi = _mm512_clmulepi64_epi128(x, k, 0x11);
+  return _mm512_xor_si512(_mm512_xor_si512(lo, hi), next);
+}
+
+__attribute__((target("avx512f,vpclmulqdq,sse4.2,pclmul")))
+uint32_t cpuinfo_crc32c_avx512(uint32_t crc, const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  crc = ~crc;
+
+  // sixteen streams of 16 bytes, each folded 256 bytes forward
+  if (size >= 512) {
+	const __m128i k128 = _mm_set_epi64x(CRC32C_FOLD_128_HI, CRC32C_FOLD_128_LO);
+	const __m512i k512 = _mm512_broadcast_i32x4(_mm_set_epi64x(CRC32C_FOLD_512_HI, CRC32C_FOLD_512_LO));
+	const __m512i k2048 = _mm512_broadcast_i32x4(_mm_set_epi64x(CRC32C_FOLD_2048_HI, CRC32C_FOLD_2048_LO));
+	__m512i z0 = _mm512_xor_si512(_mm512_loadu_si512(p), _mm512_maskz_mov_epi32(1, _mm512_set1_epi32(crc)));
+	__m512i z1 = _mm512_loadu_si512(p + 64);
+	__m512i z2 = _mm512_loadu_si512(p + 128);
+	__m512i z3 = _mm512_loadu_si512(p + 192);
+	for (p += 256, size -= 256; size >= 256; p += 256, size -= 256) {
+	  z0 = crc32c_fold_512(z0, k2048, _mm512_loadu_si512(p));
+	  z1 = crc32c_fold_512(z1, k2048, _mm512_loadu_si512(p + 64));
+	  z2 = crc32c_fold_512(z2, k2048, _mm512_loadu_si512(p + 128));
+	  z3 = crc32c_fold_512(z3, k2048, _mm512_loadu_si512(p + 192));
+	}
+	z0 = crc32c_fold_512(z0, k512, z1);
+	z0 = crc32c_fold_512(z0, k512, z2);
+	z0 = crc32c_fold_512(z0, k512, z3);
+	for (; size >= 64; p += 64, size -= 64)
+	  z0 = crc32c_fold_512(z0, k512, _mm512_loadu_si512(p));
+	__m128i x = _mm512_extracti32x4_epi32(z0, 0);
+	x = crc32c_fold(x, k128, _mm512_extracti32x4_epi32(z0, 1));
+	x = crc32c_fold(x, k128, _mm512_extracti32x4_epi32(z0, 2));
+	x = crc32c_fold(x, k128, _mm512_extracti32x4_epi32(z0, 3));
+	crc = crc32c_reduce(crc32c_fold_blocks(x, &p, &size));
+  }
+
+  return ~crc32c_update(crc, p, size);
+}
+#endif
+
+/* ========================================================================= */
+/* == Popcount                                                            == */
+/* ========================================================================= */
+
+__attribute__((target("popcnt")))
+static inline uint64_t popcount_update(uint64_t count, const uint8_t *p, size_t size)
+{
+  word_t v;
+  for (; size >= sizeof(v); p += sizeof(v), size -= sizeof(v)) {
+	memcpy(&v, p, sizeof(v));
+	count += popcnt_word(v);
+  }
+  while (size--)
+	count += _mm_popcnt_u32(*p++);
+  return count;
+}
+
+__attribute__((target("popcnt")))
+uint64_t cpuinfo_popcount_popcnt(const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  uint64_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+
+  // independent accumulators to overlap the popcnt latency
+  word_t v[4];
+  for (; size >= sizeof(v); p += sizeof(v), size -= sizeof(v)) {
+	memcpy(v, p, sizeof(v));
+	c0 += popcnt_word(v[0]);
+	c1 += popcnt_word(v[1]);
+	c2 += popcnt_word(v[2]);
+	c3 += popcnt_word(v[3]);
+  }
+  return popcount_update(c0 + c1 + c2 + c3, p, size);
+}
+
+__attribute__((target("avx2,popcnt")))
+uint64_t cpuinfo_popcount_avx2(const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+										  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0f);
+  __m256i total = _mm256_setzero_si256();
+
+  // count nibbles with a table lookup, bytes are summed before they overflow
+  while (size >= 32) {
+	__m256i acc = _mm256_setzero_si256();
+	int i;
+	for (i = 0; i < 31 && size >= 32; i++, p += 32, size -= 32) {
+	  __m256i v = _mm256_loadu_si256((const __m256i *)p);
+	  __m256i lo = _mm256_and_si256(v, low_mask);
+	  __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+	  acc = _mm256_add_epi8(acc, _mm256_shuffle_epi8(lookup, lo));
+	  acc = _mm256_add_epi8(acc, _mm256_shuffle_epi8(lookup, hi));
+	}
+	total = _mm256_add_epi64(total, _mm256_sad_epu8(acc, _mm256_setzero_si256()));
+  }
+
+  uint64_t sums[4];
+  _mm256_storeu_si256((__m256i *)sums, total);
+  return popcount_update(sums[0] + sums[1] + sums[2] + sums[3], p, size);
+}
+
+#ifdef HAVE_X86_AVX512_INTRINSICS
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+uint64_t cpuinfo_popcount_avx512(const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  __m512i total = _mm512_setzero_si512();
+  for (; size >= 64; p += 64, size -= 64)
+	total = _mm512_add_epi64(total, _mm512_popcnt_epi64(_mm512_loadu_si512(p)));
+  return popcount_update(_mm512_reduce_add_epi64(total), p, size);
+}
+#endif
+
+/* ========================================================================= */
+/* == Bitset Scan                                                         == */
+/* ========================================================================= */
+
+static inline size_t bitset_scan_update(const uint64_t *words, size_t i, size_t n_words)
+{
+  for (; i < n_words; i++) {
+	if (words[i])
+	  break;
+  }
+  return i;
+}
+
+__attribute__((target("avx2")))
+size_t cpuinfo_bitset_scan_avx2(const uint64_t *words, size_t n_words)
+{
+  size_t i;
+  for (i = 0; i + 8 <= n_words; i += 8) {
+	__m256i v0 = _mm256_loadu_si256((const __m256i *)(words + i));
+	__m256i v1 = _mm256_loadu_si256((const __m256i *)(words + i + 4));
+	__m256i v = _mm256_or_si256(v0, v1);
+	if (!_mm256_testz_si256(v, v))
+	  break;
+  }
+  return bitset_scan_update(words, i, n_words);
+}
+
+#ifdef HAVE_X86_AVX512_INTRINSICS
+__attribute__((target("avx512f")))
+size_t cpuinfo_bitset_scan_avx512(const uint64_t *words, size_t n_words)
+{
+  size_t i;
+  for (i = 0; i + 8 <= n_words; i += 8) {
+	__m512i v = _mm512_loadu_si512(words + i);
+	__mmask8 m = _mm512_test_epi64_mask(v, v);
+	if (m)
+	  return i + __builtin_ctz(m);
+  }
+  return bitset_scan_update(words, i, n_words);
+}
+#endif
+
+/* ========================================================================= */
+/* == Copy Routines                                                       == */
+/* ========================================================================= */
+
+// REP MOVSB / REP STOSB, fast with ERMS
+static void *copy_rep_movsb(void *dst, const void *src, size_t size)
+{
+  void *d = dst;
+  __asm__ __volatile__ ("rep movsb" : "+D" (d), "+S" (src), "+c" (size) : : "memory");
+  return dst;
+}
+
+static void *set_rep_stosb(void *dst, int c, size_t size)
+{
+  void *d = dst;
+  __asm__ __volatile__ ("rep stosb" : "+D" (d), "+c" (size) : "a" (c) : "memory");
+  return dst;
+}
+
+// Copy routines using vectors of type VEC_T. The last vector is stored
+// separately, it may overlap the previous ones. Non-temporal stores need
+// aligned destinations, the first vector is stored unaligned and the next
+// ones start from the following alignment boundary.
+#define DEFINE_COPY_VARIANT(NAME, TARGET, VEC_T, LOADU, STOREU, STREAM, SET1)	\
+__attribute__((target(TARGET)))													\
+static void *copy_vector_##NAME(void *dst, const void *src, size_t size)		\
+{																				\
+  const size_t V = sizeof(VEC_T);												\
+  uint8_t *d = dst;																\
+  const uint8_t *s = src;														\
+  if (size < V)																	\
+	return memcpy(dst, src, size);												\
+  VEC_T last = LOADU((const VEC_T *)(s + size - V));							\
+  for (; size > 4 * V; d += 4 * V, s += 4 * V, size -= 4 * V) {					\
+	VEC_T v0 = LOADU((const VEC_T *)s);											\
+	VEC_T v1 = LOADU((const VEC_T *)(s + V));									\
+	VEC_T v2 = LOADU((const VEC_T *)(s + 2 * V));								\
+	VEC_T v3 = LOADU((const VEC_T *)(s + 3 * V));								\
+	STOREU((VEC_T *)d, v0);														\
+	STOREU((VEC_T *)(d + V), v1);												\
+	STOREU((VEC_T *)(d + 2 * V), v2);											\
+	STOREU((VEC_T *)(d + 3 * V), v3);											\
+  }																				\
+  for (; size > V; d += V, s += V, size -= V)									\
+	STOREU((VEC_T *)d, LOADU((const VEC_T *)s));								\
+  STOREU((VEC_T *)(d + size - V), last);										\
+  return dst;																	\
+}																				\
+																				\
+__attribute__((target(TARGET)))													\
+static void *copy_nontemporal_##NAME(void *dst, const void *src, size_t size)	\
+{																				\
+  const size_t V = sizeof(VEC_T);												\
+  uint8_t *d = dst;																\
+  const uint8_t *s = src;														\
+  if (size < 4 * V)																\
+	return copy_vector_##NAME(dst, src, size);									\
+  VEC_T last = LOADU((const VEC_T *)(s + size - V));							\
+  STOREU((VEC_T *)d, LOADU((const VEC_T *)s));									\
+  size_t skew = V - ((uintptr_t)d & (V - 1));									\
+  d += skew, s += skew, size -= skew;											\
+  for (; size >= 4 * V; d += 4 * V, s += 4 * V, size -= 4 * V) {				\
+	VEC_T v0 = LOADU((const VEC_T *)s);											\
+	VEC_T v1 = LOADU((const VEC_T *)(s + V));									\
+	VEC_T v2 = LOADU((const VEC_T *)(s + 2 * V));								\
+	VEC_T v3 = LOADU((const VEC_T *)(s + 3 * V));								\
+	STREAM((VEC_T *)d, v0);														\
+	STREAM((VEC_T *)(d + V), v1);												\
+	STREAM((VEC_T *)(d + 2 * V), v2);											\
+	STREAM((VEC_T *)(d + 3 * V), v3);											\
+  }																				\
+  for (; size >= V; d += V, s += V, size -= V)									\
+	STREAM((VEC_T *)d, LOADU((const VEC_T *)s));								\
+  _mm_sfence();																	\
+  STOREU((VEC_T *)(d + size - V), last);										\
+  return dst;																	\
+}																				\
+																				\
+__attribute__((target(TARGET)))													\
+static void *set_vector_##NAME(void *dst, int c, size_t size)					\
+{																				\
+  const size_t V = sizeof(VEC_T);												\
+  uint8_t *d = dst;																\
+  if (size < V)																	\
+	return memset(dst, c, size);												\
+  VEC_T v = SET1(c);															\
+  for (; size > 4 * V; d += 4 * V, size -= 4 * V) {								\
+	STOREU((VEC_T *)d, v);														\
+	STOREU((VEC_T *)(d + V), v);												\
+	STOREU((VEC_T *)(d + 2 * V), v);											\
+	STOREU((VEC_T *)(d + 3 * V), v);											\
+  }																				\
+  for (; size > V; d += V, size -= V)											\
+	STOREU((VEC_T *)d, v);														\
+  STOREU((VEC_T *)(d + size - V), v);											\
+  return dst;																	\
+}																				\
+																				\
+__attribute__((target(TARGET)))													\
+static void *set_nontemporal_##NAME(void *dst, int c, size_t size)				\
+{																				\
+  const size_t V = sizeof(VEC_T);												\
+  uint8_t *d = dst;																\
+  if (size < 4 * V)																\
+	return set_vector_##NAME(dst, c, size);										\
+  VEC_T v = SET1(c);															\
+  STOREU((VEC_T *)d, v);														\
+  STOREU((VEC_T *)(d + size - V), v);											\
+  size_t skew = V - ((uintptr_t)d & (V - 1));									\
+  d += skew, size -= skew;														\
+  for (; size >= 4 * V; d += 4 * V, size -= 4 * V) {							\
+	STREAM((VEC_T *)d, v);														\
+	STREAM((VEC_T *)(d + V), v);												\
+	STREAM((VEC_T *)(d + 2 * V), v);											\
+	STREAM((VEC_T *)(d + 3 * V), v);											\
+  }																				\
+  for (; size >= V; d += V, size -= V)											\
+	STREAM((VEC_T *)d, v);														\
+  _mm_sfence();																	\
+  return dst;																	\
+}																				\
+																				\
+const cpuinfo_copy_variant_t cpuinfo_copy_##NAME = {							\
+  sizeof(VEC_T) * 8,															\
+  { memcpy, copy_vector_##NAME, copy_rep_movsb, copy_nontemporal_##NAME },		\
+  { memset, set_vector_##NAME, set_rep_stosb, set_nontemporal_##NAME }			\
+};
+
+#define mm_set1_epi8(c)		_mm_set1_epi8((char)(c))
+#define mm256_set1_epi8(c)	_mm256_set1_epi8((char)(c))
+#define mm512_set1_epi8(c)	_mm512_set1_epi8((char)(c))
+
+DEFINE_COPY_VARIANT(sse2, "sse2", __m128i, _mm_loadu_si128, _mm_storeu_si128, _mm_stream_si128, mm_set1_epi8)
+DEFINE_COPY_VARIANT(avx, "avx", __m256i, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_stream_si256, mm256_set1_epi8)
+#ifdef HAVE_X86_AVX512_INTRINSICS
+DEFINE_COPY_VARIANT(avx512, "avx512f", __m512i, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_stream_si512, mm512_set1_epi8)
+#endif
+
+#endif
@@ -0,0 +1,594 @@
+/*
+ *  cpuinfo-kernels.c - Dispatched primitives
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "sysdeps.h"
+#include <sys/time.h>
+#include "cpuinfo-kernels.h"
+#include "cpuinfo-kernels-private.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+/* ========================================================================= */
+/* == Scalar Variants                                                     == */
+/* ========================================================================= */
+
+// CRC-32C of each byte value, reflected polynomial 0x82f63b78
+static const uint32_t crc32c_table[256] = {
+  0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c,
+  0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+  0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24, 0x105ec76f, 0xe235446c,
+  0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+  0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+  0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+  0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35, 0xaa64d611, 0x580f5512,
+  0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+  0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad,
+  0x1642ae59, 0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+  0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc, 0xb3109ebf,
+  0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+  0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f,
+  0xed03a29b, 0x1f682198, 0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+  0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+  0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+  0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e,
+  0x4767748a, 0xb50cf789, 0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859,
+  0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e,
+  0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+  0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de,
+  0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+  0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93, 0x082f63b7, 0xfa44e0b4,
+  0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+  0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+  0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c,
+  0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033, 0xa24bb5a6, 0x502036a5,
+  0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+  0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975,
+  0x0e330a81, 0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+  0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06, 0xcaa7a905,
+  0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+  0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8,
+  0xe52cc12c, 0x1747422f, 0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+  0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+  0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+  0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78,
+  0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee,
+  0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6,
+  0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+  0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69,
+  0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+  0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+};
+
+static uint32_t crc32c_c(uint32_t crc, const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  crc = ~crc;
+  while (size--)
+	crc = crc32c_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+  return ~crc;
+}
+
+static inline uint64_t popcount64(uint64_t v)
+{
+  v = v - ((v >> 1) & 0x5555555555555555ULL);
+  v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+  v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return (v * 0x0101010101010101ULL) >> 56;
+}
+
+static uint64_t popcount_c(const void *buf, size_t size)
+{
+  const uint8_t *p = buf;
+  uint64_t v, count = 0;
+  for (; size >= 8; p += 8, size -= 8) {
+	memcpy(&v, p, 8);
+	count += popcount64(v);
+  }
+  while (size--)
+	count += popcount64(*p++);
+  return count;
+}
+
+static size_t bitset_scan_c(const uint64_t *words, size_t n_words)
+{
+  size_t i;
+  for (i = 0; i < n_words; i++) {
+	if (words[i])
+	  break;
+  }
+  return i;
+}
+
+static const cpuinfo_copy_variant_t copy_c = {
+  0,
+  { memcpy },
+  { memset }
+};
+
+/* ========================================================================= */
+/* == Dispatch                                                            == */
+/* ========================================================================= */
+
+static const cpuinfo_dispatch_variant_t crc32c_variants[] = {
+#ifdef HAVE_X86_AVX512_INTRINSICS
+  { "avx512",	40,	{ CPUINFO_FEATURE_X86_AVX512F, CPUINFO_FEATURE_X86_VPCLMULQDQ,
+					  CPUINFO_FEATURE_X86_SSE4_2, CPUINFO_FEATURE_X86_PCLMULQDQ },
+	(cpuinfo_function_t)cpuinfo_crc32c_avx512 },
+#endif
+#ifdef HAVE_X86_INTRINSICS
+  { "pclmul",	30,	{ CPUINFO_FEATURE_X86_SSE4_2, CPUINFO_FEATURE_X86_PCLMULQDQ },
+	(cpuinfo_function_t)cpuinfo_crc32c_pclmul },
+  { "sse4.2",	20,	{ CPUINFO_FEATURE_X86_SSE4_2 },
+	(cpuinfo_function_t)cpuinfo_crc32c_sse42 },
+#endif
+  { "c",		0,	{ 0 },
+	(cpuinfo_function_t)crc32c_c },
+  { NULL }
+};
+
+static const cpuinfo_dispatch_variant_t popcount_variants[] = {
+#ifdef HAVE_X86_AVX512_INTRINSICS
+  { "avx512vpopcntdq", 40, { CPUINFO_FEATURE_X86_AVX512F, CPUINFO_FEATURE_X86_AVX512VPOPCNTDQ,
+							 CPUINFO_FEATURE_X86_POPCNT },
+	(cpuinfo_function_t)cpuinfo_popcount_avx512 },
+#endif
+#ifdef HAVE_X86_INTRINSICS
+  { "avx2",		30,	{ CPUINFO_FEATURE_X86_AVX2, CPUINFO_FEATURE_X86_POPCNT },
+	(cpuinfo_function_t)cpuinfo_popcount_avx2 },
+  { "popcnt",	20,	{ CPUINFO_FEATURE_X86_POPCNT },
+	(cpuinfo_function_t)cpuinfo_popcount_popcnt },
+#endif
+#ifdef HAVE_PPC_POPCNTB_ATTRIBUTE
+  { "popcntb",	20,	{ CPUINFO_FEATURE_PPC_POPCNTB },
+	(cpuinfo_function_t)cpuinfo_popcount_popcntb },
+#endif
+  { "c",		0,	{ 0 },
+	(cpuinfo_function_t)popcount_c },
+  { NULL }
+};
+
+static const cpuinfo_dispatch_variant_t bitset_scan_variants[] = {
+#ifdef HAVE_X86_AVX512_INTRINSICS
+  { "avx512",	40,	{ CPUINFO_FEATURE_X86_AVX512F },
+	(cpuinfo_function_t)cpuinfo_bitset_scan_avx512 },
+#endif
+#ifdef HAVE_X86_INTRINSICS
+  { "avx2",		30,	{ CPUINFO_FEATURE_X86_AVX2 },
+	(cpuinfo_function_t)cpuinfo_bitset_scan_avx2 },
+#endif
+  { "c",		0,	{ 0 },
+	(cpuinfo_function_t)bitset_scan_c },
+  { NULL }
+};
+
+// Copy routines are selected with the copy strategy, see init_copy_strategy()
+static const cpuinfo_dispatch_variant_t copy_variants[] = {
+#ifdef HAVE_X86_AVX512_INTRINSICS
+  { "avx512",	40,	{ CPUINFO_FEATURE_X86_AVX512F },
+	NULL, &cpuinfo_copy_avx512 },
+#endif
+#ifdef HAVE_X86_INTRINSICS
+  { "avx",		30,	{ CPUINFO_FEATURE_X86_AVX },
+	NULL, &cpuinfo_copy_avx },
+  { "sse2",		20,	{ CPUINFO_FEATURE_X86_SSE2 },
+	NULL, &cpuinfo_copy_sse2 },
+#endif
+  { "c",		0,	{ 0 },
+	NULL, &copy_c },
+  { NULL }
+};
+
+static cpuinfo_dispatch_t kernels[CPUINFO_KERNEL_MAX] = {
+  { "crc32c",		crc32c_variants },
+  { "popcount",		popcount_variants },
+  { "bitset_scan",	bitset_scan_variants },
+  { "copy",			copy_variants },
+};
+
+// Returns the dispatcher of the kernel, e.g. to list its variants
+cpuinfo_dispatch_t *cpuinfo_kernel_get_dispatch(int kernel)
+{
+  if (kernel < 0 || kernel >= CPUINFO_KERNEL_MAX)
+	return NULL;
+  return &kernels[kernel];
+}
+
+// Update CRC-32C (Castagnoli) CRC with SIZE bytes of BUF
+uint32_t cpuinfo_crc32c(uint32_t crc, const void *buf, size_t size)
+{
+  static cpuinfo_crc32c_func_t crc32c = NULL;
+  if (crc32c == NULL)
+	crc32c = (cpuinfo_crc32c_func_t)cpuinfo_dispatch_get_function(NULL, &kernels[CPUINFO_KERNEL_CRC32C]);
+  return crc32c(crc, buf, size);
+}
+
+// Count the bits set in SIZE bytes of BUF
+uint64_t cpuinfo_popcount(const void *buf, size_t size)
+{
+  static cpuinfo_popcount_func_t popcount = NULL;
+  if (popcount == NULL)
+	popcount = (cpuinfo_popcount_func_t)cpuinfo_dispatch_get_function(NULL, &kernels[CPUINFO_KERNEL_POPCOUNT]);
+  return popcount(buf, size);
+}
+
+static inline int ctz64(uint64_t v)
+{
+#if defined __GNUC__
+  return __builtin_ctzll(v);
+#else
+  int n = 0;
+  while ((v & 1) == 0) {
+	v >>= 1;
+	n++;
+  }
+  return n;
+#endif
+}
+
+// Find the first bit set in BITS, from bit START up to N_BITS
+size_t cpuinfo_bitset_find_first(const uint64_t *bits, size_t n_bits, size_t start)
+{
+  static cpuinfo_bitset_scan_func_t bitset_scan = NULL;
+  if (bitset_scan == NULL)
+	bitset_scan = (cpuinfo_bitset_scan_func_t)cpuinfo_dispatch_get_function(NULL, &kernels[CPUINFO_KERNEL_BITSET_SCAN]);
+
+  if (start >= n_bits)
+	return n_bits;
+
+  // the first word may be partial, the scan covers the whole words that follow
+  size_t n_words = (n_bits + 63) / 64;
+  size_t i = start / 64;
+  uint64_t word = bits[i] & (~0ULL << (start % 64));
+  if (word == 0) {
+	i += 1 + bitset_scan(bits + i + 1, n_words - i - 1);
+	if (i >= n_words)
+	  return n_bits;
+	word = bits[i];
+  }
+  size_t bit = i * 64 + ctz64(word);
+  return bit < n_bits ? bit : n_bits;
+}
+
+/* ========================================================================= */
+/* == Copy Strategy                                                       == */
+/* ========================================================================= */
+
+#define COPY_NEVER				CPUINFO_COPY_NEVER
+
+// Measurements time copies of up to 32 MB, repeated for at least 1 ms
+#define MEASURE_MAX_SIZE		(32 << 20)
+#define MEASURE_MAX_VICTIM_SIZE	(8 << 20)
+#define MEASURE_MIN_TIME		1e-3
+#define MEASURE_TRIALS			5
+
+static cpuinfo_copy_strategy_t copy_strategy;
+static const cpuinfo_copy_variant_t *copy_variant;
+
+// Descriptor of the current processor
+static cpuinfo_t *get_cpuinfo(void)
+{
+  static cpuinfo_t *cip = NULL; // XXX use a lock!
+  if (cip == NULL)
+	cip = cpuinfo_new();
+  return cip;
+}
+
+static int has_usable_feature(cpuinfo_t *cip, int feature)
+{
+  return (cpuinfo_get_feature_status(cip, feature) & CPUINFO_FEATURE_STATUS_USABLE) != 0;
+}
+
+// Size of the last-level cache share of a logical processor, in bytes (0 if unknown)
+static size_t get_llc_share(cpuinfo_t *cip)
+{
+  const cpuinfo_cache_t *ccp = cpuinfo_get_caches(cip);
+  if (ccp == NULL)
+	return 0;
+
+  int i;
+  const cpuinfo_cache_descriptor_t *llc = NULL;
+  for (i = 0; i < ccp->count; i++) {
+	const cpuinfo_cache_descriptor_t *cdp = &ccp->descriptors[i];
+	if (cdp->type != CPUINFO_CACHE_TYPE_DATA && cdp->type != CPUINFO_CACHE_TYPE_UNIFIED)
+	  continue;
+	if (llc == NULL || cdp->level > llc->level)
+	  llc = cdp;
+  }
+  if (llc == NULL)
+	return 0;
+
+  int sharing = llc->sharing;
+  if (sharing <= 0) {
+	const cpuinfo_core_complexes_t *ccxp = cpuinfo_get_core_complexes(cip);
+	if (ccxp && ccxp->count > 0)
+	  sharing = ccxp->complexes[0].n_cpus;
+  }
+  if (sharing <= 0)
+	sharing = 1;
+  return (size_t)llc->size * 1024 / sharing;
+}
+
+static void init_copy_strategy(void)
+{
+  static int initialized = 0; // XXX use a lock!
+  if (initialized)
+	return;
+
+  cpuinfo_t *cip = get_cpuinfo();
+  const cpuinfo_uarch_info_t *uip = cip ? cpuinfo_get_uarch_info(cip) : NULL;
+  int slow_insns = uip ? uip->slow_insns : 0;
+
+  // widest usable variant, unless the processor is tuned for narrower vectors
+  cpuinfo_dispatch_t *dp = &kernels[CPUINFO_KERNEL_COPY];
+  const cpuinfo_dispatch_variant_t *vp, *selected = NULL;
+  for (vp = dp->variants; vp->name != NULL; vp++) {
+	const cpuinfo_copy_variant_t *cvp = vp->table;
+	if (uip && uip->preferred_vector_width > 0 && cvp->vector_width > uip->preferred_vector_width)
+	  continue;
+	if (selected && vp->priority <= selected->priority)
+	  continue;
+	if (cpuinfo_dispatch_is_usable(cip, vp))
+	  selected = vp;
+  }
+  dp->selected = selected;
+  copy_variant = selected->table;
+
+  cpuinfo_copy_strategy_t *sp = &copy_strategy;
+  sp->variant = selected->name;
+  sp->vector_width = copy_variant->vector_width;
+  sp->vector_threshold = COPY_NEVER;
+  sp->rep_movsb_threshold = COPY_NEVER;
+  sp->nontemporal_threshold = COPY_NEVER;
+  sp->measured = 0;
+
+  // library routines handle short sizes best, vector loops take over from 8 vectors
+  if (copy_variant->copy[CPUINFO_COPY_VECTOR])
+	sp->vector_threshold = 8 * (sp->vector_width / 8);
+
+  // REP MOVSB needs ERMS to compete with vector loops, its startup cost is
+  // amortized later for wider vectors unless FSRM makes it fast for short sizes
+  if (copy_variant->copy[CPUINFO_COPY_REP_MOVSB] && cip && has_usable_feature(cip, CPUINFO_FEATURE_X86_ERMS)) {
+	if (uip && uip->rep_movsb_threshold > 0)
+	  sp->rep_movsb_threshold = uip->rep_movsb_threshold;
+	else
+	  sp->rep_movsb_threshold = 2048 * (sp->vector_width / 128);
+	if (has_usable_feature(cip, CPUINFO_FEATURE_X86_FSRM) && (slow_insns & CPUINFO_SLOW_SHORT_REP_MOVSB) == 0) {
+	  if (sp->rep_movsb_threshold > 2048)
+		sp->rep_movsb_threshold = 2048;
+	}
+  }
+
+  // non-temporal stores once a copy would evict most of the processor's share of the LLC
+  if (copy_variant->copy[CPUINFO_COPY_NONTEMPORAL] && cip) {
+	size_t llc_share = get_llc_share(cip);
+	if (llc_share > 0)
+	  sp->nontemporal_threshold = llc_share / 4 * 3;
+  }
+
+  D(bug("copy strategy: %s, vector %lu, rep_movsb %lu, nontemporal %lu\n", sp->variant,
+		(unsigned long)sp->vector_threshold, (unsigned long)sp->rep_movsb_threshold,
+		(unsigned long)sp->nontemporal_threshold));
+  initialized = 1;
+}
+
+// Get the copy strategy estimated from the processor features and caches
+const cpuinfo_copy_strategy_t *cpuinfo_get_copy_strategy(void)
+{
+  init_copy_strategy();
+  return &copy_strategy;
+}
+
+static double get_time(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// Read a line of each 64 bytes of BUF
+static void touch_buffer(const uint8_t *buf, size_t size)
+{
+  volatile uint8_t sink = 0;
+  size_t i;
+  for (i = 0; i < size; i += 64)
+	sink += buf[i];
+}
+
+// Time one run copying SIZE bytes with FUNC, in seconds per copy. The VICTIM
+// buffer is read after each copy, as data the program keeps in the caches.
+static double time_copy_run(cpuinfo_copy_func_t func, void *dst, const void *src, size_t size,
+							const uint8_t *victim, size_t victim_size)
+{
+  int n = 0;
+  double start, elapsed;
+  touch_buffer(victim, victim_size);
+  start = get_time();
+  do {
+	func(dst, src, size);
+	touch_buffer(victim, victim_size);
+	n++;
+  } while ((elapsed = get_time() - start) < MEASURE_MIN_TIME);
+  return elapsed / n;
+}
+
+// Best times of FUNC1 and FUNC2 copying SIZE bytes, in seconds per copy and
+// including the reads of VICTIM. Runs alternate so that both see the same
+// frequency and background noise.
+static void time_copy_pair(cpuinfo_copy_func_t func1, double *time1,
+						   cpuinfo_copy_func_t func2, double *time2,
+						   void *dst, const void *src, size_t size,
+						   const uint8_t *victim, size_t victim_size)
+{
+  int i;
+  for (i = 0; i < MEASURE_TRIALS; i++) {
+	double t1 = time_copy_run(func1, dst, src, size, victim, victim_size);
+	double t2 = time_copy_run(func2, dst, src, size, victim, victim_size);
+	if (i == 0 || t1 < *time1)
+	  *time1 = t1;
+	if (i == 0 || t2 < *time2)
+	  *time2 = t2;
+  }
+}
+
+// Refine the copy strategy by timing copies on this processor
+const cpuinfo_copy_strategy_t *cpuinfo_measure_copy_strategy(void)
+{
+  init_copy_strategy();
+
+  cpuinfo_copy_strategy_t *sp = &copy_strategy;
+  const cpuinfo_copy_variant_t *cvp = copy_variant;
+  if (sp->measured)
+	return sp;
+
+  cpuinfo_t *cip = get_cpuinfo();
+  size_t victim_size = cip ? get_llc_share(cip) : 0;
+  if (victim_size > MEASURE_MAX_VICTIM_SIZE)
+	victim_size = MEASURE_MAX_VICTIM_SIZE;
+  uint8_t *src = malloc(MEASURE_MAX_SIZE);
+  uint8_t *dst = malloc(MEASURE_MAX_SIZE);
+  uint8_t *victim = victim_size ? malloc(victim_size) : NULL;
+  if (src == NULL || dst == NULL || (victim_size && victim == NULL)) {
+	free(src);
+	free(dst);
+	free(victim);
+	return sp;
+  }
+  memset(src, 0x5a, MEASURE_MAX_SIZE);
+  memset(dst, 0, MEASURE_MAX_SIZE);
+  if (victim)
+	memset(victim, 0, victim_size);
+
+  // REP MOVSB from the first size where it is as fast as vector loops
+  size_t size;
+  if (sp->rep_movsb_threshold != COPY_NEVER && sp->vector_threshold != COPY_NEVER) {
+	size_t threshold = COPY_NEVER;
+	for (size = 256; size <= 64 * 1024; size *= 2) {
+	  double rep_movsb_time, vector_time;
+	  time_copy_pair(cvp->copy[CPUINFO_COPY_REP_MOVSB], &rep_movsb_time,
+					 cvp->copy[CPUINFO_COPY_VECTOR], &vector_time,
+					 dst, src, size, NULL, 0);
+	  if (rep_movsb_time <= vector_time) {
+		threshold = size;
+		break;
+	  }
+	}
+	sp->rep_movsb_threshold = threshold;
+  }
+
+  // Non-temporal stores from the first size where copying and reading the
+  // cached data back is as fast as with regular stores, within 10%: copies
+  // no longer fit beside the data, or the stores save the memory reads. Sizes
+  // below the estimate whose source and destination still fit beside the data
+  // in the LLC share are not taken on timing noise alone.
+  if (sp->nontemporal_threshold != COPY_NEVER) {
+	size_t estimate = sp->nontemporal_threshold;
+	size_t llc_share = get_llc_share(cip);
+	size_t start = estimate / 4;
+	if (start > MEASURE_MAX_SIZE / 16)
+	  start = MEASURE_MAX_SIZE / 16;
+	if (start < 64 * 1024)
+	  start = 64 * 1024;
+	size_t threshold = COPY_NEVER;
+	for (size = start; size <= MEASURE_MAX_SIZE; size *= 2) {
+	  if (size < estimate && victim_size + 2 * size <= llc_share)
+		continue;
+	  int method = size >= sp->rep_movsb_threshold ? CPUINFO_COPY_REP_MOVSB : CPUINFO_COPY_VECTOR;
+	  double nontemporal_time, temporal_time;
+	  time_copy_pair(cvp->copy[CPUINFO_COPY_NONTEMPORAL], &nontemporal_time,
+					 cvp->copy[method], &temporal_time,
+					 dst, src, size, victim, victim_size);
+	  if (nontemporal_time <= temporal_time * 1.1) {
+		threshold = size;
+		break;
+	  }
+	}
+	// past the measured sizes, keep the estimate
+	if (threshold != COPY_NEVER)
+	  sp->nontemporal_threshold = threshold;
+	else if (sp->nontemporal_threshold <= MEASURE_MAX_SIZE)
+	  sp->nontemporal_threshold = 2 * MEASURE_MAX_SIZE;
+  }
+
+  D(bug("measured copy strategy: rep_movsb %lu, nontemporal %lu\n",
+		(unsigned long)sp->rep_movsb_threshold, (unsigned long)sp->nontemporal_threshold));
+  free(src);
+  free(dst);
+  free(victim);
+  sp->measured = 1;
+  return sp;
+}
+
+// Get the copy method used for SIZE bytes
+int cpuinfo_get_copy_method(size_t size)
+{
+  init_copy_strategy();
+
+  const cpuinfo_copy_strategy_t *sp = &copy_strategy;
+  const size_t thresholds[CPUINFO_COPY_MAX] = {
+	0, sp->vector_threshold, sp->rep_movsb_threshold, sp->nontemporal_threshold
+  };
+
+  // method of the highest threshold below SIZE, the latest one for equal thresholds
+  int i, method = CPUINFO_COPY_SCALAR;
+  for (i = 1; i < CPUINFO_COPY_MAX; i++) {
+	if (thresholds[i] <= size && thresholds[i] >= thresholds[method])
+	  method = i;
+  }
+  return method;
+}
+
+// Copy SIZE bytes following the copy strategy
+void *cpuinfo_memcpy(void *dst, const void *src, size_t size)
+{
+  int method = cpuinfo_get_copy_method(size);
+  return copy_variant->copy[method](dst, src, size);
+}
+
+// Fill SIZE bytes following the copy strategy
+void *cpuinfo_memset(void *dst, int c, size_t size)
+{
+  int method = cpuinfo_get_copy_method(size);
+  return copy_variant->set[method](dst, c, size);
+}
+
+const char *cpuinfo_string_of_kernel(int kernel)
+{
+  const char *str = "<unknown>";
+  switch (kernel) {
+  case CPUINFO_KERNEL_CRC32C:		str = "crc32c";			break;
+  case CPUINFO_KERNEL_POPCOUNT:		str = "popcount";		break;
+  case CPUINFO_KERNEL_BITSET_SCAN:	str = "bitset_scan";	break;
+  case CPUINFO_KERNEL_COPY:			str = "copy";			break;
+  }
+  return str;
+}
+
+const char *cpuinfo_string_of_copy_method(int method)
+{
+  const char *str = "<unknown>";
+  switch (method) {
+  case CPUINFO_COPY_SCALAR:			str = "scalar";			break;
+  case CPUINFO_COPY_VECTOR:			str = "vector";			break;
+  case CPUINFO_COPY_REP_MOVSB:		str = "rep_movsb";		break;
+  case CPUINFO_COPY_NONTEMPORAL:	str = "nontemporal";	break;
+  }
+  return str;
+}
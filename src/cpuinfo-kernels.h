@@ -0,0 +1,100 @@
+/*
+ *  cpuinfo-kernels.h - Dispatched primitives
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CPUINFO_KERNELS_H
+#define CPUINFO_KERNELS_H
+
+#include <stddef.h>
+#include "cpuinfo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Kernels, each dispatched to the best variant for the processor
+typedef enum {
+  CPUINFO_KERNEL_CRC32C,
+  CPUINFO_KERNEL_POPCOUNT,
+  CPUINFO_KERNEL_BITSET_SCAN,
+  CPUINFO_KERNEL_COPY,
+  CPUINFO_KERNEL_MAX
+} cpuinfo_kernel_t;
+
+// Kernel function types, shared by all variants of a kernel
+typedef uint32_t (*cpuinfo_crc32c_func_t)(uint32_t crc, const void *buf, size_t size);
+typedef uint64_t (*cpuinfo_popcount_func_t)(const void *buf, size_t size);
+typedef size_t (*cpuinfo_bitset_scan_func_t)(const uint64_t *words, size_t n_words);
+
+// Update CRC-32C (Castagnoli) CRC with SIZE bytes of BUF, the initial CRC is 0
+extern uint32_t cpuinfo_crc32c(uint32_t crc, const void *buf, size_t size);
+
+// Count the bits set in SIZE bytes of BUF
+extern uint64_t cpuinfo_popcount(const void *buf, size_t size);
+
+// Find the first bit set in BITS, from bit START up to N_BITS (returns N_BITS if there is none)
+extern size_t cpuinfo_bitset_find_first(const uint64_t *bits, size_t n_bits, size_t start);
+
+// Copy methods, in the order they are used as sizes grow
+typedef enum {
+  CPUINFO_COPY_SCALAR,			// library memcpy() / memset()
+  CPUINFO_COPY_VECTOR,			// vector loads and stores
+  CPUINFO_COPY_REP_MOVSB,		// REP MOVSB / REP STOSB
+  CPUINFO_COPY_NONTEMPORAL,		// non-temporal stores, bypassing the caches
+  CPUINFO_COPY_MAX
+} cpuinfo_copy_method_t;
+
+// Copy strategy, a method is used from its threshold up to the next one
+typedef struct {
+  const char *variant;			// variant of the copy routines (e.g. "avx")
+  int vector_width;				// width of vector loops, in bits (0 if none)
+  size_t vector_threshold;		// size in bytes from which vector loops are used
+  size_t rep_movsb_threshold;	// size in bytes from which REP MOVSB is used
+  size_t nontemporal_threshold;	// size in bytes from which non-temporal stores are used
+  int measured;					// thresholds were refined by measurement
+} cpuinfo_copy_strategy_t;
+
+// Thresholds of methods that are never used
+#define CPUINFO_COPY_NEVER ((size_t)-1)
+
+// Get the copy strategy estimated from the processor features and caches
+extern const cpuinfo_copy_strategy_t *cpuinfo_get_copy_strategy(void);
+
+// Refine the copy strategy by timing copies on this processor (takes a fraction of a second)
+extern const cpuinfo_copy_strategy_t *cpuinfo_measure_copy_strategy(void);
+
+// Get the copy method used for SIZE bytes
+extern int cpuinfo_get_copy_method(size_t size);
+
+// Copy or fill SIZE bytes following the copy strategy, returns DST
+extern void *cpuinfo_memcpy(void *dst, const void *src, size_t size);
+extern void *cpuinfo_memset(void *dst, int c, size_t size);
+
+// Returns the dispatcher of the kernel, e.g. to list its variants (NULL if there is none)
+extern cpuinfo_dispatch_t *cpuinfo_kernel_get_dispatch(int kernel);
+
+// Utility functions to convert IDs
+extern const char *cpuinfo_string_of_kernel(int kernel);
+extern const char *cpuinfo_string_of_copy_method(int method);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPUINFO_KERNELS_H */
@@ -0,0 +1,710 @@
+/*
+ *  cpuinfo-memory.c - Memory pages and hierarchy information
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "sysdeps.h"
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/time.h>
+#ifdef HAVE_X86_INTRINSICS
+#include <immintrin.h>
+#endif
+#include "cpuinfo.h"
+#include "cpuinfo-private.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+static const char sysfs_hugepages[] = "/sys/kernel/mm/hugepages";
+static const char sysfs_node[] = "/sys/devices/system/node";
+static const char sysfs_thp[] = "/sys/kernel/mm/transparent_hugepage";
+
+// Page sizes the processor may support, in KB
+static const int hw_page_sizes[] = { 4, 2048, 4096, 1024 * 1024, 0 };
+
+#define MAX_PAGE_SIZES 16
+
+// Find page size in PAGES, or add it (returns NULL if there is no room left)
+static cpuinfo_page_info_t *get_page(cpuinfo_page_info_t *pages, int *n_pages, int size)
+{
+  int i;
+  for (i = 0; i < *n_pages; i++) {
+	if (pages[i].size == size)
+	  return &pages[i];
+  }
+  if (*n_pages >= MAX_PAGE_SIZES)
+	return NULL;
+  cpuinfo_page_info_t *pp = &pages[(*n_pages)++];
+  memset(pp, 0, sizeof(*pp));
+  pp->size = size;
+  return pp;
+}
+
+// Get the selected mode of a sysfs setting (e.g. "always [madvise] never")
+static int get_sysfs_mode(char *mode, int size, const char *path)
+{
+  char line[256];
+  if (cpuinfo_sysfs_read_string(line, sizeof(line), "%s", path) < 0)
+	return -1;
+  char *start = strchr(line, '['), *end;
+  if (start == NULL || (end = strchr(++start, ']')) == NULL)
+	return -1;
+  *end = '\0';
+  strncpy(mode, start, size - 1);
+  mode[size - 1] = '\0';
+  return 0;
+}
+
+// Get transparent huge pages flags
+static int get_thp_flags(int *size)
+{
+  char mode[32], path[256];
+  long pmd_size;
+  int flags = 0;
+
+  if (cpuinfo_sysfs_read_string(mode, sizeof(mode), "%s/hpage_pmd_size", sysfs_thp) < 0
+	  || sscanf(mode, "%ld", &pmd_size) != 1 || pmd_size < 1024)
+	return 0;
+  *size = pmd_size / 1024;
+
+  // a per-size setting other than "inherit" overrides the global one
+  sprintf(path, "%s/hugepages-%dkB/enabled", sysfs_thp, *size);
+  if (get_sysfs_mode(mode, sizeof(mode), path) < 0 || strcmp(mode, "inherit") == 0) {
+	sprintf(path, "%s/enabled", sysfs_thp);
+	if (get_sysfs_mode(mode, sizeof(mode), path) < 0)
+	  return 0;
+  }
+  if (strcmp(mode, "always") == 0)
+	flags |= CPUINFO_PAGE_THP_ALWAYS;
+  else if (strcmp(mode, "madvise") == 0)
+	flags |= CPUINFO_PAGE_THP_MADVISE;
+  else
+	return 0;
+
+  // "defer" only wakes up kcompactd, page faults don't wait for compaction
+  sprintf(path, "%s/defrag", sysfs_thp);
+  if (get_sysfs_mode(mode, sizeof(mode), path) == 0) {
+	if (strcmp(mode, "always") == 0 || strcmp(mode, "madvise") == 0 || strcmp(mode, "defer+madvise") == 0)
+	  flags |= CPUINFO_PAGE_THP_DEFRAG;
+  }
+  return flags;
+}
+
+// Add hugetlbfs pools from DIR
+static void get_hugetlb_pools(cpuinfo_page_info_t *pages, int *n_pages, const char *dir)
+{
+  DIR *d = opendir(dir);
+  if (d == NULL)
+	return;
+  struct dirent *de;
+  while ((de = readdir(d)) != NULL) {
+	int size;
+	if (sscanf(de->d_name, "hugepages-%dkB", &size) != 1)
+	  continue;
+	cpuinfo_page_info_t *pp = get_page(pages, n_pages, size);
+	if (pp == NULL)
+	  break;
+	// the kernel only registers page sizes the MMU supports
+	pp->flags |= CPUINFO_PAGE_HARDWARE;
+	cpuinfo_sysfs_read_int(&pp->nr_pages, "%s/%s/nr_hugepages", dir, de->d_name);
+	cpuinfo_sysfs_read_int(&pp->free_pages, "%s/%s/free_hugepages", dir, de->d_name);
+	if (pp->free_pages > 0)
+	  pp->flags |= CPUINFO_PAGE_HUGETLB;
+  }
+  closedir(d);
+}
+
+// Page info comparator
+static int page_info_compare(const void *a, const void *b)
+{
+  const cpuinfo_page_info_t *pp1 = (const cpuinfo_page_info_t *)a;
+  const cpuinfo_page_info_t *pp2 = (const cpuinfo_page_info_t *)b;
+  return pp1->size - pp2->size;
+}
+
+// Get page sizes on NUMA node NODE (-1 for all nodes), returns the number of page sizes stored into PAGES
+int cpuinfo_get_page_info(struct cpuinfo *cip, int node, cpuinfo_page_info_t *pages, int n)
+{
+  cpuinfo_page_info_t page_infos[MAX_PAGE_SIZES];
+  cpuinfo_page_info_t *pp;
+  int i, n_pages = 0;
+
+  if (cip == NULL || pages == NULL || n < 1)
+	return -1;
+
+  // without NUMA information, there is a single node
+  char dir[256];
+  int has_nodes = access(sysfs_node, F_OK) == 0;
+  if (node >= 0) {
+	sprintf(dir, "%s/node%d", sysfs_node, node);
+	if (has_nodes ? access(dir, F_OK) < 0 : node > 0)
+	  return -1;
+  }
+
+  int base_size = 4;
+#ifdef _SC_PAGESIZE
+  if (sysconf(_SC_PAGESIZE) >= 1024)
+	base_size = sysconf(_SC_PAGESIZE) / 1024;
+#endif
+  if ((pp = get_page(page_infos, &n_pages, base_size)) != NULL)
+	pp->flags |= CPUINFO_PAGE_HARDWARE | CPUINFO_PAGE_BASE;
+
+  for (i = 0; hw_page_sizes[i] != 0; i++) {
+	if (cpuinfo_arch_has_page_size(cip, hw_page_sizes[i]) > 0) {
+	  if ((pp = get_page(page_infos, &n_pages, hw_page_sizes[i])) != NULL)
+		pp->flags |= CPUINFO_PAGE_HARDWARE;
+	}
+  }
+
+  if (node < 0 || !has_nodes)
+	get_hugetlb_pools(page_infos, &n_pages, sysfs_hugepages);
+  else {
+	sprintf(dir, "%s/node%d/hugepages", sysfs_node, node);
+	get_hugetlb_pools(page_infos, &n_pages, dir);
+  }
+
+  // transparent huge pages are allocated from any node the memory policy allows
+  int thp_size = 0, thp_flags = get_thp_flags(&thp_size);
+  if (thp_flags && (pp = get_page(page_infos, &n_pages, thp_size)) != NULL)
+	pp->flags |= CPUINFO_PAGE_HARDWARE | thp_flags;
+
+  qsort(page_infos, n_pages, sizeof(page_infos[0]), page_info_compare);
+  for (i = 0; i < n_pages; i++) {
+	pp = &page_infos[i];
+	if (pp->flags & (CPUINFO_PAGE_BASE | CPUINFO_PAGE_HUGETLB | CPUINFO_PAGE_THP_ALWAYS | CPUINFO_PAGE_THP_MADVISE))
+	  pp->flags |= CPUINFO_PAGE_AVAILABLE;
+	D(bug("page size %d KB, flags %02x, %d/%d free\n", pp->size, pp->flags, pp->free_pages, pp->nr_pages));
+  }
+
+  if (n > n_pages)
+	n = n_pages;
+  memcpy(pages, page_infos, n * sizeof(*pages));
+  return n;
+}
+
+// Get distance from NUMA node FROM to the memory of node TO, 10 being local
+int cpuinfo_get_node_distance(struct cpuinfo *cip, int from, int to)
+{
+  char line[1024];
+  if (from < 0 || to < 0)
+	return -1;
+  if (cpuinfo_sysfs_read_string(line, sizeof(line), "%s/node%d/distance", sysfs_node, from) < 0) {
+	// without NUMA information, there is a single node
+	if (access(sysfs_node, F_OK) < 0 && from == 0 && to == 0)
+	  return 10;
+	return -1;
+  }
+
+  // distances to each node, in node order
+  char *p = line, *end;
+  int i;
+  for (i = 0; ; i++) {
+	long distance = strtol(p, &end, 10);
+	if (end == p)
+	  return -1;
+	if (i == to)
+	  return distance;
+	p = end;
+  }
+}
+
+
+/* ========================================================================= */
+/* == Memory Hierarchy Model                                              == */
+/* ========================================================================= */
+
+#define MODEL_MAX_LEVELS		(CPUINFO_CACHE_LEVELS - 1)	// cache levels 1 to 4
+#define MODEL_LINE_FILL_BUFFERS	10				// outstanding L1 misses of a core
+#define MODEL_NODE_THREADS		4				// threads that saturate the memory of a NUMA node
+#define MODEL_WALK_BYTES		512				// bytes mapped per byte of page tables (4 KB pages)
+
+#define CALIBRATE_MAX_SIZE		(64 << 20)		// largest buffer used for calibration
+#define CALIBRATE_WALK_STEPS	(1 << 16)
+#define CALIBRATE_MIN_TIME		0.002			// minimum duration of a bandwidth measurement, in seconds
+
+struct cpuinfo_memory_model {
+  int n_levels;										// number of cache levels
+  cpuinfo_memory_level_t levels[MODEL_MAX_LEVELS + 1];	// caches from level 1, then main memory
+  unsigned long cache_sizes[MODEL_MAX_LEVELS];		// whole cache sizes, as seen by a single thread
+  int line_size;									// cache line size in bytes
+  int n_threads;									// threads of the placement
+  int n_nodes;										// NUMA nodes the threads run on
+  double numa_factor;								// mean memory latency relative to local accesses
+  unsigned long tlb_reach;							// data TLB reach with 4 KB pages in bytes (0 if unknown)
+  int calibrated;									// latencies and bandwidths were measured
+  int read_width;									// widest loads usable for calibration, in bits
+};
+
+// Latencies and single thread bandwidths measured on this processor, shared by all models
+static cpuinfo_memory_level_t calibrated_levels[MODEL_MAX_LEVELS + 1];
+static int n_calibrated_levels = -1;
+
+// Typical load-to-use latencies of cache levels, in cycles
+static const int default_cache_latencies[MODEL_MAX_LEVELS] = { 4, 14, 50, 80 };
+#define DEFAULT_MEMORY_LATENCY	90.0			// in ns
+
+// Estimate latencies and single thread bandwidths from the microarchitecture characteristics
+static void estimate_levels(struct cpuinfo *cip, cpuinfo_memory_model_t *mp)
+{
+  const cpuinfo_uarch_info_t *uip = cpuinfo_get_uarch_info(cip);
+  int frequency = cpuinfo_get_frequency(cip);
+  double ghz = (frequency > 0 ? frequency : 2500) / 1000.0;
+
+  int i;
+  for (i = 0; i < mp->n_levels; i++) {
+	cpuinfo_memory_level_t *lp = &mp->levels[i];
+	int cycles = default_cache_latencies[i];
+	if (uip && i == 0 && uip->l1_latency > 0)
+	  cycles = uip->l1_latency;
+	else if (uip && i == 1 && uip->l2_latency > 0)
+	  cycles = uip->l2_latency;
+	else if (uip && i == 2 && uip->l3_latency > 0)
+	  cycles = uip->l3_latency;
+	lp->latency = cycles / ghz;
+
+	// L1 serves every load port, outer levels a line every 2 or 4 cycles
+	int bytes_per_cycle = 16;
+	if (i == 0) {
+	  int load_units = uip && uip->load_units > 0 ? uip->load_units : 2;
+	  int width = uip && uip->vector_width > 0 ? uip->vector_width : 128;
+	  if (uip && uip->datapath_width > 0 && uip->datapath_width < width)
+		width = uip->datapath_width;
+	  bytes_per_cycle = load_units * width / 8;
+	}
+	else if (i == 1)
+	  bytes_per_cycle = 32;
+	lp->bandwidth = bytes_per_cycle * ghz;
+  }
+
+  // a core streams from memory at most as many lines as it has fill buffers (Little's law)
+  cpuinfo_memory_level_t *lp = &mp->levels[mp->n_levels];
+  lp->latency = DEFAULT_MEMORY_LATENCY;
+  lp->bandwidth = MODEL_LINE_FILL_BUFFERS * mp->line_size / lp->latency;
+}
+
+// Outer levels are never faster than inner ones, whether estimated or measured
+static void sort_levels(cpuinfo_memory_level_t *levels, int n)
+{
+  int i;
+  for (i = 1; i < n; i++) {
+	if (levels[i].latency < levels[i - 1].latency)
+	  levels[i].latency = levels[i - 1].latency;
+	if (levels[i].bandwidth > levels[i - 1].bandwidth)
+	  levels[i].bandwidth = levels[i - 1].bandwidth;
+  }
+}
+
+// Get the NUMA nodes used by the placement and their mean memory distance
+static void get_numa_placement(struct cpuinfo *cip, cpuinfo_memory_model_t *mp, int n_cpus, int placement)
+{
+  int nodes[64], n_nodes = 0;
+  const cpuinfo_core_complexes_t *ccp = cpuinfo_get_core_complexes(cip);
+  if (ccp) {
+	int i, j;
+	for (i = 0; i < ccp->count && n_nodes < sizeof(nodes) / sizeof(nodes[0]); i++) {
+	  int node = ccp->complexes[i].node;
+	  if (node < 0)
+		continue;
+	  for (j = 0; j < n_nodes && nodes[j] != node; j++)
+		;
+	  if (j == n_nodes)
+		nodes[n_nodes++] = node;
+	}
+  }
+
+  mp->n_nodes = 1;
+  mp->numa_factor = 1.0;
+  if (n_nodes < 2)
+	return;
+
+  // compact placements fill a node before the next, spread ones use all nodes
+  int cpus_per_node = n_cpus / n_nodes;
+  if (cpus_per_node < 1)
+	cpus_per_node = 1;
+  if (placement == CPUINFO_PLACEMENT_COMPACT)
+	mp->n_nodes = (mp->n_threads + cpus_per_node - 1) / cpus_per_node;
+  else
+	mp->n_nodes = mp->n_threads;
+  if (mp->n_nodes > n_nodes)
+	mp->n_nodes = n_nodes;
+
+  // memory is assumed to be interleaved over the nodes the threads run on
+  int i, j, n = 0;
+  double sum = 0;
+  for (i = 0; i < mp->n_nodes; i++) {
+	int local = cpuinfo_get_node_distance(cip, nodes[i], nodes[i]);
+	for (j = 0; j < mp->n_nodes; j++) {
+	  int distance = cpuinfo_get_node_distance(cip, nodes[i], nodes[j]);
+	  if (local > 0 && distance > 0) {
+		sum += (double)distance / local;
+		n++;
+	  }
+	}
+  }
+  if (n > 0)
+	mp->numa_factor = sum / n;
+}
+
+// Get the width of the widest loads the processor can use, in bits (0 for general registers)
+static int get_read_width(struct cpuinfo *cip)
+{
+#ifdef HAVE_X86_INTRINSICS
+#ifdef HAVE_X86_AVX512_INTRINSICS
+  if (cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_AVX512F))
+	return 512;
+#endif
+  if (cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_AVX2))
+	return 256;
+  if (cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_SSE2))
+	return 128;
+#endif
+  return 0;
+}
+
+// Returns a new memory hierarchy model for N_THREADS threads placed as PLACEMENT
+cpuinfo_memory_model_t *cpuinfo_memory_model_new(struct cpuinfo *cip, int n_threads, int placement)
+{
+  if (cip == NULL)
+	return NULL;
+
+  cpuinfo_cache_blocking_t blocks[MODEL_MAX_LEVELS];
+  int n_levels = cpuinfo_get_cache_blocking(cip, n_threads, placement, blocks, MODEL_MAX_LEVELS);
+  if (n_levels < 0)
+	return NULL;
+
+  cpuinfo_memory_model_t *mp = (cpuinfo_memory_model_t *)calloc(1, sizeof(*mp));
+  if (mp == NULL)
+	return NULL;
+
+  const cpuinfo_processors_t *cpp = cpuinfo_get_processors(cip);
+  int n_cpus = cpp && cpp->count > 0 ? cpp->count : 1;
+  mp->n_threads = n_threads > 0 && n_threads < n_cpus ? n_threads : n_cpus;
+  mp->n_levels = n_levels;
+  mp->line_size = n_levels > 0 ? blocks[0].line_size : 64;
+  int i;
+  for (i = 0; i < n_levels; i++) {
+	mp->levels[i].level = blocks[i].level;
+	mp->levels[i].size = blocks[i].capacity;
+	mp->cache_sizes[i] = (unsigned long)cpuinfo_get_cache(cip, blocks[i].level, CPUINFO_CACHE_TYPE_DATA)->size * 1024;
+  }
+  mp->levels[n_levels].level = 0;
+  mp->tlb_reach = cpuinfo_get_tlb_reach(cip, CPUINFO_PAGE_SIZE_4K) * 1024;
+  mp->read_width = get_read_width(cip);
+  get_numa_placement(cip, mp, n_cpus, placement);
+
+  estimate_levels(cip, mp);
+  sort_levels(mp->levels, n_levels + 1);
+  if (n_calibrated_levels == n_levels) {
+	for (i = 0; i <= n_levels; i++) {
+	  mp->levels[i].latency = calibrated_levels[i].latency;
+	  mp->levels[i].bandwidth = calibrated_levels[i].bandwidth;
+	}
+	mp->calibrated = 1;
+  }
+  return mp;
+}
+
+// Release memory hierarchy model
+void cpuinfo_memory_model_destroy(cpuinfo_memory_model_t *mp)
+{
+  free(mp);
+}
+
+// Returns 1 if the model was calibrated
+int cpuinfo_memory_model_is_calibrated(const cpuinfo_memory_model_t *mp)
+{
+  return mp && mp->calibrated;
+}
+
+// Get level N of the model, as seen by each thread of the placement
+static void get_level(const cpuinfo_memory_model_t *mp, int n, cpuinfo_memory_level_t *lp)
+{
+  *lp = mp->levels[n];
+  if (n == mp->n_levels) {
+	lp->latency *= mp->numa_factor;
+	// threads share the memory bandwidth of their nodes
+	double node_bandwidth = mp->levels[n].bandwidth * MODEL_NODE_THREADS;
+	if (lp->bandwidth * mp->n_threads > node_bandwidth * mp->n_nodes)
+	  lp->bandwidth = node_bandwidth * mp->n_nodes / mp->n_threads;
+  }
+}
+
+// Get levels of the model, caches first then main memory
+int cpuinfo_memory_model_get_levels(const cpuinfo_memory_model_t *mp, cpuinfo_memory_level_t *levels, int n)
+{
+  if (mp == NULL || levels == NULL || n < 1)
+	return -1;
+
+  int i;
+  if (n > mp->n_levels + 1)
+	n = mp->n_levels + 1;
+  for (i = 0; i < n; i++)
+	get_level(mp, i, &levels[i]);
+  return n;
+}
+
+// Expected latency of uniformly random accesses into WORKING_SET bytes of caches of SIZES,
+// with accesses hitting a level in proportion of its capacity
+static double get_random_latency(const cpuinfo_memory_model_t *mp, const cpuinfo_memory_level_t *levels,
+								 const unsigned long *sizes, double working_set, int with_tlb)
+{
+  double latency = 0, hit = 0;
+  int i;
+  for (i = 0; i <= mp->n_levels && hit < 1.0; i++) {
+	double level_hit = 1.0;
+	if (i < mp->n_levels && sizes[i] < working_set)
+	  level_hit = sizes[i] / working_set;
+	if (level_hit > hit) {
+	  latency += (level_hit - hit) * levels[i].latency;
+	  hit = level_hit;
+	}
+  }
+
+  // accesses beyond the TLB reach walk page tables, themselves cached like data
+  if (with_tlb && mp->tlb_reach > 0 && working_set > mp->tlb_reach)
+	latency += (1.0 - mp->tlb_reach / working_set) *
+	  get_random_latency(mp, levels, sizes, working_set / MODEL_WALK_BYTES, 0);
+  return latency;
+}
+
+// Get expected cost of accesses following PATTERN into a working set of WORKING_SET bytes
+int cpuinfo_memory_model_get_cost(const cpuinfo_memory_model_t *mp, unsigned long working_set, int pattern, cpuinfo_memory_cost_t *cp)
+{
+  if (mp == NULL || cp == NULL || pattern < 0 || pattern >= CPUINFO_ACCESS_MAX)
+	return -1;
+
+  cpuinfo_memory_level_t levels[MODEL_MAX_LEVELS + 1];
+  unsigned long sizes[MODEL_MAX_LEVELS];
+  int i, n = cpuinfo_memory_model_get_levels(mp, levels, MODEL_MAX_LEVELS + 1);
+  for (i = 0; i < mp->n_levels; i++)
+	sizes[i] = levels[i].size;
+
+  // smallest level holding the working set
+  for (i = 0; i < mp->n_levels && levels[i].size < working_set; i++)
+	;
+  const cpuinfo_memory_level_t *lp = &levels[i < n ? i : n - 1];
+  cp->level = lp->level;
+
+  if (pattern == CPUINFO_ACCESS_HASH_TABLE) {
+	// independent misses overlap up to the number of line fill buffers
+	cp->latency = get_random_latency(mp, levels, sizes, working_set > 0 ? working_set : 1, 1);
+	cp->bandwidth = MODEL_LINE_FILL_BUFFERS * mp->line_size / cp->latency;
+	if (cp->bandwidth > lp->bandwidth)
+	  cp->bandwidth = lp->bandwidth;
+  }
+  else {
+	// sequential accesses are prefetched, a line costs its transfer time
+	cp->bandwidth = lp->bandwidth;
+	cp->latency = mp->line_size / lp->bandwidth;
+  }
+  return 0;
+}
+
+static double get_time(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void * volatile walk_sink;
+static volatile uint64_t read_sink;
+
+// Time a random cyclic walk over the lines of SIZE bytes of BUF, in ns per access
+static double time_random_walk(void **buf, unsigned long size, int line_size)
+{
+  unsigned long i, n = size / line_size, stride = line_size / sizeof(void *);
+  unsigned long *order = (unsigned long *)malloc(n * sizeof(*order));
+  if (order == NULL)
+	return -1;
+
+  // Sattolo's algorithm yields a single cycle through all lines
+  uint64_t x = 0x9e3779b97f4a7c15ULL;
+  for (i = 0; i < n; i++)
+	order[i] = i;
+  for (i = n - 1; i > 0; i--) {
+	x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+	unsigned long j = x % i, t = order[i];
+	order[i] = order[j];
+	order[j] = t;
+  }
+  for (i = 0; i < n; i++)
+	buf[order[i] * stride] = &buf[order[(i + 1) % n] * stride];
+  free(order);
+
+  void **p = buf;
+  for (i = 0; i < n && i < CALIBRATE_WALK_STEPS; i++)
+	p = (void **)*p;
+
+  int trial;
+  double best = 0;
+  for (trial = 0; trial < 3; trial++) {
+	double start = get_time();
+	for (i = 0; i < CALIBRATE_WALK_STEPS; i += 4) {
+	  p = (void **)*p;
+	  p = (void **)*p;
+	  p = (void **)*p;
+	  p = (void **)*p;
+	}
+	double elapsed = (get_time() - start) * 1e9 / CALIBRATE_WALK_STEPS;
+	if (trial == 0 || elapsed < best)
+	  best = elapsed;
+  }
+  walk_sink = p;
+  return best;
+}
+
+// Sequential reads of SIZE bytes of BUF (a multiple of 256), with independent accumulators so that
+// loads are only limited by the load ports and the memory hierarchy
+static uint64_t read_scalar(const void *buf, unsigned long size)
+{
+  const uint64_t *p = (const uint64_t *)buf;
+  uint64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+  unsigned long i;
+  for (i = 0; i < size / sizeof(*p); i += 4) {
+	a0 ^= p[i];
+	a1 ^= p[i + 1];
+	a2 ^= p[i + 2];
+	a3 ^= p[i + 3];
+  }
+  return a0 ^ a1 ^ a2 ^ a3;
+}
+
+#ifdef HAVE_X86_INTRINSICS
+#define DEFINE_READ_VARIANT(NAME, TARGET, VECTOR, LOAD, XOR)					\
+__attribute__((target(TARGET)))												\
+static uint64_t read_##NAME(const void *buf, unsigned long size)				\
+{																				\
+  const VECTOR *p = (const VECTOR *)buf;										\
+  VECTOR a0, a1, a2, a3;														\
+  unsigned long i;																\
+  a0 = a1 = a2 = a3 = LOAD(p);													\
+  for (i = 0; i < size / sizeof(*p); i += 4) {									\
+	a0 = XOR(a0, LOAD(p + i));													\
+	a1 = XOR(a1, LOAD(p + i + 1));												\
+	a2 = XOR(a2, LOAD(p + i + 2));												\
+	a3 = XOR(a3, LOAD(p + i + 3));												\
+  }																				\
+  a0 = XOR(XOR(a0, a1), XOR(a2, a3));											\
+  uint64_t words[sizeof(a0) / sizeof(uint64_t)];								\
+  memcpy(words, &a0, sizeof(a0));												\
+  return words[0];																\
+}
+
+DEFINE_READ_VARIANT(sse2, "sse2", __m128i, _mm_loadu_si128, _mm_xor_si128)
+DEFINE_READ_VARIANT(avx2, "avx2", __m256i, _mm256_loadu_si256, _mm256_xor_si256)
+#ifdef HAVE_X86_AVX512_INTRINSICS
+DEFINE_READ_VARIANT(avx512, "avx512f", __m512i, _mm512_loadu_si512, _mm512_xor_si512)
+#endif
+#endif
+
+// Time sequential reads of SIZE bytes of BUF with loads of READ_WIDTH bits, in GB/s
+static double time_read(const void *buf, unsigned long size, int read_width)
+{
+  uint64_t (*read_func)(const void *, unsigned long) = read_scalar;
+#ifdef HAVE_X86_INTRINSICS
+  switch (read_width) {
+#ifdef HAVE_X86_AVX512_INTRINSICS
+  case 512: read_func = read_avx512; break;
+#endif
+  case 256: read_func = read_avx2; break;
+  case 128: read_func = read_sse2; break;
+  }
+#endif
+
+  size &= ~255UL;
+  int trial;
+  double best = 0;
+  for (trial = 0; trial < 3; trial++) {
+	int n = 0;
+	uint64_t sum = 0;
+	double start = get_time(), elapsed;
+	do {
+	  sum += read_func(buf, size);
+	  n++;
+	} while ((elapsed = get_time() - start) < CALIBRATE_MIN_TIME);
+	read_sink = sum;
+	double bandwidth = (double)size * n / elapsed * 1e-9;
+	if (bandwidth > best)
+	  best = bandwidth;
+  }
+  return best;
+}
+
+// Refine latencies and bandwidths by timing accesses on this processor
+int cpuinfo_memory_model_calibrate(cpuinfo_memory_model_t *mp)
+{
+  if (mp == NULL)
+	return -1;
+  if (mp->calibrated)
+	return 0;
+
+  void **buf = (void **)malloc(CALIBRATE_MAX_SIZE);
+  if (buf == NULL)
+	return -1;
+  memset(buf, 0, CALIBRATE_MAX_SIZE);
+
+  // levels are measured by a single thread with whole caches, from the innermost one so that
+  // hits in inner levels can be accounted for
+  int i;
+  double latency;
+  cpuinfo_memory_level_t *levels = mp->levels;
+  for (i = 0; i <= mp->n_levels; i++) {
+	unsigned long size;
+	if (i < mp->n_levels)
+	  size = mp->cache_sizes[i] / 2;
+	else {
+	  size = i > 0 ? mp->cache_sizes[i - 1] * 8 : CALIBRATE_MAX_SIZE;
+	  if (size > CALIBRATE_MAX_SIZE)
+		size = CALIBRATE_MAX_SIZE;
+	  // too few accesses would miss in a huge last-level cache
+	  if (i > 0 && size < mp->cache_sizes[i - 1] * 2)
+		break;
+	}
+	if (size < mp->line_size * 16 || size > CALIBRATE_MAX_SIZE)
+	  break;
+
+	if ((latency = time_random_walk(buf, size, mp->line_size)) < 0)
+	  break;
+	// latency of this level is what remains once hits in inner levels are accounted for
+	double estimate = levels[i].latency;
+	levels[i].latency = 0;
+	double inner = get_random_latency(mp, levels, mp->cache_sizes, size, 1);
+	double inner_hit = i > 0 && mp->cache_sizes[i - 1] < size ? (double)mp->cache_sizes[i - 1] / size : 0;
+	levels[i].latency = inner_hit < 1.0 ? (latency - inner) / (1.0 - inner_hit) : estimate;
+	if (levels[i].latency <= 0)
+	  levels[i].latency = estimate;
+	double bandwidth = time_read(buf, size, mp->read_width);
+	// general register loads can't reach the cache bandwidth, they only refine estimates down to memory
+	if (mp->read_width > 0 || i == mp->n_levels || bandwidth > levels[i].bandwidth)
+	  levels[i].bandwidth = bandwidth;
+	D(bug("memory level %d: %lu bytes, %.1f ns, %.1f GB/s\n", levels[i].level, size, levels[i].latency, levels[i].bandwidth));
+  }
+  free(buf);
+
+  // levels that could not be measured keep their estimates
+  sort_levels(levels, mp->n_levels + 1);
+  for (i = 0; i <= mp->n_levels; i++) {
+	calibrated_levels[i].latency = levels[i].latency;
+	calibrated_levels[i].bandwidth = levels[i].bandwidth;
+  }
+  n_calibrated_levels = mp->n_levels;
+  mp->calibrated = 1;
+  return 0;
+}
@@ -30,164 +30,8 @@
 #define DEBUG 1
 #include "debug.h"
 
-// CPU caches specifications
-#define DEFINE_CACHE_DESCRIPTOR(NAME, TYPE, LEVEL, SIZE) \
-static const cpuinfo_cache_descriptor_t NAME = { CPUINFO_CACHE_TYPE_##TYPE, LEVEL, SIZE }
-DEFINE_CACHE_DESCRIPTOR(L1I_8KB,	CODE,		1,	    8);
-DEFINE_CACHE_DESCRIPTOR(L1I_16KB,	CODE,		1,	   16);
-DEFINE_CACHE_DESCRIPTOR(L1I_32KB,	CODE,		1,	   32);
-DEFINE_CACHE_DESCRIPTOR(L1D_8KB,	DATA,		1,	    8);
-DEFINE_CACHE_DESCRIPTOR(L1D_16KB,	DATA,		1,	   16);
-DEFINE_CACHE_DESCRIPTOR(L1D_32KB,	DATA,		1,	   32);
-DEFINE_CACHE_DESCRIPTOR(L2_512KB,	UNIFIED,	2,	  512);
-#undef DEFINE_CACHE_DESCRIPTOR
-
-// CPU specs table
+// Number of cache descriptors in the mips_specs table of cpuinfo-data.def
 #define N_CACHE_DESCRIPTORS 3
-struct mips_spec_entry {
-  uint32_t prid_mask;
-  uint32_t prid_value;
-  int vendor;
-  char *model;
-  const cpuinfo_cache_descriptor_t *caches[N_CACHE_DESCRIPTORS];
-};
-
-typedef struct mips_spec_entry mips_spec_t;
-
-static const mips_spec_t mips_specs[] = {
-  { /* MIPS R16000 */
-	0xfff0, 0x0f30,
-	CPUINFO_VENDOR_MIPS, "R16000",
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* MIPS R14000 */
-	0xff00, 0x0f00,
-	CPUINFO_VENDOR_MIPS, "R14000",
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* MIPS R12000 */
-	/* <http://sc.tamu.edu/help/power/powerlearn/reference/R12000_developer.ps> */
-	0xff00, 0x0e00,
-	CPUINFO_VENDOR_MIPS, "R12000",
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* MIPS R10000 */
-	/* <http://techpubs.sgi.com/library/manuals/2000/007-2490-001/pdf/007-2490-001.pdf> */
-	0xff00, 0x0900,
-	CPUINFO_VENDOR_MIPS, "R10000",
-	{ &L1I_32KB, &L1D_32KB } /* XXX: external L2 cache (512 KB to 16 MB) */
-  },
-  { /* MIPS R8000 */
-	0xff00, 0x1000,
-	CPUINFO_VENDOR_MIPS, "R8000",
-	{ NULL }
-  },
-  { /* PMC-SIERRA RM7000 */
-	/* <http://www.pmc-sierra.com/products/details/rm7000/> */
-	0xff00, 0x2700,
-	CPUINFO_VENDOR_PMC, "RM7000",
-	{ &L1I_16KB, &L1D_16KB, &L2_512KB } /* XXX: external L3 cache (up to 64 MB) */
-  },
-  { /* MIPS R6000A */
-	0xff00, 0x0600,
-	CPUINFO_VENDOR_MIPS, "R6000A",
-	{ NULL }
-  },
-  { /* MIPS R6000 */
-	/* <http://www.linux-mips.org/wiki/R6000> */
-	0xff00, 0x0300,
-	CPUINFO_VENDOR_MIPS, "R6000",
-	{ &L1I_16KB, &L1D_16KB, &L2_512KB } /* XXX: L1 I-cache can be increased to 64KB */
-  },
-  { /* PMC-SIERRA R5271 */
-	0xff00, 0x2800,
-	CPUINFO_VENDOR_PMC, "RM5271",
-	{ NULL }
-  },
-  { /* MIPS R5000 */
-	/* <http://www.mips.com/content/Documentation/MIPSDocumentation/RSeriesDocs/content_html/documents/R5000%20Product%20Information.pdf> */
-	0xff00, 0x2300,
-	CPUINFO_VENDOR_MIPS, "R5000",
-	{ &L1I_32KB, &L1D_32KB } /* XXX: external L2 cache (512 KB to 2 MB) */
-  },
-  { /* MIPS R4700 */
-	0xff00, 0x2100,
-	CPUINFO_VENDOR_MIPS, "R4700",
-	{ NULL }
-  },
-  { /* MIPS R4650 */
-	0xff00, 0x2200,
-	CPUINFO_VENDOR_MIPS, "R4650",
-	{ NULL }
-  },
-  { /* MIPS R4600 */
-	0xff00, 0x2000,
-	CPUINFO_VENDOR_MIPS, "R4600",
-	{ &L1I_16KB, &L1D_16KB }
-  },
-  { /* MIPS R4400 */
-	0xfff0, 0x0440,
-	CPUINFO_VENDOR_MIPS, "R4400",
-	{ &L1I_16KB, &L1D_16KB } /* XXX: external L2 cache (128 KB to 4 MB) */
-  },
-  { /* MIPS R4300i */
-	/* <http://www.mips.com/content/Documentation/MIPSDocumentation/RSeriesDocs/content_html/documents/R4300i%20Product%20Information.pdf> */
-	0xff00, 0x0b00,
-	CPUINFO_VENDOR_MIPS, "R4300i",
-	{ &L1I_16KB, &L1D_8KB }
-  },
-  { /* MIPS R4000 */
-	/* <http://www.mips.com/Documentation/MIPSDocumentation/RSeriesDocs/content_html/documents/R4000%20Microprocessor%20Users%20Manual.pdf> */
-	0xff00, 0x0400,
-	CPUINFO_VENDOR_MIPS, "R4000",
-	{ &L1I_8KB, &L1D_8KB } /* XXX: up to 32 KB L1 caches, external L2 cache (128 KB to 4 MB) */
-  },
-  { /* MIPS R3000A */
-	0xfff0, 0x0220,
-	CPUINFO_VENDOR_MIPS, "R3000A",
-	{ NULL }
-  },
-  { /* MIPS R3000 */
-	0xfff0, 0x0210,
-	CPUINFO_VENDOR_MIPS, "R3000",
-	{ NULL }
-  },
-  { /* MIPS R2000A */
-	0xff00, 0x0200,
-	CPUINFO_VENDOR_MIPS, "R2000A",
-	{ NULL }
-  },
-  { /* MIPS R2000A */
-	0xfff0, 0x0110,
-	CPUINFO_VENDOR_MIPS, "R2000A",
-	{ NULL }
-  },
-  { /* MIPS R2000 */
-	0xff00, 0x0100,
-	CPUINFO_VENDOR_MIPS, "R2000",
-	{ NULL }
-  },
-  { /* Unknown */
-	0x0000, 0x0000,
-	CPUINFO_VENDOR_UNKNOWN, NULL,
-	{ NULL }
-  }
-};
-
-// Lookup CPU spec
-static const mips_spec_t *lookup_mips_spec(uint32_t prid)
-{
-  const mips_spec_t *spec = NULL;
-  const int n_specs = sizeof(mips_specs) / sizeof(mips_specs[0]);
-  for (int i = 0; i < n_specs; i++) {
-	if ((prid & mips_specs[i].prid_mask) == mips_specs[i].prid_value) {
-	  spec = &mips_specs[i];
-	  break;
-	}
-  }
-  assert(spec != NULL);
-  return spec;
-}
 
 // Arch-dependent data
 struct mips_cpuinfo {
@@ -215,6 +59,9 @@ static int cpuinfo_arch_init(mips_cpuinfo_t *acip)
 #if defined __sgi
   inv_state_t *isp = NULL;
   cpuinfo_cache_descriptor_t cache_desc;
+  cache_desc.sharing = 0;
+  cache_desc.line_size = 0;
+  cache_desc.ways = 0;
   if (setinvent_r(&isp) < 0)
 	return -1;
   inventory_t *inv;
@@ -272,17 +119,21 @@ static int cpuinfo_arch_init(mips_cpuinfo_t *acip)
   if (acip->prid == 0)
 	return -1;
 
-  const mips_spec_t *spec = lookup_mips_spec(acip->prid);
-  if (spec) {
-	acip->vendor = spec->vendor;
-	acip->model = spec->model;
+  cpuinfo_db_table_t table;
+  const cpuinfo_db_record_t *rp = NULL;
+  if (cpuinfo_db_get_table(CPUINFO_DB_MIPS_SPECS, 4 + N_CACHE_DESCRIPTORS, &table) == 0)
+	rp = cpuinfo_db_lookup_masked(&table, acip->prid, 1);
+  if (rp) {
+	acip->vendor = cpuinfo_db_field(rp, 2);
+	acip->model = cpuinfo_db_string(rp, 3);
 	if (caches_list == NULL) {
 	  for (int i = 0; i < N_CACHE_DESCRIPTORS; i++) {
-		if (spec->caches[i]) {
-		  if (cpuinfo_list_insert(&caches_list, spec->caches[i]) < 0) {
-			cpuinfo_list_clear(&caches_list);
-			return -1;
-		  }
+		cpuinfo_cache_descriptor_t cache_desc;
+		if (cpuinfo_db_cache(rp, 4 + i, &cache_desc) < 0)
+		  continue;
+		if (cpuinfo_list_insert(&caches_list, &cache_desc) < 0) {
+		  cpuinfo_list_clear(&caches_list);
+		  return -1;
 		}
 	  }
 	}
@@ -350,6 +201,18 @@ char *cpuinfo_arch_get_model(struct cpuinfo *cip)
   return NULL;
 }
 
+// Get processor signature (family, model, stepping)
+uint32_t cpuinfo_arch_get_signature(struct cpuinfo *cip)
+{
+  return ((mips_cpuinfo_t *)(cip->opaque))->prid;
+}
+
+// Get processor microarchitecture (of the current core if CORE_TYPE is unknown)
+int cpuinfo_arch_get_uarch(struct cpuinfo *cip, int core_type)
+{
+  return -1;
+}
+
 // Get processor frequency in MHz
 int cpuinfo_arch_get_frequency(struct cpuinfo *cip)
 {
@@ -374,6 +237,55 @@ int cpuinfo_arch_get_threads(struct cpuinfo *cip)
   return -1;
 }
 
+// Get type of the current processor core
+int cpuinfo_arch_get_core_type(struct cpuinfo *cip, int *native_model)
+{
+  *native_model = -1;
+  return CPUINFO_CORE_TYPE_UNKNOWN;
+}
+
+// Get extended state components enabled by the OS
+int cpuinfo_arch_get_xsave_info(struct cpuinfo *cip, cpuinfo_xsave_t *xsp)
+{
+  return -1;
+}
+
+// Get AMX tile palette information
+int cpuinfo_arch_get_tile_info(struct cpuinfo *cip, cpuinfo_tile_info_t *tip)
+{
+  return -1;
+}
+
+// Request permission to use AMX tile data
+int cpuinfo_arch_request_tile_permission(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Returns 1 if the processor supports pages of SIZE KB, 0 if not, -1 if unknown
+int cpuinfo_arch_has_page_size(struct cpuinfo *cip, int size)
+{
+  return -1;
+}
+
+// Get hardware prefetch size in bytes
+int cpuinfo_arch_get_prefetch_size(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Get TLB information
+cpuinfo_list_t cpuinfo_arch_get_tlbs(struct cpuinfo *cip)
+{
+  return NULL;
+}
+
+// Get virtualizer and paravirtual timing information
+int cpuinfo_arch_get_virtualizer(struct cpuinfo *cip, cpuinfo_virtualizer_info_t *vip)
+{
+  return -1;
+}
+
 // Get cache information
 cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
 {
@@ -401,3 +313,34 @@ int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
 
   return cpuinfo_feature_get_bit(cip, feature);
 }
+
+// Returns 1 if the processor reports the specified feature
+int cpuinfo_arch_has_hardware_feature(struct cpuinfo *cip, int feature)
+{
+  return cpuinfo_arch_has_feature(cip, feature);
+}
+
+// Returns the name of the feature as reported by the OS, or NULL if it is not reported
+const char *cpuinfo_arch_feature_os_name(int feature, int *linux_version)
+{
+  return NULL;
+}
+
+// Get the AT_HWCAP bit for the feature (returns -1 if there is none)
+int cpuinfo_arch_feature_hwcap(int feature, int *hwcap, unsigned long *mask)
+{
+  return -1;
+}
+
+// Execute advertised features, returns the number of features that faulted
+int cpuinfo_arch_verify_features(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Fill FEATURES without allocating memory nor calling the C library, returns the feature class
+int cpuinfo_arch_resolver_features(uint32_t *features, unsigned long hwcap)
+{
+  features[0] |= 1;
+  return CPUINFO_FEATURE_MIPS;
+}
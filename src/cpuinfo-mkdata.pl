@@ -0,0 +1,264 @@
+#!/usr/bin/perl
+#
+#  cpuinfo-mkdata.pl - Compile processor identification tables
+#
+#  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+#
+#  This library is free software; you can redistribute it and/or
+#  modify it under the terms of the GNU Lesser General Public License
+#  as published by the Free Software Foundation; either version 2.1
+#  of the License, or (at your option) any later version.
+#
+#  This library is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Lesser General Public License for more details.
+#
+#  You should have received a copy of the GNU Lesser General Public
+#  License along with this library; if not, write to the Free Software
+#  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+#
+#  Usage: cpuinfo-mkdata.pl [--c-array] cpuinfo-data.def output
+#
+#  File layout (all fields are little-endian 32-bit words):
+#    header	magic "CPUINFDB", format, revision, file size, number
+#		of tables, string pool offset, string pool size
+#    directory	table ID, fields per record, number of records, offset
+#    records	sorted by their first field
+#    strings	NUL-terminated, offset 0 is the empty string (NULL)
+#
+#  Tables whose keys all fit in a byte get a companion table (ID | 0x200)
+#  of 256 records, 1 + the first record of each key or 0 if there is none,
+#  so that lookups don't need a search.
+#
+
+use strict;
+
+use constant DB_MAGIC	=> "CPUINFDB";
+use constant DB_FORMAT	=> 1;
+use constant DB_MASKS	=> 0x100;
+use constant DB_INDEX	=> 0x200;
+
+my $c_array = 0;
+if (@ARGV && $ARGV[0] eq "--c-array") {
+    $c_array = 1;
+    shift;
+}
+
+my $def_file = shift;
+$def_file or die "ERROR: unspecified tables definition file";
+-f $def_file or die "ERROR: tables definition file does not exist";
+
+my $out_file = shift;
+$out_file or die "ERROR: unspecified output file";
+
+(my $src_dir = $def_file) =~ s,[^/]*$,,;
+$src_dir ||= "./";
+
+sub cat_ {
+    open(my $F, $_[0]) or return;
+    my @l = <$F>;
+    wantarray() ? @l : join '', @l
+}
+
+# Evaluate CPUINFO_* enumerations
+my %constants;
+foreach my $header ("cpuinfo.h", "cpuinfo-private.h") {
+    my ($in_enum, $value) = (0, 0);
+    foreach (cat_("$src_dir$header")) {
+	if (/^typedef enum/) {
+	    ($in_enum, $value) = (1, 0);
+	}
+	elsif (/^}/) {
+	    $in_enum = 0;
+	}
+	elsif ($in_enum && /^\s+CPUINFO_(\w+)(?:\s*=\s*([^,\/]+?))?\s*(,|$|\/)/) {
+	    my ($name, $expr) = ($1, $2);
+	    if (defined $expr) {
+		$expr =~ s/CPUINFO_CLASS\('(.)'\)/(ord('$1') << 8)/g;
+		$expr =~ s/CPUINFO_(\w+)/exists $constants{$1} ? $constants{$1} : die "ERROR: unknown constant CPUINFO_$1"/ge;
+		$value = eval $expr;
+		defined $value or die "ERROR: could not evaluate CPUINFO_$name";
+	    }
+	    $constants{$name} = $value++;
+	}
+    }
+}
+
+# String pool
+my $strings = "\0";
+my %string_offsets;
+sub add_string {
+    my $str = shift;
+    return 0 if $str eq "";
+    if (!exists $string_offsets{$str}) {
+	$string_offsets{$str} = length($strings);
+	$strings .= "$str\0";
+    }
+    return $string_offsets{$str};
+}
+
+my %cache_types = ( I => "CODE", D => "DATA", "" => "UNIFIED" );
+my %size_units = ( K => 1, M => 1024, G => 1024 * 1024 );
+
+sub parse_field {
+    my ($token, $prefix, $where) = @_;
+    if ($token eq "-") {
+	return 0;
+    }
+    elsif ($token =~ /^"(.*)"$/) {
+	return add_string($1);
+    }
+    elsif ($token =~ /^'(.)'$/) {
+	return ord($1);
+    }
+    elsif ($token =~ /^-?(0x[0-9a-fA-F]+|\d+)$/) {
+	my $value = $token =~ /^(-?)0x(.*)/ ? ($1 ? -hex($2) : hex($2)) : int($token);
+	return $value & 0xffffffff;
+    }
+    elsif ($token =~ /^L(\d)([ID]?):(\d+)([KMG])$/) {
+	# cache descriptor: type[31:28], level[27:24], size in KB[23:0]
+	my $type = $constants{"CACHE_TYPE_" . $cache_types{$2}};
+	my $size = $3 * $size_units{$4};
+	$size < (1 << 24) or die "ERROR: $where: cache size too large";
+	return ($type << 28) | ($1 << 24) | $size;
+    }
+    my $value = 0;
+    foreach my $sym (split /\|/, $token) {
+	my $name = $prefix . $sym;
+	exists $constants{$name} or die "ERROR: $where: unknown symbol $token";
+	$value |= $constants{$name};
+    }
+    return $value & 0xffffffff;
+}
+
+# Parse tables definition file
+my $revision;
+my @tables;
+my $table;
+my $line_number = 0;
+foreach (cat_($def_file)) {
+    ++$line_number;
+    my $where = "$def_file:$line_number";
+    s/\s*(#.*)?$//;
+    next if /^$/;
+    if (/^revision\s+(\d+)$/) {
+	$revision = $1;
+    }
+    elsif (/^\[(\w+)\]$/) {
+	my $name = "DB_" . uc($1);
+	exists $constants{$name} or die "ERROR: $where: unknown table $1";
+	$table = { name => $1, id => $constants{$name}, records => [] };
+	push @tables, $table;
+    }
+    elsif (!$table) {
+	die "ERROR: $where: record outside of a table";
+    }
+    elsif (/^fields\s+(.*)$/) {
+	foreach (split ' ', $1) {
+	    my ($field, $prefix) = split /=/;
+	    push @{$table->{fields}}, $field;
+	    push @{$table->{prefixes}}, $prefix || "";
+	}
+    }
+    elsif (/^mask\s+(\w+)$/) {
+	my $field = $1;
+	my ($n) = grep { $table->{fields}[$_] eq $field } 0 .. $#{$table->{fields}};
+	defined $n && $n > 0 or die "ERROR: $where: unknown mask field $field";
+	$table->{mask_field} = $n;
+    }
+    else {
+	my @tokens = /("[^"]*"|\S+)/g;
+	my $n_fields = @{$table->{fields}};
+	@tokens <= $n_fields or die "ERROR: $where: too many fields";
+	my @record = map { parse_field($tokens[$_], $table->{prefixes}[$_], $where) } 0 .. $#tokens;
+	push @record, 0 while @record < $n_fields;
+	push @{$table->{records}}, \@record;
+    }
+}
+defined $revision or die "ERROR: missing revision";
+
+sub popcount {
+    my $n = 0;
+    for (my $v = shift; $v; $v &= $v - 1) { ++$n }
+    return $n;
+}
+
+# Masked tables are looked up most specific mask first, make sure this
+# yields the same result as a first match in source order
+my @mask_tables;
+foreach my $t (@tables) {
+    my $m = $t->{mask_field};
+    next unless defined $m;
+    my @records = @{$t->{records}};
+    my %seen;
+    my @masks = grep { !$seen{$_}++ } map { $_->[$m] } @records;
+    my %order = map { ($masks[$_], $_) } 0 .. $#masks;
+    @masks = sort { popcount($b) <=> popcount($a) || $order{$a} <=> $order{$b} } @masks;
+    my %rank = map { ($masks[$_], $_) } 0 .. $#masks;
+    for (my $i = 0; $i < @records; $i++) {
+	my ($vi, $mi) = ($records[$i][0], $records[$i][$m]);
+	($vi & $mi) == $vi or die sprintf("ERROR: [%s]: value %08x has bits outside of mask %08x", $t->{name}, $vi, $mi);
+	for (my $j = $i + 1; $j < @records; $j++) {
+	    my ($vj, $mj) = ($records[$j][0], $records[$j][$m]);
+	    next if (($vi ^ $vj) & $mi & $mj) != 0;
+	    $rank{$mi} <= $rank{$mj} or die sprintf("ERROR: [%s]: %08x/%08x would shadow %08x/%08x", $t->{name}, $vj, $mj, $vi, $mi);
+	}
+    }
+    push @mask_tables, { id => $t->{id} | DB_MASKS, fields => [ "mask" ], records => [ map { [ $_ ] } @masks ], sorted => 1 };
+}
+push @tables, @mask_tables;
+
+# Records are sorted by key, stable so that equal keys keep their order
+foreach my $t (@tables) {
+    next if $t->{sorted};
+    my @records = @{$t->{records}};
+    my @order = sort { $records[$a][0] <=> $records[$b][0] || $a <=> $b } 0 .. $#records;
+    $t->{records} = [ @records[@order] ];
+}
+
+# Tables keyed by bytes, e.g. cpuid(2) descriptors, are indexed directly
+my @index_tables;
+foreach my $t (@tables) {
+    next if $t->{sorted};
+    my @records = @{$t->{records}};
+    next if !@records || grep { $_->[0] > 0xff } @records;
+    my @index = (0) x 256;
+    for (my $i = $#records; $i >= 0; $i--) {
+	$index[$records[$i][0]] = $i + 1;
+    }
+    push @index_tables, { id => $t->{id} | DB_INDEX, fields => [ "record" ], records => [ map { [ $_ ] } @index ], sorted => 1 };
+}
+push @tables, @index_tables;
+
+# Layout
+my $header_size = 8 + 6 * 4;
+my $offset = $header_size + 4 * 4 * @tables;
+my ($directory, $records) = ("", "");
+foreach my $t (@tables) {
+    my $n_fields = @{$t->{fields}};
+    my $n_records = @{$t->{records}};
+    $directory .= pack("V4", $t->{id}, $n_fields, $n_records, $offset + length($records));
+    $records .= pack("V*", @$_) foreach @{$t->{records}};
+}
+$strings .= "\0" while length($strings) % 4;
+my $strings_offset = $offset + length($records);
+my $size = $strings_offset + length($strings);
+my $db = DB_MAGIC . pack("V6", DB_FORMAT, $revision, $size, scalar(@tables), $strings_offset, length($strings))
+    . $directory . $records . $strings;
+length($db) == $size or die "ERROR: internal layout error";
+
+open(my $F, ">$out_file") or die "ERROR: could not create $out_file";
+binmode $F;
+if ($c_array) {
+    print $F "/* Generated by cpuinfo-mkdata.pl from cpuinfo-data.def, do not edit */\n";
+    print $F "static const uint8_t cpuinfo_builtin_db[$size] = {\n";
+    for (my $i = 0; $i < $size; $i += 12) {
+	print $F "  ", join(", ", map { sprintf("0x%02x", $_) } unpack("C*", substr($db, $i, 12))), ",\n";
+    }
+    print $F "};\n";
+}
+else {
+    print $F $db;
+}
+close($F) or die "ERROR: could not write $out_file";
@@ -226,328 +226,19 @@ struct ppc_cpuinfo {
 
 typedef struct ppc_cpuinfo ppc_cpuinfo_t;
 
-// CPU caches specifications
-#define DEFINE_CACHE_DESCRIPTOR(NAME, TYPE, LEVEL, SIZE) \
-static const cpuinfo_cache_descriptor_t NAME = { CPUINFO_CACHE_TYPE_##TYPE, LEVEL, SIZE }
-DEFINE_CACHE_DESCRIPTOR(L1I_8KB,	CODE,		1,	    8);
-DEFINE_CACHE_DESCRIPTOR(L1I_16KB,	CODE,		1,	   16);
-DEFINE_CACHE_DESCRIPTOR(L1I_32KB,	CODE,		1,	   32);
-DEFINE_CACHE_DESCRIPTOR(L1I_64KB,	CODE,		1,	   64);
-DEFINE_CACHE_DESCRIPTOR(L1D_8KB,	DATA,		1,	    8);
-DEFINE_CACHE_DESCRIPTOR(L1D_16KB,	DATA,		1,	   16);
-DEFINE_CACHE_DESCRIPTOR(L1D_32KB,	DATA,		1,	   32);
-DEFINE_CACHE_DESCRIPTOR(L1D_64KB,	DATA,		1,	   64);
-DEFINE_CACHE_DESCRIPTOR(L1_16KB,	UNIFIED,	1,	   16);
-DEFINE_CACHE_DESCRIPTOR(L1_32KB,	UNIFIED,	1,	   32);
-DEFINE_CACHE_DESCRIPTOR(L2_256KB,	UNIFIED,	2,	  256);
-DEFINE_CACHE_DESCRIPTOR(L2_512KB,	UNIFIED,	2,	  512);
-DEFINE_CACHE_DESCRIPTOR(L2_1440KB,	UNIFIED,	2,	 1440);
-DEFINE_CACHE_DESCRIPTOR(L2_1920KB,	UNIFIED,	2,	 1920);
-DEFINE_CACHE_DESCRIPTOR(L2_1MB,		UNIFIED,	2,	 1024);
-DEFINE_CACHE_DESCRIPTOR(L2_2MB,		UNIFIED,	2,	 2048);
-DEFINE_CACHE_DESCRIPTOR(L2_4MB,		UNIFIED,	2,	 4096);
-DEFINE_CACHE_DESCRIPTOR(L3_32MB,	UNIFIED,	3,	32768);
-DEFINE_CACHE_DESCRIPTOR(L3_36MB,	UNIFIED,	3,	36864);
-#undef DEFINE_CACHE_DESCRIPTOR
-
-// CPU specs table
+// CPU specs, from the ppc_specs table of cpuinfo-data.def
 #define N_CACHE_DESCRIPTORS 4
 struct ppc_spec_entry {
-  uint32_t pvr_mask;
-  uint32_t pvr_value;
   int vendor;
-  char *model;
+  const char *model;
   int n_cores;
   int n_threads;
-  const cpuinfo_cache_descriptor_t *caches[N_CACHE_DESCRIPTORS];
+  int n_caches;
+  cpuinfo_cache_descriptor_t caches[N_CACHE_DESCRIPTORS];
 };
 
 typedef struct ppc_spec_entry ppc_spec_t;
 
-static const ppc_spec_t ppc_specs[] = {
-  { /* PowerPC 601 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC601.pdf> */
-	0xffff0000, 0x00010000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 601",
-	1, 1,
-	{ &L1_32KB }
-  },
-  { /* PowerPC 603 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC603.pdf> */
-	0xffff0000, 0x00030000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 603",
-	1, 1,
-	{ &L1I_8KB, &L1D_8KB }
-  },
-  { /* PowerPC 603e */
-	/* <http://www.freescale.com/files/32bit/doc/prod_brief/MPC603E.pdf> */
-	0xffff0000, 0x00060000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 603e",
-	1, 1,
-	{ &L1I_16KB, &L1D_16KB }
-  },
-  { /* PowerPC 603ev */
-	0xffff0000, 0x00070000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 603ev",
-	1, 1,
-	{ &L1I_16KB, &L1D_16KB }
-  },
-  { /* PowerPC 604 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC604.pdf> */
-	0xffff0000, 0x00040000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 604",
-	1, 1,
-	{ &L1I_16KB, &L1D_16KB }
-  },
-  { /* PowerPC 604e */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC604E.pdf> */
-	0xfffff000, 0x00090000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 604e",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* PowerPC 604r */
-	0xffff0000, 0x00090000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 604r",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* PowerPC 604ev */
-	0xffff0000, 0x000a0000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 604ev",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* PowerPC 750CX */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/220134650EDFEB9187256AE8006CF163/$file/sw_ds_general.pdf> */
-	0xfffffff0, 0x00080100,
-	CPUINFO_VENDOR_IBM, "PowerPC 750CX",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 750CX */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/220134650EDFEB9187256AE8006CF163/$file/sw_ds_general.pdf> */
-	0xfffffff0, 0x00082200,
-	CPUINFO_VENDOR_IBM, "PowerPC 750CX",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 750CXe */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/31777DF6FD56656387256B1B0076E671/$file/750cxedd3.1_ds.pdf> */
-	0xfffffff0, 0x00082210,
-	CPUINFO_VENDOR_IBM, "PowerPC 750CXe",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 750CXr */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/A07229E92706089A87256DCD005BFBE9/$file/sw_ds_750cxr2-28-05.pdf> */
-	0xfffffff0, 0x00083410,
-	CPUINFO_VENDOR_IBM, "PowerPC 750CXr",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 750CL */
-	/* <http://www-01.ibm.com/chips/techlib/techlib.nsf/techdocs/2F33B5691BBB8769872571D10065F7D5/$file/750cldd2x_ds_v2.4_pub_29May2007.pdf> */
-	0xfffffff0, 0x00087210,
-	CPUINFO_VENDOR_IBM, "PowerPC 750CL",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 750FX */
-	0xffff0000, 0x70000000,
-	CPUINFO_VENDOR_IBM, "PowerPC 750FX",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_512KB }
-  },
-  { /* PowerPC 750FL */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/ED29A8828F4E10AB87256FDA00742D1D/$file/750FL_DS_6-22-06.pdf> */
-	0xffffffff, 0x700a02b3,
-	CPUINFO_VENDOR_IBM, "PowerPC 750FL",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_512KB }
-  },
-  { /* PowerPC 750FX */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/A571994FDFA77C3287256C31004AF7CD/$file/750fxdd2_ds.pdf> */
-	0xffffff00, 0x700a0200,
-	CPUINFO_VENDOR_IBM, "PowerPC 750FX",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_512KB }
-  },
-  { /* PowerPC 750GL */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/6C89C8231496F8198725700E00776940/$file/750GL_ds3-13-06.pdf> */
-	0xffffff0f, 0x70020102,
-	CPUINFO_VENDOR_IBM, "PowerPC 750GL",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_1MB }
-  },
-  { /* PowerPC 750GX */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/4D86B2273E8218CE87256E660058763D/$file/750GX_ds9-2-05.pdf> */
-	0xffff0000, 0x70020000,
-	CPUINFO_VENDOR_IBM, "PowerPC 750GX",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_1MB }
-  },
-  { /* PowerPC 750 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC750EC.pdf> */
-	0xffff0000, 0x00080000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 750",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* PowerPC 7400 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7400EC.pdf> */
-	0xffff0000, 0x000c0000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7400",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* PowerPC 7410 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7410EC.pdf> */
-	0xffff0000, 0x800c0000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7410",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB }
-  },
-  { /* PowerPC 7450 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7450EC.pdf> */
-	0xffff0000, 0x80000000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7450",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 7455 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7455EC.pdf> */
-	0xffff0000, 0x80010000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7455",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_256KB }
-  },
-  { /* PowerPC 7457 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7457EC.pdf> */
-	0xffff0000, 0x80020000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7457",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_512KB }
-  },
-  { /* PowerPC 7447A */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7447AEC.pdf> */
-	0xffff0000, 0x80030000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7447A",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_512KB }
-  },
-  { /* PowerPC 7448 */
-	/* <http://www.freescale.com/files/32bit/doc/data_sheet/MPC7448EC.pdf> */
-	0xffff0000, 0x80040000,
-	CPUINFO_VENDOR_MOTOROLA, "PowerPC 7448",
-	1, 1,
-	{ &L1I_32KB, &L1D_32KB, &L2_1MB }
-  },
-  {
-	/* PowerPC 970 */
-	0xffff0000, 0x00390000,
-	CPUINFO_VENDOR_IBM, "PowerPC 970",
-	1, 1,
-	{ &L1I_64KB, &L1D_32KB, &L2_512KB }
-  },
-  {
-	/* PowerPC 970FX */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/1DE505664D202D2987256D9C006B90A5/$file/PPC970FX_DS_DD3.X_V2.5_26MAR2007_pub.pdf> */
-	0xffff0000, 0x003c0000,
-	CPUINFO_VENDOR_IBM, "PowerPC 970FX",
-	1, 1,
-	{ &L1I_64KB, &L1D_32KB, &L2_512KB }
-  },
-  {
-	/* PowerPC 970GX */
-	/* <http://www-01.ibm.com/chips/techlib/techlib.nsf/techdocs/38356BF4A2CE57F68725720400632685/$file/PwrArch_10.06.06c.pdf> (XXX: find datasheet) */
-	0xffff0000, 0x00450000,
-	CPUINFO_VENDOR_IBM, "PowerPC 970GX",
-	1, 1,
-	{ &L1I_64KB, &L1D_32KB, &L2_1MB }
-  },
-  {
-	/* PowerPC 970MP */
-	/* <http://www-306.ibm.com/chips/techlib/techlib.nsf/techdocs/B9C08F2F7CF5709587256F8C006727F1/$file/970MP_DS_DD1.1x_v1.1_pub_29Mar2007.pdf> */
-	0xffff0000, 0x00440000,
-	CPUINFO_VENDOR_IBM, "PowerPC 970MP",
-	2, 1,
-	{ &L1I_64KB, &L1D_32KB, &L2_1MB }
-  },
-  {
-	/* POWER3 */
-	/* <http://www.redbooks.ibm.com/redbooks/pdfs/sg245155.pdf> */
-	0xffff0000, 0x00400000,
-	CPUINFO_VENDOR_IBM, "POWER3",
-	1, 1,
-	{ &L1I_32KB, &L1D_64KB } /* XXX: external L2 cache (1-16 MB), check L2CR? */
-  },
-  {
-	/* POWER3+ */
-	0xffff0000, 0x00410000,
-	CPUINFO_VENDOR_IBM, "POWER3+",
-	1, 1,
-	{ &L1I_32KB, &L1D_64KB } /* XXX: external L2 cache (1-16 MB), check L2CR? */
-  },
-  {
-	/* POWER4 */
-	/* <http://www.redbooks.ibm.com/redbooks/pdfs/sg247041.pdf> */
-	0xffff0000, 0x00350000,
-	CPUINFO_VENDOR_IBM, "POWER4",
-	2, 1,
-	{ &L1I_64KB, &L1D_32KB, &L2_1440KB, &L3_32MB } /* XXX: up to 128 MB shared on the same MCM */
-  },
-  {
-	/* POWER4+ */
-	0xffff0000, 0x00380000,
-	CPUINFO_VENDOR_IBM, "POWER4+",
-	2, 1,
-	{ &L1I_64KB, &L1D_32KB, &L2_1440KB, &L3_32MB } /* XXX: up to 128 MB shared on the same MCM */
-  },
-  {
-	/* POWER5 */
-	0xffff0000, 0x003a0000,
-	CPUINFO_VENDOR_IBM, "POWER5",
-	2, 2,
-	{ &L1I_64KB, &L1D_32KB, &L2_1920KB, &L3_36MB }
-  },
-  {
-	/* POWER5+ */
-	0xffff0000, 0x003b0000,
-	CPUINFO_VENDOR_IBM, "POWER5+",
-	2, 2,
-	{ &L1I_64KB, &L1D_32KB, &L2_1920KB, &L3_36MB }
-  },
-  {
-	/* POWER6 */
-	0xffff0000, 0x003e0000,
-	CPUINFO_VENDOR_IBM, "POWER6",
-	2, 2,
-	{ &L1I_64KB, &L1D_64KB, &L2_4MB, &L3_32MB }
-  },
-  {
-	/* Cell PPE */
-	0xffff0000, 0x00700000,
-	CPUINFO_VENDOR_IBM, "Cell",
-	1, 2,
-	{ &L1I_32KB, &L1D_32KB, &L2_512KB }
-  },
-  {
-	/* PA6T */
-	/* <http://www.pasemi.com/downloads/PA_Semi_PA6T_1682M.pdf> */
-	0xffff0000, 0x00900000,
-	CPUINFO_VENDOR_PASEMI, "PWRficient PA6T-1682M",
-	2, 1,
-	{ &L1I_64KB, &L1D_64KB, &L2_2MB }
-  },
-  { /* Unknown */
-	0x00000000, 0x00000000,
-	CPUINFO_VENDOR_UNKNOWN, NULL,
-	-1, -1,
-	{ NULL }
-  }
-};
-
 // Generic Processor Version Register (PVR) values
 enum {
   PVR_POWERPC_601		= 0x00010000,
@@ -730,25 +421,36 @@ int cpuinfo_dump(struct cpuinfo *cip, FILE *out)
 }
 
 // Get CPU spec
-static const ppc_spec_t *get_ppc_spec(struct cpuinfo *cip)
+static int get_ppc_spec(struct cpuinfo *cip, ppc_spec_t *spec)
 {
-  int i;
+  cpuinfo_db_table_t table;
+  if (cpuinfo_db_get_table(CPUINFO_DB_PPC_SPECS, 6 + N_CACHE_DESCRIPTORS, &table) < 0)
+	return -1;
+
   const uint32_t pvr = ((ppc_cpuinfo_t *)(cip->opaque))->pvr;
-  const int n_specs = sizeof(ppc_specs) / sizeof(ppc_specs[0]);
-  for (i = 0; i < n_specs; i++) {
-	const ppc_spec_t *spec = &ppc_specs[i];
-	if ((pvr & spec->pvr_mask) == spec->pvr_value)
-	  return spec;
+  const cpuinfo_db_record_t *rp = cpuinfo_db_lookup_masked(&table, pvr, 1);
+  if (rp == NULL)
+	return -1;
+
+  int i;
+  spec->vendor = cpuinfo_db_field(rp, 2);
+  spec->model = cpuinfo_db_string(rp, 3);
+  spec->n_cores = cpuinfo_db_field(rp, 4);
+  spec->n_threads = cpuinfo_db_field(rp, 5);
+  spec->n_caches = 0;
+  for (i = 0; i < N_CACHE_DESCRIPTORS; i++) {
+	if (cpuinfo_db_cache(rp, 6 + i, &spec->caches[spec->n_caches]) == 0)
+	  spec->n_caches++;
   }
-  return NULL;
+  return 0;
 }
 
 // Get processor vendor ID 
 int cpuinfo_arch_get_vendor(struct cpuinfo *cip)
 {
-  const ppc_spec_t *spec = get_ppc_spec(cip);
-  if (spec)
-	return spec->vendor;
+  ppc_spec_t spec;
+  if (get_ppc_spec(cip, &spec) == 0)
+	return spec.vendor;
 
   return CPUINFO_VENDOR_UNKNOWN;
 }
@@ -756,18 +458,30 @@ int cpuinfo_arch_get_vendor(struct cpuinfo *cip)
 // Get processor name
 char *cpuinfo_arch_get_model(struct cpuinfo *cip)
 {
-  const ppc_spec_t *spec = get_ppc_spec(cip);
-  if (spec && spec->model) {
-	char *model = (char *)malloc(strlen(spec->model) + 1);
+  ppc_spec_t spec;
+  if (get_ppc_spec(cip, &spec) == 0 && spec.model) {
+	char *model = (char *)malloc(strlen(spec.model) + 1);
 	if (model == NULL)
 	  return NULL;
-	strcpy(model, spec->model);
+	strcpy(model, spec.model);
 	return model;
   }
 
   return NULL;
 }
 
+// Get processor signature (family, model, stepping)
+uint32_t cpuinfo_arch_get_signature(struct cpuinfo *cip)
+{
+  return ((ppc_cpuinfo_t *)(cip->opaque))->pvr;
+}
+
+// Get processor microarchitecture (of the current core if CORE_TYPE is unknown)
+int cpuinfo_arch_get_uarch(struct cpuinfo *cip, int core_type)
+{
+  return -1;
+}
+
 // Get processor frequency in MHz
 int cpuinfo_arch_get_frequency(struct cpuinfo *cip)
 {
@@ -787,9 +501,9 @@ int cpuinfo_arch_get_socket(struct cpuinfo *cip)
 // Get number of cores per CPU package
 int cpuinfo_arch_get_cores(struct cpuinfo *cip)
 {
-  const ppc_spec_t *spec = get_ppc_spec(cip);
-  if (spec)
-	return spec->n_cores;
+  ppc_spec_t spec;
+  if (get_ppc_spec(cip, &spec) == 0)
+	return spec.n_cores;
 
   return -1;
 }
@@ -797,9 +511,9 @@ int cpuinfo_arch_get_cores(struct cpuinfo *cip)
 // Get number of threads per CPU core
 int cpuinfo_arch_get_threads(struct cpuinfo *cip)
 {
-  const ppc_spec_t *spec = get_ppc_spec(cip);
-  if (spec)
-	return spec->n_threads;
+  ppc_spec_t spec;
+  if (get_ppc_spec(cip, &spec) == 0)
+	return spec.n_threads;
 
   return -1;
 }
@@ -857,30 +571,78 @@ static int decode_l3cr(struct cpuinfo *cip, cpuinfo_cache_descriptor_t *cdp)
   return -1;
 }
 
-// Get cache information
-cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
+// Get type of the current processor core
+int cpuinfo_arch_get_core_type(struct cpuinfo *cip, int *native_model)
 {
-  const ppc_spec_t *spec = get_ppc_spec(cip);
-  if (spec) {
-	cpuinfo_list_t caches_list = NULL;
-	int i;
-	for (i = 0; i < N_CACHE_DESCRIPTORS; i++) {
-	  if (spec->caches[i])
-		cpuinfo_caches_list_insert(spec->caches[i]);
-	}
+  *native_model = -1;
+  return CPUINFO_CORE_TYPE_UNKNOWN;
+}
 
-	cpuinfo_cache_descriptor_t cache_desc;
-	if (decode_l2cr(cip, &cache_desc) == 0)
-	  cpuinfo_caches_list_insert(&cache_desc);
-	if (decode_l3cr(cip, &cache_desc) == 0)
-	  cpuinfo_caches_list_insert(&cache_desc);
+// Get extended state components enabled by the OS
+int cpuinfo_arch_get_xsave_info(struct cpuinfo *cip, cpuinfo_xsave_t *xsp)
+{
+  return -1;
+}
 
-	return caches_list;
-  }
+// Get AMX tile palette information
+int cpuinfo_arch_get_tile_info(struct cpuinfo *cip, cpuinfo_tile_info_t *tip)
+{
+  return -1;
+}
+
+// Request permission to use AMX tile data
+int cpuinfo_arch_request_tile_permission(struct cpuinfo *cip)
+{
+  return 0;
+}
+
+// Returns 1 if the processor supports pages of SIZE KB, 0 if not, -1 if unknown
+int cpuinfo_arch_has_page_size(struct cpuinfo *cip, int size)
+{
+  return -1;
+}
+
+// Get hardware prefetch size in bytes
+int cpuinfo_arch_get_prefetch_size(struct cpuinfo *cip)
+{
+  return 0;
+}
 
+// Get TLB information
+cpuinfo_list_t cpuinfo_arch_get_tlbs(struct cpuinfo *cip)
+{
   return NULL;
 }
 
+// Get virtualizer and paravirtual timing information
+int cpuinfo_arch_get_virtualizer(struct cpuinfo *cip, cpuinfo_virtualizer_info_t *vip)
+{
+  return -1;
+}
+
+// Get cache information
+cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
+{
+  cpuinfo_list_t caches_list = NULL;
+  ppc_spec_t spec;
+  int i;
+  if (get_ppc_spec(cip, &spec) == 0) {
+	for (i = 0; i < spec.n_caches; i++)
+	  cpuinfo_caches_list_insert(&spec.caches[i]);
+  }
+
+  cpuinfo_cache_descriptor_t cache_desc;
+  cache_desc.sharing = 0;
+  cache_desc.line_size = 0;
+  cache_desc.ways = 0;
+  if (decode_l2cr(cip, &cache_desc) == 0)
+	cpuinfo_caches_list_insert(&cache_desc);
+  if (decode_l3cr(cip, &cache_desc) == 0)
+	cpuinfo_caches_list_insert(&cache_desc);
+
+  return caches_list;
+}
+
 // Returns features table
 uint32_t *cpuinfo_arch_feature_table(struct cpuinfo *cip, int feature)
 {
@@ -973,3 +735,70 @@ int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
 
   return cpuinfo_feature_get_bit(cip, feature);
 }
+
+// Returns 1 if the processor reports the specified feature
+int cpuinfo_arch_has_hardware_feature(struct cpuinfo *cip, int feature)
+{
+  return cpuinfo_arch_has_feature(cip, feature);
+}
+
+// Returns the name of the feature as reported by the OS, or NULL if it is not reported
+const char *cpuinfo_arch_feature_os_name(int feature, int *linux_version)
+{
+  return NULL;
+}
+
+// Get the AT_HWCAP bit for the feature (returns -1 if there is none)
+int cpuinfo_arch_feature_hwcap(int feature, int *hwcap, unsigned long *mask)
+{
+  if (feature == CPUINFO_FEATURE_PPC_VMX) {
+	*hwcap = 1;
+	*mask = 0x10000000; // PPC_FEATURE_HAS_ALTIVEC
+	return 0;
+  }
+  return -1;
+}
+
+// Execute advertised features, returns the number of features that faulted
+int cpuinfo_arch_verify_features(struct cpuinfo *cip)
+{
+  // features are already detected by executing them
+  return 0;
+}
+
+// AT_HWCAP bits (PPC_FEATURE_*)
+#define PPC_FEATURE_HAS_ALTIVEC		0x10000000
+#define PPC_FEATURE_POWER4			0x00080000
+#define PPC_FEATURE_POWER5			0x00040000
+#define PPC_FEATURE_POWER5_PLUS		0x00020000
+#define PPC_FEATURE_ARCH_2_05		0x00001000
+#define PPC_FEATURE_POWER6_EXT		0x00000200
+#define PPC_FEATURE_ARCH_2_06		0x00000100
+
+// Fill FEATURES without allocating memory nor calling the C library, returns the feature class
+int cpuinfo_arch_resolver_features(uint32_t *features, unsigned long hwcap)
+{
+  // test functions need a signal handler, rely on the ISA level reported by the kernel
+  const unsigned long isa_2_03 = PPC_FEATURE_POWER5_PLUS | PPC_FEATURE_ARCH_2_05 | PPC_FEATURE_ARCH_2_06;
+  const unsigned long isa_2_02 = PPC_FEATURE_POWER5 | isa_2_03;
+  const unsigned long isa_2_01 = PPC_FEATURE_POWER4 | isa_2_02;
+
+#define set_bit(NAME) features[(CPUINFO_FEATURE_PPC_##NAME & CPUINFO_FEATURE_MASK) / 32] |= \
+		1U << ((CPUINFO_FEATURE_PPC_##NAME & CPUINFO_FEATURE_MASK) % 32)
+  features[0] |= 1;
+  if (hwcap & PPC_FEATURE_HAS_ALTIVEC)
+	set_bit(VMX);
+  if (hwcap & isa_2_01) {
+	set_bit(FSQRT);
+	set_bit(FSEL);
+	set_bit(MFCRF);
+  }
+  if (hwcap & isa_2_02)
+	set_bit(POPCNTB);
+  if (hwcap & isa_2_03)
+	set_bit(FPRND);
+  if (hwcap & PPC_FEATURE_POWER6_EXT)
+	set_bit(MFPGPR);
+#undef set_bit
+  return CPUINFO_FEATURE_PPC;
+}
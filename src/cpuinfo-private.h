@@ -28,14 +28,32 @@ extern "C" {
 #define CPUINFO_FEATURES_SZ_(NAME) \
 		(1 + ((CPUINFO_FEATURE_##NAME##_MAX - CPUINFO_FEATURE_##NAME) / 32))
 
+// Number of cache levels indexed by cpuinfo_get_cache(), level 0 is the trace cache
+#define CPUINFO_CACHE_LEVELS 5
+
 struct cpuinfo {
   int vendor;											// CPU vendor
   char *model;											// CPU model name
+  char host_id[17];										// Host identifier, empty until computed
+  int uarch;											// CPU microarchitecture
   int frequency;										// CPU frequency in MHz
   int socket;											// CPU socket type
   int n_cores;											// Number of CPU cores
   int n_threads;										// Number of threads per CPU core
+  int prefetch_size;									// Hardware prefetch size in bytes
   cpuinfo_cache_t cache_info;							// Cache descriptors
+  const cpuinfo_cache_descriptor_t *cache_index[CPUINFO_CACHE_LEVELS][CPUINFO_CACHE_TYPE_TRACE + 1]; // Caches by level and type
+  cpuinfo_tlb_t tlb_info;								// TLB descriptors
+  cpuinfo_core_complexes_t core_complexes;				// Last-level cache domains
+  cpuinfo_processors_t processors;						// Logical processors
+  cpuinfo_xsave_t xsave_info;							// Extended state components
+  cpuinfo_virtualizer_info_t virtualizer_info;			// Virtualizer information
+  cpuinfo_uarch_info_t *uarch_infos;					// Microarchitecture characteristics
+  int n_uarch_infos;									// Number of microarchitecture descriptors
+  char *os_flags;										// Features reported by the OS
+  int has_os_flags;										// Whether the OS features are available
+  int os_version;										// Linux version reporting the OS features
+  struct cpuinfo_list *faulted_features;				// Features that faulted when executed
   uint32_t features[CPUINFO_FEATURES_SZ_(COMMON)];		// Common CPU features
   void *opaque;											// Arch-dependent data
 };
@@ -63,6 +81,103 @@ extern int cpuinfo_list_insert(cpuinfo_list_t *lp, const void *ptr, int size) at
   }													\
 } while (0)
 
+#define cpuinfo_tlbs_list_insert(PTR) do {			\
+  if (cpuinfo_list_insert(&tlbs_list, PTR) < 0) {	\
+	cpuinfo_list_clear(&tlbs_list);					\
+	return NULL;									\
+  }													\
+} while (0)
+
+/* ========================================================================= */
+/* == System Information                                                  == */
+/* ========================================================================= */
+
+// Read first line of file FORMAT into BUF (returns -1 if file doesn't exist)
+extern int cpuinfo_sysfs_read_string(char *buf, int size, const char *format, ...) attribute_hidden;
+
+// Read integer from file FORMAT (returns -1 if file doesn't exist)
+extern int cpuinfo_sysfs_read_int(int *value, const char *format, ...) attribute_hidden;
+
+// Parse CPU list (e.g. "0-3,8-11"), returns the number of CPUs or -1 on error
+extern int cpuinfo_parse_cpu_list(const char *str, int **cpus) attribute_hidden;
+
+// Get environment variable NAME, ignored in setuid and setgid programs
+extern const char *cpuinfo_getenv(const char *name) attribute_hidden;
+
+// Initial value of FNV-1a hashes
+#define CPUINFO_HASH_INIT 0xcbf29ce484222325ULL
+
+// FNV-1a hash of SIZE bytes of DATA, continuing from HASH
+extern uint64_t cpuinfo_hash_bytes(uint64_t hash, const void *data, size_t size) attribute_hidden;
+
+/* ========================================================================= */
+/* == Data Tables                                                         == */
+/* ========================================================================= */
+
+// Tables of cpuinfo-data.def, the record layouts are documented there
+typedef enum {
+  CPUINFO_DB_INTEL_CACHE = 1,
+  CPUINFO_DB_INTEL_TLB,
+  CPUINFO_DB_INTEL_BRAND,
+  CPUINFO_DB_AMD_K8_BRAND,
+  CPUINFO_DB_AMD_NPT_BRAND,
+  CPUINFO_DB_PPC_SPECS,
+  CPUINFO_DB_MIPS_SPECS,
+  CPUINFO_DB_MASKS = 0x100,		// distinct masks of a masked table, most specific first
+  CPUINFO_DB_INDEX = 0x200		// 1 + first record of each key of a table keyed by bytes, 0 if none
+} cpuinfo_db_table_id_t;
+
+typedef struct cpuinfo_db_record cpuinfo_db_record_t;
+
+typedef struct {
+  int id;						// table ID
+  int n_fields;					// number of fields per record
+  int n_records;				// number of records, sorted by their first field
+  const cpuinfo_db_record_t *records;
+  const uint8_t *index;			// direct index of the 256 byte keys, NULL if there is none
+} cpuinfo_db_table_t;
+
+// Get table ID with at least N_FIELDS fields per record (returns -1 if there is none)
+extern int cpuinfo_db_get_table(int id, int n_fields, cpuinfo_db_table_t *tp) attribute_hidden;
+
+// Returns the first record whose key (field 0) is KEY, or NULL if there is none
+extern const cpuinfo_db_record_t *cpuinfo_db_lookup(const cpuinfo_db_table_t *tp, uint32_t key) attribute_hidden;
+
+// Returns the record following RP if it has the same key, or NULL
+extern const cpuinfo_db_record_t *cpuinfo_db_next(const cpuinfo_db_table_t *tp, const cpuinfo_db_record_t *rp) attribute_hidden;
+
+// Returns the most specific record such that (VALUE & field MASK_FIELD) == key, or NULL
+extern const cpuinfo_db_record_t *cpuinfo_db_lookup_masked(const cpuinfo_db_table_t *tp, uint32_t value, int mask_field) attribute_hidden;
+
+// Returns field N of record RP
+extern uint32_t cpuinfo_db_field(const cpuinfo_db_record_t *rp, int n) attribute_hidden;
+
+// Returns the string stored into field N of record RP, or NULL if there is none
+extern const char *cpuinfo_db_string(const cpuinfo_db_record_t *rp, int n) attribute_hidden;
+
+// Decode a cache descriptor packed by the generator (returns -1 if there is none)
+extern int cpuinfo_db_cache(const cpuinfo_db_record_t *rp, int n, cpuinfo_cache_descriptor_t *cdp) attribute_hidden;
+
+/* ========================================================================= */
+/* == Processor Topology Information                                      == */
+/* ========================================================================= */
+
+// Release all topology information
+extern void cpuinfo_topology_destroy(struct cpuinfo *cip) attribute_hidden;
+
+// Run FUNC on logical processor CPU (returns -1 if the thread could not be bound to CPU)
+extern int cpuinfo_run_on_cpu(int cpu, void (*func)(void *), void *arg) attribute_hidden;
+
+/* ========================================================================= */
+/* == Microarchitecture Characteristics                                   == */
+/* ========================================================================= */
+
+// Returns the microarchitecture named NAME (case insensitive), or -1 if there is none
+extern int cpuinfo_uarch_of_string(const char *name) attribute_hidden;
+
+// Release microarchitecture characteristics
+extern void cpuinfo_uarch_info_destroy(struct cpuinfo *cip) attribute_hidden;
+
 /* ========================================================================= */
 /* == Processor Features Information                                      == */
 /* ========================================================================= */
@@ -76,6 +191,10 @@ extern int cpuinfo_feature_test_function(cpuinfo_feature_test_function_t func) a
 // Accessors for cpuinfo_features[] table
 extern int cpuinfo_feature_get_bit(struct cpuinfo *cip, int feature) attribute_hidden;
 extern void cpuinfo_feature_set_bit(struct cpuinfo *cip, int feature) attribute_hidden;
+extern void cpuinfo_feature_clear_bit(struct cpuinfo *cip, int feature) attribute_hidden;
+
+// Mark feature as advertised but faulting when executed
+extern void cpuinfo_feature_set_faulted(struct cpuinfo *cip, int feature) attribute_hidden;
 
 /* ========================================================================= */
 /* == Arch-specific Interface                                             == */
@@ -93,6 +212,12 @@ extern int cpuinfo_arch_get_vendor(struct cpuinfo *cip) attribute_hidden;
 // Get processor name
 extern char *cpuinfo_arch_get_model(struct cpuinfo *cip) attribute_hidden;
 
+// Get processor signature (family, model, stepping)
+extern uint32_t cpuinfo_arch_get_signature(struct cpuinfo *cip) attribute_hidden;
+
+// Get processor microarchitecture (of the current core if CORE_TYPE is unknown)
+extern int cpuinfo_arch_get_uarch(struct cpuinfo *cip, int core_type) attribute_hidden;
+
 // Get processor frequency in MHz
 extern int cpuinfo_arch_get_frequency(struct cpuinfo *cip) attribute_hidden;
 
@@ -105,15 +230,59 @@ extern int cpuinfo_arch_get_cores(struct cpuinfo *cip) attribute_hidden;
 // Get number of threads per CPU core
 extern int cpuinfo_arch_get_threads(struct cpuinfo *cip) attribute_hidden;
 
+// Get type of the current processor core
+extern int cpuinfo_arch_get_core_type(struct cpuinfo *cip, int *native_model) attribute_hidden;
+
+// Get extended state components enabled by the OS
+extern int cpuinfo_arch_get_xsave_info(struct cpuinfo *cip, cpuinfo_xsave_t *xsp) attribute_hidden;
+
+// Get AMX tile palette information
+extern int cpuinfo_arch_get_tile_info(struct cpuinfo *cip, cpuinfo_tile_info_t *tip) attribute_hidden;
+
+// Request permission to use AMX tile data
+extern int cpuinfo_arch_request_tile_permission(struct cpuinfo *cip) attribute_hidden;
+
+// Get virtualizer and paravirtual timing information
+extern int cpuinfo_arch_get_virtualizer(struct cpuinfo *cip, cpuinfo_virtualizer_info_t *vip) attribute_hidden;
+
 // Get cache information (returns the number of caches detected)
 extern cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip) attribute_hidden;
 
+// Get hardware prefetch size in bytes (0 if unknown)
+extern int cpuinfo_arch_get_prefetch_size(struct cpuinfo *cip) attribute_hidden;
+
+// Returns 1 if the processor supports pages of SIZE KB, 0 if not, -1 if unknown
+extern int cpuinfo_arch_has_page_size(struct cpuinfo *cip, int size) attribute_hidden;
+
+// Get TLB information
+extern cpuinfo_list_t cpuinfo_arch_get_tlbs(struct cpuinfo *cip) attribute_hidden;
+
 // Returns features table
 extern uint32_t *cpuinfo_arch_feature_table(struct cpuinfo *cip, int feature) attribute_hidden;
 
 // Returns 1 if CPU supports the specified feature
 extern int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature) attribute_hidden;
 
+// Returns 1 if the processor reports the specified feature, regardless of OS support
+extern int cpuinfo_arch_has_hardware_feature(struct cpuinfo *cip, int feature) attribute_hidden;
+
+// Execute advertised features, returns the number of features that faulted
+extern int cpuinfo_arch_verify_features(struct cpuinfo *cip) attribute_hidden;
+
+// Fill FEATURES without allocating memory nor calling the C library, returns the feature class.
+// This and its callees must be built without the stack protector
+extern int cpuinfo_arch_resolver_features(uint32_t *features, unsigned long hwcap) attribute_hidden attribute_no_stack_protector;
+
+// Linux kernel version number
+#define CPUINFO_LINUX_VERSION(a, b, c) (((a) << 16) | ((b) << 8) | (c))
+
+// Returns the name of the feature as reported by the OS and the first Linux version reporting it,
+// or NULL if it is not reported
+extern const char *cpuinfo_arch_feature_os_name(int feature, int *linux_version) attribute_hidden;
+
+// Get the AT_HWCAP bit for the feature (returns -1 if there is none)
+extern int cpuinfo_arch_feature_hwcap(int feature, int *hwcap, unsigned long *mask) attribute_hidden;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,780 @@
+/*
+ *  cpuinfo-topology.c - Processor topology information
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#define _GNU_SOURCE 1 /* sched_setaffinity() */
+#include "sysdeps.h"
+#include <unistd.h>
+#include <dirent.h>
+#include <errno.h>
+#ifdef HAVE_SCHED_SETAFFINITY
+#include <sched.h>
+#endif
+#include "cpuinfo.h"
+#include "cpuinfo-private.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+static const char sysfs_cpu[] = "/sys/devices/system/cpu";
+static const char proc_cgroup[] = "/proc/self/cgroup";
+static const char proc_mountinfo[] = "/proc/self/mountinfo";
+
+#define AFFINITY_MAX_CPUS	(1 << 20)		// largest affinity mask tried, in processors
+
+// Logical processor information
+typedef struct {
+  int id;		// logical processor number
+  int package;	// physical package ID
+  int core;		// core ID within the package
+  int node;		// NUMA node
+  int llc;		// first logical processor sharing the same last-level cache
+  int llc_level;
+  int llc_size;
+} cpu_info_t;
+
+// Get the list of online logical processors
+static int get_online_cpus(int **cpus)
+{
+  char line[4096];
+  if (cpuinfo_sysfs_read_string(line, sizeof(line), "%s/online", sysfs_cpu) == 0)
+	return cpuinfo_parse_cpu_list(line, cpus);
+
+  // assume logical processors are numbered contiguously
+  int i, n_cpus = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+  n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (n_cpus < 1)
+	n_cpus = 1;
+#endif
+  if ((*cpus = (int *)malloc(n_cpus * sizeof(**cpus))) == NULL)
+	return -1;
+  for (i = 0; i < n_cpus; i++)
+	(*cpus)[i] = i;
+  return n_cpus;
+}
+
+// Get NUMA node of logical processor CPU
+static int get_cpu_node(int cpu)
+{
+  char path[256];
+  sprintf(path, "%s/cpu%d", sysfs_cpu, cpu);
+  DIR *d = opendir(path);
+  if (d == NULL)
+	return -1;
+  int node = -1;
+  struct dirent *de;
+  while ((de = readdir(d)) != NULL) {
+	if (sscanf(de->d_name, "node%d", &node) == 1)
+	  break;
+	node = -1;
+  }
+  closedir(d);
+  return node;
+}
+
+// Get last-level cache information of logical processor CPU from sysfs
+static int get_cpu_llc(cpu_info_t *cp)
+{
+  int index, level;
+  char str[4096];
+  cp->llc = -1;
+  cp->llc_level = 0;
+  cp->llc_size = 0;
+  for (index = 0; cpuinfo_sysfs_read_int(&level, "%s/cpu%d/cache/index%d/level", sysfs_cpu, cp->id, index) == 0; index++) {
+	if (level <= cp->llc_level)
+	  continue;
+	if (cpuinfo_sysfs_read_string(str, sizeof(str), "%s/cpu%d/cache/index%d/type", sysfs_cpu, cp->id, index) < 0
+		|| strcmp(str, "Instruction") == 0)
+	  continue;
+	if (cpuinfo_sysfs_read_string(str, sizeof(str), "%s/cpu%d/cache/index%d/shared_cpu_list", sysfs_cpu, cp->id, index) < 0)
+	  continue;
+	int *cpus, n_cpus = cpuinfo_parse_cpu_list(str, &cpus);
+	if (n_cpus <= 0)
+	  continue;
+	cp->llc = cpus[0];
+	cp->llc_level = level;
+	free(cpus);
+	if (cpuinfo_sysfs_read_string(str, sizeof(str), "%s/cpu%d/cache/index%d/size", sysfs_cpu, cp->id, index) == 0) {
+	  char unit = 'K';
+	  if (sscanf(str, "%d%c", &cp->llc_size, &unit) >= 1 && unit == 'M')
+		cp->llc_size *= 1024;
+	}
+  }
+  return cp->llc >= 0 ? 0 : -1;
+}
+
+// Get logical processors information, returns the number of logical processors
+static int get_cpu_infos(struct cpuinfo *cip, cpu_info_t **cpu_infos)
+{
+  int i, *cpus, n_cpus = get_online_cpus(&cpus);
+  if (n_cpus <= 0)
+	return -1;
+
+  cpu_info_t *cps = (cpu_info_t *)malloc(n_cpus * sizeof(*cps));
+  if (cps == NULL) {
+	free(cpus);
+	return -1;
+  }
+
+  int has_llc_info = 1;
+  for (i = 0; i < n_cpus; i++) {
+	cpu_info_t *cp = &cps[i];
+	cp->id = cpus[i];
+	if (cpuinfo_sysfs_read_int(&cp->package, "%s/cpu%d/topology/physical_package_id", sysfs_cpu, cp->id) < 0)
+	  cp->package = 0;
+	if (cpuinfo_sysfs_read_int(&cp->core, "%s/cpu%d/topology/core_id", sysfs_cpu, cp->id) < 0)
+	  cp->core = -1;
+	cp->node = get_cpu_node(cp->id);
+	if (get_cpu_llc(cp) < 0)
+	  has_llc_info = 0;
+  }
+  free(cpus);
+
+  if (!has_llc_info) {
+	// derive last-level cache domains from the cache descriptors, assuming
+	// logical processors sharing a cache are numbered contiguously
+	// XXX OS numbering does not necessarily follow APIC IDs
+	const cpuinfo_cache_t *ccp = cpuinfo_get_caches(cip);
+	const cpuinfo_cache_descriptor_t *llc = NULL;
+	if (ccp) {
+	  for (i = 0; i < ccp->count; i++) {
+		const cpuinfo_cache_descriptor_t *cdp = &ccp->descriptors[i];
+		if (cdp->type != CPUINFO_CACHE_TYPE_DATA && cdp->type != CPUINFO_CACHE_TYPE_UNIFIED)
+		  continue;
+		if (llc == NULL || cdp->level > llc->level)
+		  llc = cdp;
+	  }
+	}
+	int sharing = llc && llc->sharing > 0 ? llc->sharing : n_cpus;
+	int n_threads = cpuinfo_get_threads(cip);
+	for (i = 0; i < n_cpus; i++) {
+	  cpu_info_t *cp = &cps[i];
+	  cp->llc = cps[(i / sharing) * sharing].id;
+	  cp->llc_level = llc ? llc->level : 0;
+	  cp->llc_size = llc ? llc->size : 0;
+	  if (cp->core < 0)
+		cp->core = i / n_threads;
+	}
+  }
+
+  *cpu_infos = cps;
+  return n_cpus;
+}
+
+// Get groups of cores sharing a last-level cache (returns read-only descriptors)
+const cpuinfo_core_complexes_t *cpuinfo_get_core_complexes(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return NULL;
+  if (cip->core_complexes.count < 0) {
+	int i, j, k, count = 0;
+	cpuinfo_core_complex_t *complexes = NULL;
+	cpu_info_t *cps;
+	int n_cpus = get_cpu_infos(cip, &cps);
+	if (n_cpus > 0) {
+	  if ((complexes = (cpuinfo_core_complex_t *)calloc(n_cpus, sizeof(*complexes))) != NULL) {
+		for (i = 0; i < n_cpus; i++) {
+		  cpu_info_t *cp = &cps[i];
+		  if (cp->llc != cp->id)
+			continue;
+		  int n_complex_cpus = 0;
+		  for (j = 0; j < n_cpus; j++) {
+			if (cps[j].llc == cp->id)
+			  ++n_complex_cpus;
+		  }
+		  int *cpus = (int *)malloc(n_complex_cpus * sizeof(*cpus));
+		  if (cpus == NULL) {
+			// don't return partial topology
+			while (count > 0)
+			  free((void *)complexes[--count].cpus);
+			free(complexes);
+			complexes = NULL;
+			break;
+		  }
+		  cpuinfo_core_complex_t *ccp = &complexes[count++];
+		  ccp->cpus = cpus;
+		  ccp->cache_level = cp->llc_level;
+		  ccp->cache_size = cp->llc_size;
+		  ccp->node = cp->node;
+		  for (j = 0; j < n_cpus; j++) {
+			if (cps[j].llc != cp->id)
+			  continue;
+			cpus[ccp->n_cpus++] = cps[j].id;
+			// count distinct physical cores
+			for (k = 0; k < j; k++) {
+			  if (cps[k].llc == cp->id && cps[k].package == cps[j].package && cps[k].core == cps[j].core)
+				break;
+			}
+			if (k == j)
+			  ++ccp->n_cores;
+		  }
+		}
+	  }
+	  free(cps);
+	}
+	cip->core_complexes.count = count;
+	cip->core_complexes.complexes = complexes;
+  }
+  return &cip->core_complexes;
+}
+
+#ifdef HAVE_SCHED_SETAFFINITY
+// Get the affinity mask of the calling thread (returns NULL on error)
+// The kernel rejects masks smaller than its own, which may exceed cpu_set_t
+static cpu_set_t *get_affinity_mask(size_t *mask_size)
+{
+  int n_mask_cpus;
+  for (n_mask_cpus = CPU_SETSIZE; n_mask_cpus <= AFFINITY_MAX_CPUS; n_mask_cpus *= 2) {
+	cpu_set_t *mask = CPU_ALLOC(n_mask_cpus);
+	if (mask == NULL)
+	  break;
+	*mask_size = CPU_ALLOC_SIZE(n_mask_cpus);
+	if (sched_getaffinity(0, *mask_size, mask) == 0)
+	  return mask;
+	CPU_FREE(mask);
+	if (errno != EINVAL)
+	  break;
+  }
+  return NULL;
+}
+#endif
+
+// Run FUNC on logical processor CPU (returns -1 if the thread could not be bound to CPU)
+int cpuinfo_run_on_cpu(int cpu, void (*func)(void *), void *arg)
+{
+#ifdef HAVE_SCHED_SETAFFINITY
+  if (cpu < 0)
+	return -1;
+  size_t mask_size;
+  cpu_set_t *old_mask = get_affinity_mask(&mask_size);
+  if (old_mask == NULL)
+	return -1;
+  int ret = -1;
+  cpu_set_t *mask = CPU_ALLOC(cpu + 1);
+  if (mask) {
+	size_t size = CPU_ALLOC_SIZE(cpu + 1);
+	CPU_ZERO_S(size, mask);
+	CPU_SET_S(cpu, size, mask);
+	if (sched_setaffinity(0, size, mask) == 0) {
+	  func(arg);
+	  sched_setaffinity(0, mask_size, old_mask);
+	  ret = 0;
+	}
+	CPU_FREE(mask);
+  }
+  CPU_FREE(old_mask);
+  return ret;
+#else
+  return -1;
+#endif
+}
+
+// Get core type of logical processors from sysfs CPU types (Linux >= 6.x)
+static int get_sysfs_core_type(int cpu)
+{
+  char path[256], str[4096];
+  sprintf(path, "%s/types", sysfs_cpu);
+  DIR *d = opendir(path);
+  if (d == NULL)
+	return CPUINFO_CORE_TYPE_UNKNOWN;
+  int core_type = CPUINFO_CORE_TYPE_UNKNOWN;
+  struct dirent *de;
+  while (core_type == CPUINFO_CORE_TYPE_UNKNOWN && (de = readdir(d)) != NULL) {
+	int type;
+	if (strstr(de->d_name, "_core") != NULL)
+	  type = CPUINFO_CORE_TYPE_PERFORMANCE;
+	else if (strstr(de->d_name, "_atom") != NULL)
+	  type = CPUINFO_CORE_TYPE_EFFICIENCY;
+	else
+	  continue;
+	if (cpuinfo_sysfs_read_string(str, sizeof(str), "%s/%s/cpulist", path, de->d_name) < 0)
+	  continue;
+	int i, *cpus, n_cpus = cpuinfo_parse_cpu_list(str, &cpus);
+	if (n_cpus <= 0)
+	  continue;
+	for (i = 0; i < n_cpus; i++) {
+	  if (cpus[i] == cpu) {
+		core_type = type;
+		break;
+	  }
+	}
+	free(cpus);
+  }
+  closedir(d);
+  return core_type;
+}
+
+// Get core type of logical processors from hybrid PMU devices
+static int get_pmu_core_type(int cpu)
+{
+  static const struct {
+	const char *name;
+	int core_type;
+  } pmus[] = {
+	{ "cpu_core", CPUINFO_CORE_TYPE_PERFORMANCE },
+	{ "cpu_atom", CPUINFO_CORE_TYPE_EFFICIENCY }
+  };
+  char str[4096];
+  int i, j;
+  for (i = 0; i < sizeof(pmus) / sizeof(pmus[0]); i++) {
+	if (cpuinfo_sysfs_read_string(str, sizeof(str), "/sys/bus/event_source/devices/%s/cpus", pmus[i].name) < 0)
+	  continue;
+	int *cpus, n_cpus = cpuinfo_parse_cpu_list(str, &cpus);
+	if (n_cpus <= 0)
+	  continue;
+	for (j = 0; j < n_cpus; j++) {
+	  if (cpus[j] == cpu)
+		break;
+	}
+	free(cpus);
+	if (j < n_cpus)
+	  return pmus[i].core_type;
+  }
+  return CPUINFO_CORE_TYPE_UNKNOWN;
+}
+
+// Get performance levels of logical processor from ACPI CPPC and cpufreq
+static void get_cpu_perf(cpuinfo_processor_t *pp)
+{
+  if (cpuinfo_sysfs_read_int(&pp->highest_perf, "%s/cpu%d/acpi_cppc/highest_perf", sysfs_cpu, pp->id) < 0)
+	pp->highest_perf = -1;
+  if (cpuinfo_sysfs_read_int(&pp->nominal_perf, "%s/cpu%d/acpi_cppc/nominal_perf", sysfs_cpu, pp->id) < 0)
+	pp->nominal_perf = -1;
+
+  // Intel SST-BF exposes per-core guaranteed frequencies (kHz)
+  int freq;
+  pp->base_frequency = -1;
+  if (cpuinfo_sysfs_read_int(&freq, "%s/cpu%d/cpufreq/base_frequency", sysfs_cpu, pp->id) == 0)
+	pp->base_frequency = freq / 1000;
+  pp->max_frequency = -1;
+  if (cpuinfo_sysfs_read_int(&freq, "%s/cpu%d/cpufreq/cpuinfo_max_freq", sysfs_cpu, pp->id) == 0)
+	pp->max_frequency = freq / 1000;
+}
+
+// Compare performance levels of two logical processors (fastest first)
+static int processor_perf_compare(const cpuinfo_processor_t *a, const cpuinfo_processor_t *b)
+{
+  if (a->highest_perf != b->highest_perf)
+	return b->highest_perf - a->highest_perf;
+  if (a->nominal_perf != b->nominal_perf)
+	return b->nominal_perf - a->nominal_perf;
+  if (a->base_frequency != b->base_frequency)
+	return b->base_frequency - a->base_frequency;
+  if (a->max_frequency != b->max_frequency)
+	return b->max_frequency - a->max_frequency;
+  return b->capacity - a->capacity;
+}
+
+static int processor_rank_compare(const void *a, const void *b)
+{
+  const cpuinfo_processor_t *pa = *(const cpuinfo_processor_t **)a;
+  const cpuinfo_processor_t *pb = *(const cpuinfo_processor_t **)b;
+  int ret = processor_perf_compare(pa, pb);
+  if (ret == 0)
+	ret = pa->id - pb->id;
+  return ret;
+}
+
+typedef struct {
+  struct cpuinfo *cip;
+  cpuinfo_processor_t *pp;
+} core_type_args_t;
+
+static void get_core_type_func(void *arg)
+{
+  core_type_args_t *args = (core_type_args_t *)arg;
+  int native_model, core_type = cpuinfo_arch_get_core_type(args->cip, &native_model);
+  if (core_type != CPUINFO_CORE_TYPE_UNKNOWN) {
+	args->pp->core_type = core_type;
+	args->pp->native_model = native_model;
+  }
+}
+
+// Get online logical processors information (returns read-only descriptors)
+const cpuinfo_processors_t *cpuinfo_get_processors(struct cpuinfo *cip)
+{
+  if (cip == NULL)
+	return NULL;
+  if (cip->processors.count < 0) {
+	int i, count = 0;
+	cpuinfo_processor_t *processors = NULL;
+	cpu_info_t *cps;
+	int n_cpus = get_cpu_infos(cip, &cps);
+	if (n_cpus > 0) {
+	  if ((processors = (cpuinfo_processor_t *)calloc(n_cpus, sizeof(*processors))) != NULL) {
+		int min_capacity = -1, max_capacity = -1;
+		// the hybrid flag is the same on all logical processors, so only
+		// migrate to each of them when CPUID can tell their core types
+		int native_model;
+		int is_hybrid = cpuinfo_arch_get_core_type(cip, &native_model) != CPUINFO_CORE_TYPE_UNKNOWN;
+		for (i = 0; i < n_cpus; i++) {
+		  cpuinfo_processor_t *pp = &processors[count++];
+		  pp->id = cps[i].id;
+		  pp->package = cps[i].package;
+		  pp->core = cps[i].core;
+		  pp->core_type = CPUINFO_CORE_TYPE_UNKNOWN;
+		  pp->native_model = -1;
+
+		  pp->core_type = get_sysfs_core_type(pp->id);
+		  if (pp->core_type == CPUINFO_CORE_TYPE_UNKNOWN)
+			pp->core_type = get_pmu_core_type(pp->id);
+		  if (is_hybrid) {
+			// CPUID is per logical processor, so this needs to run there
+			core_type_args_t args;
+			args.cip = cip;
+			args.pp = pp;
+			cpuinfo_run_on_cpu(pp->id, get_core_type_func, &args);
+		  }
+		  if ((pp->uarch = cpuinfo_arch_get_uarch(cip, pp->core_type)) < 0)
+			pp->uarch = CPUINFO_UARCH_UNKNOWN;
+
+		  get_cpu_perf(pp);
+		  if (cpuinfo_sysfs_read_int(&pp->capacity, "%s/cpu%d/cpu_capacity", sysfs_cpu, pp->id) < 0)
+			pp->capacity = -1;
+		  else {
+			if (min_capacity < 0 || pp->capacity < min_capacity)
+			  min_capacity = pp->capacity;
+			if (pp->capacity > max_capacity)
+			  max_capacity = pp->capacity;
+		  }
+		}
+
+		// classify the remaining cores by capacity (e.g. ARM big.LITTLE)
+		if (min_capacity < max_capacity) {
+		  for (i = 0; i < count; i++) {
+			cpuinfo_processor_t *pp = &processors[i];
+			if (pp->core_type != CPUINFO_CORE_TYPE_UNKNOWN || pp->capacity < 0)
+			  continue;
+			if (pp->capacity == max_capacity)
+			  pp->core_type = CPUINFO_CORE_TYPE_PERFORMANCE;
+			else
+			  pp->core_type = CPUINFO_CORE_TYPE_EFFICIENCY;
+		  }
+		}
+
+		// group processors with the same performance levels into tiers
+		cpuinfo_processor_t **ranks = (cpuinfo_processor_t **)malloc(count * sizeof(*ranks));
+		if (ranks) {
+		  for (i = 0; i < count; i++)
+			ranks[i] = &processors[i];
+		  qsort(ranks, count, sizeof(*ranks), processor_rank_compare);
+		  for (i = 1; i < count; i++)
+			ranks[i]->tier = ranks[i - 1]->tier + (processor_perf_compare(ranks[i - 1], ranks[i]) != 0);
+		  free(ranks);
+		}
+	  }
+	  free(cps);
+	}
+	cip->processors.count = count;
+	cip->processors.processors = processors;
+  }
+  return &cip->processors;
+}
+
+// Get the N fastest logical processors, returns the number of processors stored into CPUS
+int cpuinfo_get_fastest_cpus(struct cpuinfo *cip, int *cpus, int n)
+{
+  const cpuinfo_processors_t *psp = cpuinfo_get_processors(cip);
+  if (psp == NULL || cpus == NULL || n <= 0)
+	return 0;
+
+  // pick processors tier by tier, SMT siblings of already picked cores last
+  int i, j, k, tier, pass, count = 0;
+  for (tier = 0; count < n && count < psp->count; tier++) {
+	for (pass = 0; pass < 2; pass++) {
+	  for (i = 0; i < psp->count && count < n; i++) {
+		const cpuinfo_processor_t *pp = &psp->processors[i];
+		if (pp->tier != tier)
+		  continue;
+		for (j = 0; j < count; j++) {
+		  if (cpus[j] == pp->id)
+			break;
+		}
+		if (j < count)
+		  continue;
+		if (pass == 0) {
+		  for (j = 0; j < count; j++) {
+			for (k = 0; k < psp->count; k++) {
+			  if (psp->processors[k].id == cpus[j])
+				break;
+			}
+			if (psp->processors[k].package == pp->package && psp->processors[k].core == pp->core)
+			  break;
+		  }
+		  if (j < count)
+			continue;
+		}
+		cpus[count++] = pp->id;
+	  }
+	}
+  }
+  return count;
+}
+
+// Returns 1 if comma-separated LIST has NAME
+static int has_list_item(const char *list, const char *name)
+{
+  int n = strlen(name);
+  while (list) {
+	if (strncmp(list, name, n) == 0 && (list[n] == ',' || list[n] == '\0'))
+	  return 1;
+	if ((list = strchr(list, ',')) != NULL)
+	  list++;
+  }
+  return 0;
+}
+
+// Get directory of the cgroup of the process in the hierarchy of CONTROLLER (cgroup v1), or
+// in the unified hierarchy if CONTROLLER is NULL (cgroup v2). ROOT_LEN is set to the length
+// of the hierarchy mount point
+static int get_cgroup_dir(char *dir, int size, const char *controller, int *root_len)
+{
+  char line[4096], path[1024];
+  int found = 0;
+
+  // path of the cgroup, relative to the root of the hierarchy
+  FILE *fp = fopen(proc_cgroup, "r");
+  if (fp == NULL)
+	return -1;
+  while (!found && fgets(line, sizeof(line), fp)) {
+	char *controllers = strchr(line, ':'), *p;
+	if (controllers == NULL || (p = strchr(++controllers, ':')) == NULL)
+	  continue;
+	*p++ = '\0';
+	p[strcspn(p, "\n")] = '\0';
+	if (controller ? has_list_item(controllers, controller) : (strncmp(line, "0:", 2) == 0 && *controllers == '\0'))
+	  found = snprintf(path, sizeof(path), "%s", p) < sizeof(path);
+  }
+  fclose(fp);
+  if (!found)
+	return -1;
+
+  // mount point of the hierarchy
+  if ((fp = fopen(proc_mountinfo, "r")) == NULL)
+	return -1;
+  found = 0;
+  while (!found && fgets(line, sizeof(line), fp)) {
+	char root[1024], mount_point[1024], fstype[32], options[1024];
+	char *fields = strstr(line, " - ");
+	if (fields == NULL || sscanf(line, "%*s %*s %*s %1023s %1023s", root, mount_point) != 2
+		|| sscanf(fields + 3, "%31s %*s %1023s", fstype, options) != 2)
+	  continue;
+	if (controller ? strcmp(fstype, "cgroup") != 0 || !has_list_item(options, controller) : strcmp(fstype, "cgroup2") != 0)
+	  continue;
+
+	// containers may mount their own cgroup as the root of the hierarchy
+	const char *rel = path;
+	int n = strlen(root);
+	if (strcmp(root, "/") != 0 && strncmp(path, root, n) == 0 && (path[n] == '/' || path[n] == '\0'))
+	  rel = path + n;
+	if (strcmp(rel, "/") == 0)
+	  rel = "";
+	if (snprintf(dir, size, "%s%s", mount_point, rel) >= size)
+	  continue;
+	if (access(dir, F_OK) < 0)
+	  snprintf(dir, size, "%s", mount_point);
+	*root_len = strlen(mount_point);
+	found = 1;
+  }
+  fclose(fp);
+  return found ? 0 : -1;
+}
+
+// Replace cgroup directory DIR with its parent, up to the hierarchy root
+static int get_cgroup_parent(char *dir, int root_len)
+{
+  char *p = strrchr(dir, '/');
+  if (p == NULL || p - dir < root_len)
+	return -1;
+  *p = '\0';
+  return 0;
+}
+
+// Get CPU time quota of the process in processors (0 if unlimited), limits of ancestor cgroups apply too
+static double get_cgroup_quota(void)
+{
+  char dir[2048], line[256];
+  int root_len;
+  double quota = 0;
+
+  if (get_cgroup_dir(dir, sizeof(dir), NULL, &root_len) == 0) {
+	do {
+	  long max, period;
+	  // "max PERIOD" if unlimited
+	  if (cpuinfo_sysfs_read_string(line, sizeof(line), "%s/cpu.max", dir) == 0
+		  && sscanf(line, "%ld %ld", &max, &period) == 2 && max > 0 && period > 0) {
+		if (quota == 0 || (double)max / period < quota)
+		  quota = (double)max / period;
+	  }
+	} while (get_cgroup_parent(dir, root_len) == 0);
+  }
+
+  if (get_cgroup_dir(dir, sizeof(dir), "cpu", &root_len) == 0) {
+	do {
+	  int max, period;
+	  // -1 if unlimited
+	  if (cpuinfo_sysfs_read_int(&max, "%s/cpu.cfs_quota_us", dir) == 0 && max > 0
+		  && cpuinfo_sysfs_read_int(&period, "%s/cpu.cfs_period_us", dir) == 0 && period > 0) {
+		if (quota == 0 || (double)max / period < quota)
+		  quota = (double)max / period;
+	  }
+	} while (get_cgroup_parent(dir, root_len) == 0);
+  }
+
+  return quota;
+}
+
+// Get logical processors of the cgroup cpuset of the process (returns -1 if unknown)
+static int get_cgroup_cpus(int **cpus)
+{
+  char dir[2048], line[4096];
+  int root_len;
+
+  if (get_cgroup_dir(dir, sizeof(dir), NULL, &root_len) == 0
+	  && cpuinfo_sysfs_read_string(line, sizeof(line), "%s/cpuset.cpus.effective", dir) == 0)
+	return cpuinfo_parse_cpu_list(line, cpus);
+
+  if (get_cgroup_dir(dir, sizeof(dir), "cpuset", &root_len) == 0
+	  && (cpuinfo_sysfs_read_string(line, sizeof(line), "%s/cpuset.effective_cpus", dir) == 0
+		  || cpuinfo_sysfs_read_string(line, sizeof(line), "%s/cpuset.cpus", dir) == 0))
+	return cpuinfo_parse_cpu_list(line, cpus);
+
+  return -1;
+}
+
+// Get the processors the calling process may use
+int cpuinfo_get_cpu_budget(struct cpuinfo *cip, cpuinfo_cpu_budget_t *bp)
+{
+  const cpuinfo_processors_t *psp = cpuinfo_get_processors(cip);
+  if (psp == NULL || psp->count <= 0 || bp == NULL)
+	return -1;
+
+  char *usable = (char *)calloc(psp->count, 1);
+  if (usable == NULL)
+	return -1;
+
+  // the kernel restricts affinity to the cpuset, but it may still be changed later
+  int i, j, *cpus = NULL, n_cpus = get_cgroup_cpus(&cpus);
+#ifdef HAVE_SCHED_SETAFFINITY
+  size_t mask_size;
+  cpu_set_t *mask = get_affinity_mask(&mask_size);
+#endif
+  for (i = 0; i < psp->count; i++) {
+	int cpu = psp->processors[i].id;
+	usable[i] = 1;
+#ifdef HAVE_SCHED_SETAFFINITY
+	if (mask && !CPU_ISSET_S(cpu, mask_size, mask))
+	  usable[i] = 0;
+#endif
+	if (n_cpus > 0) {
+	  for (j = 0; j < n_cpus && cpus[j] != cpu; j++)
+		;
+	  if (j == n_cpus)
+		usable[i] = 0;
+	}
+  }
+  if (n_cpus > 0)
+	free(cpus);
+#ifdef HAVE_SCHED_SETAFFINITY
+  if (mask)
+	CPU_FREE(mask);
+#endif
+
+  bp->n_cpus = 0;
+  bp->n_cores = 0;
+  for (i = 0; i < psp->count; i++) {
+	const cpuinfo_processor_t *pp = &psp->processors[i];
+	if (!usable[i])
+	  continue;
+	bp->n_cpus++;
+	// count a core once, on its first usable logical processor
+	for (j = 0; j < i; j++) {
+	  const cpuinfo_processor_t *qp = &psp->processors[j];
+	  if (usable[j] && pp->core >= 0 && qp->package == pp->package && qp->core == pp->core)
+		break;
+	}
+	if (j == i)
+	  bp->n_cores++;
+  }
+  free(usable);
+
+  // the process runs somewhere, so inconsistent masks are ignored
+  if (bp->n_cpus == 0) {
+	bp->n_cpus = psp->count;
+	bp->n_cores = cpuinfo_get_cores(cip);
+	if (bp->n_cores <= 0 || bp->n_cores > bp->n_cpus)
+	  bp->n_cores = bp->n_cpus;
+  }
+
+  // a quota is spread over all usable processors, round it up so that it is used entirely
+  bp->quota = get_cgroup_quota();
+  bp->n_workers = bp->n_cpus;
+  if (bp->quota > 0) {
+	int n_workers = (int)bp->quota;
+	if (n_workers < bp->quota)
+	  n_workers++;
+	if (n_workers < bp->n_workers)
+	  bp->n_workers = n_workers > 0 ? n_workers : 1;
+  }
+  D(bug("cpu budget: %d cpus, %d cores, quota %.2f, %d workers\n", bp->n_cpus, bp->n_cores, bp->quota, bp->n_workers));
+  return 0;
+}
+
+static void new_for_cpu_func(void *arg)
+{
+  struct cpuinfo *cip = cpuinfo_new();
+  if (cip) {
+	// evaluate everything while running on the requested processor
+	cpuinfo_get_vendor(cip);
+	cpuinfo_get_model(cip);
+	cpuinfo_get_uarch(cip);
+	cpuinfo_get_frequency(cip);
+	cpuinfo_get_socket(cip);
+	cpuinfo_get_cores(cip);
+	cpuinfo_get_threads(cip);
+	cpuinfo_get_caches(cip);
+	cpuinfo_has_feature(cip, CPUINFO_FEATURE_64BIT);
+  }
+  *((struct cpuinfo **)arg) = cip;
+}
+
+// Returns a new cpuinfo descriptor for the specified logical processor
+struct cpuinfo *cpuinfo_new_for_cpu(int cpu)
+{
+  struct cpuinfo *cip = NULL;
+  if (cpuinfo_run_on_cpu(cpu, new_for_cpu_func, &cip) < 0)
+	return NULL;
+  return cip;
+}
+
+// Release all topology information
+void cpuinfo_topology_destroy(struct cpuinfo *cip)
+{
+  int i;
+  if (cip->processors.processors)
+	free((void *)cip->processors.processors);
+  if (cip->core_complexes.complexes) {
+	for (i = 0; i < cip->core_complexes.count; i++) {
+	  if (cip->core_complexes.complexes[i].cpus)
+		free((void *)cip->core_complexes.complexes[i].cpus);
+	}
+	free((void *)cip->core_complexes.complexes);
+  }
+}
@@ -0,0 +1,304 @@
+/*
+ *  cpuinfo-uarch.c - Microarchitecture characteristics
+ *
+ *  cpuinfo (C) 2006-2007 Gwenole Beauchesne
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation; either version 2.1
+ *  of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "sysdeps.h"
+#include <ctype.h>
+#include <stddef.h>
+#include "cpuinfo.h"
+#include "cpuinfo-private.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Environment variable naming a file that overrides the characteristics below
+static const char uarch_info_env[] = "CPUINFO_UARCH_DATA";
+
+#define SLOW_UNALIGNED		CPUINFO_SLOW_UNALIGNED
+#define SLOW_DIV64			CPUINFO_SLOW_DIV64
+#define SLOW_GATHER			CPUINFO_SLOW_GATHER
+#define SLOW_SCATTER		CPUINFO_SLOW_SCATTER
+#define SLOW_PDEP_PEXT		CPUINFO_SLOW_PDEP_PEXT
+#define SLOW_AVX512_FREQ	CPUINFO_SLOW_AVX512_FREQ
+#define SLOW_REP_MOVSB		CPUINFO_SLOW_SHORT_REP_MOVSB
+
+// Typical figures from vendor optimization manuals and published measurements. Cache
+// latencies vary with SKUs and frequencies, they are only meant to rank the levels.
+static const cpuinfo_uarch_info_t uarch_table[] = {
+  //  uarch							vector	path	pref	fma	ld	st	rob	lb	sb	l1	l2	l3	movsb	slow
+  { CPUINFO_UARCH_P5,				64,		64,		64,		0,	1,	1,	0,	0,	0,	1,	0,	0,	0,		0 },
+  { CPUINFO_UARCH_P6,				128,	64,		128,	0,	1,	1,	40,	16,	12,	3,	0,	0,	0,		SLOW_UNALIGNED },
+  { CPUINFO_UARCH_PENTIUM_M,		128,	64,		128,	0,	1,	1,	40,	16,	12,	3,	10,	0,	0,		SLOW_UNALIGNED },
+  { CPUINFO_UARCH_NETBURST,			128,	64,		128,	0,	1,	1,	126,48,	24,	4,	18,	0,	0,		SLOW_UNALIGNED },
+  { CPUINFO_UARCH_CORE,				128,	64,		128,	0,	1,	1,	40,	16,	12,	3,	14,	0,	0,		SLOW_UNALIGNED },
+  { CPUINFO_UARCH_CORE2,			128,	128,	128,	0,	1,	1,	96,	32,	20,	3,	15,	0,	0,		SLOW_UNALIGNED | SLOW_DIV64 },
+  { CPUINFO_UARCH_PENRYN,			128,	128,	128,	0,	1,	1,	96,	32,	20,	3,	15,	0,	0,		SLOW_UNALIGNED | SLOW_DIV64 },
+  { CPUINFO_UARCH_NEHALEM,			128,	128,	128,	0,	1,	1,	128,48,	32,	4,	10,	38,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_WESTMERE,			128,	128,	128,	0,	1,	1,	128,48,	32,	4,	10,	40,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_SANDY_BRIDGE,		256,	256,	256,	0,	2,	1,	168,64,	36,	4,	12,	30,	0,		SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_IVY_BRIDGE,		256,	256,	256,	0,	2,	1,	168,64,	36,	4,	12,	30,	2048,	SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_HASWELL,			256,	256,	256,	2,	2,	1,	192,72,	42,	4,	12,	36,	2048,	SLOW_DIV64 | SLOW_GATHER | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_BROADWELL,		256,	256,	256,	2,	2,	1,	192,72,	42,	4,	12,	38,	2048,	SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_SKYLAKE,			256,	256,	256,	2,	2,	1,	224,72,	56,	4,	12,	42,	2048,	SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_SKYLAKE_SP,		512,	512,	256,	2,	2,	1,	224,72,	56,	4,	14,	70,	2048,	SLOW_DIV64 | SLOW_AVX512_FREQ | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_CASCADE_LAKE,		512,	512,	256,	2,	2,	1,	224,72,	56,	4,	14,	70,	2048,	SLOW_DIV64 | SLOW_AVX512_FREQ | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_COOPER_LAKE,		512,	512,	256,	2,	2,	1,	224,72,	56,	4,	14,	70,	2048,	SLOW_DIV64 | SLOW_AVX512_FREQ | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_CANNON_LAKE,		512,	512,	256,	1,	2,	1,	224,72,	56,	5,	13,	0,	2048,	SLOW_AVX512_FREQ | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_ICE_LAKE,			512,	512,	256,	1,	2,	2,	352,128,72,	5,	13,	40,	2048,	SLOW_AVX512_FREQ },
+  { CPUINFO_UARCH_ICE_LAKE_SP,		512,	512,	256,	2,	2,	2,	352,128,72,	5,	14,	80,	2048,	SLOW_AVX512_FREQ },
+  { CPUINFO_UARCH_TIGER_LAKE,		512,	512,	256,	1,	2,	2,	352,128,72,	5,	14,	45,	2048,	SLOW_AVX512_FREQ },
+  { CPUINFO_UARCH_ROCKET_LAKE,		512,	512,	256,	1,	2,	2,	352,128,72,	5,	13,	42,	2048,	SLOW_AVX512_FREQ },
+  { CPUINFO_UARCH_SAPPHIRE_RAPIDS,	512,	512,	512,	2,	3,	2,	512,192,114,5,	16,	110,2048,	0 },
+  { CPUINFO_UARCH_EMERALD_RAPIDS,	512,	512,	512,	2,	3,	2,	512,192,114,5,	16,	110,2048,	0 },
+  { CPUINFO_UARCH_GRANITE_RAPIDS,	512,	512,	512,	2,	3,	2,	512,192,114,5,	16,	0,	2048,	0 },
+  { CPUINFO_UARCH_GOLDEN_COVE,		256,	256,	256,	2,	3,	2,	512,192,114,5,	15,	65,	2048,	0 },
+  { CPUINFO_UARCH_RAPTOR_COVE,		256,	256,	256,	2,	3,	2,	512,192,114,5,	16,	70,	2048,	0 },
+  { CPUINFO_UARCH_REDWOOD_COVE,		256,	256,	256,	2,	3,	2,	512,192,114,5,	16,	0,	2048,	0 },
+  { CPUINFO_UARCH_LION_COVE,		256,	256,	256,	2,	3,	2,	576,0,	0,	5,	17,	0,	2048,	0 },
+  { CPUINFO_UARCH_BONNELL,			128,	128,	128,	0,	1,	1,	0,	0,	0,	3,	15,	0,	0,		SLOW_UNALIGNED | SLOW_DIV64 },
+  { CPUINFO_UARCH_SALTWELL,			128,	128,	128,	0,	1,	1,	0,	0,	0,	3,	15,	0,	0,		SLOW_UNALIGNED | SLOW_DIV64 },
+  { CPUINFO_UARCH_SILVERMONT,		128,	128,	128,	0,	1,	1,	32,	10,	16,	3,	14,	0,	0,		SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_AIRMONT,			128,	128,	128,	0,	1,	1,	32,	10,	16,	3,	14,	0,	0,		SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_GOLDMONT,			128,	128,	128,	0,	1,	1,	78,	0,	0,	3,	17,	0,	2048,	SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_GOLDMONT_PLUS,	128,	128,	128,	0,	1,	1,	93,	0,	0,	3,	17,	0,	2048,	SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_TREMONT,			128,	128,	128,	0,	2,	2,	208,0,	0,	4,	17,	0,	2048,	SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_GRACEMONT,		256,	128,	256,	2,	2,	2,	256,0,	0,	4,	17,	0,	2048,	SLOW_GATHER | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_CRESTMONT,		256,	128,	256,	2,	2,	2,	256,0,	0,	4,	17,	0,	2048,	SLOW_GATHER | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_SKYMONT,			256,	128,	256,	4,	3,	2,	416,0,	0,	4,	19,	0,	2048,	SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_KNIGHTS_LANDING,	512,	512,	512,	2,	2,	1,	72,	0,	0,	5,	17,	0,	0,		SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_KNIGHTS_MILL,		512,	512,	512,	2,	2,	1,	72,	0,	0,	5,	17,	0,	0,		SLOW_DIV64 | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_K6,				64,		64,		64,		0,	1,	1,	24,	0,	0,	2,	0,	0,	0,		0 },
+  { CPUINFO_UARCH_K7,				64,		64,		64,		0,	2,	1,	72,	44,	0,	3,	20,	0,	0,		SLOW_UNALIGNED },
+  { CPUINFO_UARCH_K8,				128,	64,		128,	0,	2,	1,	72,	44,	0,	3,	12,	0,	0,		SLOW_UNALIGNED | SLOW_DIV64 },
+  { CPUINFO_UARCH_K10,				128,	128,	128,	0,	2,	1,	72,	44,	0,	3,	15,	45,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_BOBCAT,			128,	64,		128,	0,	1,	1,	56,	0,	0,	3,	17,	0,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_BULLDOZER,		256,	128,	128,	2,	2,	1,	128,40,	24,	4,	20,	65,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_PILEDRIVER,		256,	128,	128,	2,	2,	1,	128,44,	24,	4,	20,	65,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_STEAMROLLER,		256,	128,	128,	2,	2,	1,	192,48,	32,	4,	19,	0,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_EXCAVATOR,		256,	128,	128,	2,	2,	1,	192,48,	32,	4,	19,	0,	0,		SLOW_DIV64 | SLOW_GATHER | SLOW_PDEP_PEXT },
+  { CPUINFO_UARCH_JAGUAR,			256,	128,	128,	1,	1,	1,	64,	16,	20,	3,	25,	0,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_PUMA,				256,	128,	128,	1,	1,	1,	64,	16,	20,	3,	25,	0,	0,		SLOW_DIV64 },
+  { CPUINFO_UARCH_ZEN,				256,	128,	256,	2,	2,	1,	192,72,	44,	4,	17,	40,	0,		SLOW_DIV64 | SLOW_GATHER | SLOW_PDEP_PEXT | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_ZEN_PLUS,			256,	128,	256,	2,	2,	1,	192,72,	44,	4,	12,	39,	0,		SLOW_DIV64 | SLOW_GATHER | SLOW_PDEP_PEXT | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_ZEN2,				256,	256,	256,	2,	2,	1,	224,72,	48,	4,	12,	39,	0,		SLOW_GATHER | SLOW_PDEP_PEXT | SLOW_REP_MOVSB },
+  { CPUINFO_UARCH_ZEN3,				256,	256,	256,	2,	3,	2,	256,72,	64,	4,	12,	46,	2048,	SLOW_GATHER },
+  { CPUINFO_UARCH_ZEN4,				512,	256,	512,	2,	3,	2,	320,88,	64,	4,	14,	50,	2048,	SLOW_SCATTER },
+  { CPUINFO_UARCH_ZEN5,				512,	512,	512,	2,	4,	2,	448,0,	104,5,	14,	50,	2048,	SLOW_SCATTER },
+};
+
+// Keys accepted in characteristics files
+static const struct {
+  const char *name;
+  int offset;
+} uarch_info_keys[] = {
+#define DEFINE_KEY(NAME) { #NAME, offsetof(cpuinfo_uarch_info_t, NAME) }
+  DEFINE_KEY(vector_width),
+  DEFINE_KEY(datapath_width),
+  DEFINE_KEY(preferred_vector_width),
+  DEFINE_KEY(fma_units),
+  DEFINE_KEY(load_units),
+  DEFINE_KEY(store_units),
+  DEFINE_KEY(rob_size),
+  DEFINE_KEY(load_buffer_size),
+  DEFINE_KEY(store_buffer_size),
+  DEFINE_KEY(l1_latency),
+  DEFINE_KEY(l2_latency),
+  DEFINE_KEY(l3_latency),
+  DEFINE_KEY(rep_movsb_threshold),
+#undef DEFINE_KEY
+  { NULL, 0 }
+};
+
+static const char *slow_insn_names[] = {
+  "unaligned", "div64", "gather", "scatter", "pdep_pext", "avx512_freq", "short_rep_movsb"
+};
+
+const char *cpuinfo_string_of_slow_insn(int slow_insn)
+{
+  int i;
+  for (i = 0; i < sizeof(slow_insn_names) / sizeof(slow_insn_names[0]); i++) {
+	if (slow_insn == (1 << i))
+	  return slow_insn_names[i];
+  }
+  return "<unknown>";
+}
+
+// Strip leading and trailing blanks
+static char *strip(char *str)
+{
+  while (isspace((unsigned char)*str))
+	str++;
+  char *end = str + strlen(str);
+  while (end > str && isspace((unsigned char)end[-1]))
+	*--end = '\0';
+  return str;
+}
+
+// Find characteristics of UARCH, or add an empty descriptor if CREATE is set
+static cpuinfo_uarch_info_t *uarch_info_get(struct cpuinfo *cip, int uarch, int create)
+{
+  int i;
+  for (i = 0; i < cip->n_uarch_infos; i++) {
+	if (cip->uarch_infos[i].uarch == uarch)
+	  return &cip->uarch_infos[i];
+  }
+  if (!create)
+	return NULL;
+  cpuinfo_uarch_info_t *uips = realloc(cip->uarch_infos, (cip->n_uarch_infos + 1) * sizeof(*uips));
+  if (uips == NULL)
+	return NULL;
+  cip->uarch_infos = uips;
+  cpuinfo_uarch_info_t *uip = &uips[cip->n_uarch_infos++];
+  memset(uip, 0, sizeof(*uip));
+  uip->uarch = uarch;
+  return uip;
+}
+
+// Parse slow instructions list (e.g. "gather, pdep_pext"), returns -1 on error
+static int parse_slow_insns(char *str)
+{
+  int i, slow_insns = 0;
+  char *name;
+  for (name = strtok(str, ", \t"); name != NULL; name = strtok(NULL, ", \t")) {
+	for (i = 0; i < sizeof(slow_insn_names) / sizeof(slow_insn_names[0]); i++) {
+	  if (strcmp(name, slow_insn_names[i]) == 0)
+		break;
+	}
+	if (i == sizeof(slow_insn_names) / sizeof(slow_insn_names[0]))
+	  return -1;
+	slow_insns |= 1 << i;
+  }
+  return slow_insns;
+}
+
+/*
+ *  Characteristics files override the compiled-in table, e.g.
+ *
+ *	# comment
+ *	[Zen 4]
+ *	l3_latency = 52
+ *	slow = scatter, gather
+ *
+ *  Sections are named after cpuinfo_string_of_uarch(), keys after the fields of
+ *  cpuinfo_uarch_info_t. "slow" replaces the whole list of slow instructions.
+ */
+static int uarch_info_parse_file(struct cpuinfo *cip, const char *filename)
+{
+  FILE *fp = fopen(filename, "r");
+  if (fp == NULL)
+	return -1;
+
+  cpuinfo_uarch_info_t *uip = NULL;
+  char line[256];
+  int i, lineno = 0;
+  while (fgets(line, sizeof(line), fp)) {
+	lineno++;
+	char *str = strchr(line, '#');
+	if (str)
+	  *str = '\0';
+	if (*(str = strip(line)) == '\0')
+	  continue;
+
+	if (*str == '[') {
+	  char *end = strchr(++str, ']');
+	  if (end)
+		*end = '\0';
+	  int uarch = cpuinfo_uarch_of_string(strip(str));
+	  uip = uarch > 0 ? uarch_info_get(cip, uarch, 1) : NULL;
+	  if (uip == NULL)
+		D(bug("%s:%d: unknown microarchitecture '%s'\n", filename, lineno, str));
+	  continue;
+	}
+
+	char *value = strchr(str, '=');
+	if (uip == NULL || value == NULL)
+	  continue;
+	*value++ = '\0';
+	char *key = strip(str);
+	value = strip(value);
+
+	if (strcmp(key, "slow") == 0) {
+	  int slow_insns = parse_slow_insns(value);
+	  if (slow_insns >= 0)
+		uip->slow_insns = slow_insns;
+	  else
+		D(bug("%s:%d: invalid slow instructions\n", filename, lineno));
+	  continue;
+	}
+	for (i = 0; uarch_info_keys[i].name != NULL; i++) {
+	  if (strcmp(key, uarch_info_keys[i].name) == 0)
+		break;
+	}
+	char *end;
+	long n = strtol(value, &end, 0);
+	if (uarch_info_keys[i].name == NULL || end == value || *end != '\0' || n < 0) {
+	  D(bug("%s:%d: invalid entry '%s'\n", filename, lineno, key));
+	  continue;
+	}
+	*(int *)((char *)uip + uarch_info_keys[i].offset) = n;
+  }
+
+  fclose(fp);
+  return 0;
+}
+
+// Load the compiled-in table, then apply overrides from the characteristics files
+static int uarch_info_load(struct cpuinfo *cip)
+{
+  cip->uarch_infos = malloc(sizeof(uarch_table));
+  if (cip->uarch_infos == NULL)
+	return -1;
+  memcpy(cip->uarch_infos, uarch_table, sizeof(uarch_table));
+  cip->n_uarch_infos = sizeof(uarch_table) / sizeof(uarch_table[0]);
+
+#ifdef CPUINFO_DATADIR
+  uarch_info_parse_file(cip, CPUINFO_DATADIR "/uarch.conf");
+#endif
+
+  const char *filename = cpuinfo_getenv(uarch_info_env);
+  if (filename)
+	uarch_info_parse_file(cip, filename);
+  return 0;
+}
+
+// Release microarchitecture characteristics
+void cpuinfo_uarch_info_destroy(struct cpuinfo *cip)
+{
+  if (cip->uarch_infos) {
+	free(cip->uarch_infos);
+	cip->uarch_infos = NULL;
+  }
+  cip->n_uarch_infos = -1;
+}
+
+// Get performance characteristics of microarchitecture UARCH
+const cpuinfo_uarch_info_t *cpuinfo_lookup_uarch_info(struct cpuinfo *cip, int uarch)
+{
+  if (cip == NULL || uarch <= CPUINFO_UARCH_UNKNOWN)
+	return NULL;
+  if (cip->n_uarch_infos < 0 && uarch_info_load(cip) < 0)
+	return NULL;
+  return uarch_info_get(cip, uarch, 0);
+}
+
+// Get performance characteristics of the processor
+const cpuinfo_uarch_info_t *cpuinfo_get_uarch_info(struct cpuinfo *cip)
+{
+  return cpuinfo_lookup_uarch_info(cip, cpuinfo_get_uarch(cip));
+}
@@ -22,12 +22,16 @@
 #include <unistd.h>
 #include <ctype.h>
 #include <sys/time.h>
+#if defined __linux__
+#include <sys/syscall.h>
+#endif
 #include "cpuinfo.h"
 #include "cpuinfo-private.h"
 
 #define DEBUG 1
 #include "debug.h"
 
+attribute_no_stack_protector
 static void cpuid(uint32_t op, uint32_t *eax, uint32_t *ebx, uint32_t *ecx, uint32_t *edx)
 {
   uint32_t a = eax ? *eax : 0;
@@ -53,9 +57,81 @@ static void cpuid(uint32_t op, uint32_t *eax, uint32_t *ebx, uint32_t *ecx, uint
   if (edx) *edx = d;
 }
 
+// Read extended control register (XCR0 for index 0)
+attribute_no_stack_protector
+static uint64_t xgetbv(uint32_t index)
+{
+  uint32_t eax, edx;
+  __asm__ __volatile__ (".byte 0x0f,0x01,0xd0" /* xgetbv */
+						: "=a" (eax), "=d" (edx)
+						: "c" (index));
+  return ((uint64_t)edx << 32) | eax;
+}
+
+// XCR0 state components
+#define XCR0_X87		(1 << 0)
+#define XCR0_SSE		(1 << 1)
+#define XCR0_AVX		(1 << 2)
+#define XCR0_OPMASK		(1 << 5)
+#define XCR0_ZMM_HI256	(1 << 6)
+#define XCR0_HI16_ZMM	(1 << 7)
+#define XCR0_TILECFG	(1 << 17)
+#define XCR0_TILEDATA	(1 << 18)
+#define XCR0_APX		(1 << 19)
+
+#define XCR0_AVX_STATE		(XCR0_SSE | XCR0_AVX)
+#define XCR0_AVX512_STATE	(XCR0_AVX_STATE | XCR0_OPMASK | XCR0_ZMM_HI256 | XCR0_HI16_ZMM)
+#define XCR0_AMX_STATE		(XCR0_TILECFG | XCR0_TILEDATA)
+
+// Get state components enabled by the OS in XCR0
+attribute_no_stack_protector
+static uint64_t get_xcr0(void)
+{
+  uint32_t ecx;
+  cpuid(0, &ecx, NULL, NULL, NULL);
+  if (ecx < 1)
+	return 0;
+  cpuid(1, NULL, NULL, &ecx, NULL);
+  if ((ecx & (1 << 27)) == 0) /* OSXSAVE */
+	return 0;
+  return xgetbv(0);
+}
+
+// Linux >= 5.16 enables tile data on a per-process basis
+#ifndef ARCH_GET_XCOMP_PERM
+#define ARCH_GET_XCOMP_PERM		0x1022
+#endif
+#ifndef ARCH_REQ_XCOMP_PERM
+#define ARCH_REQ_XCOMP_PERM		0x1023
+#endif
+#define XFEATURE_XTILEDATA		18
+
+// Get dynamic state components the process is permitted to use
+// This is a raw system call, the C library may not be relocated yet
+attribute_no_stack_protector
+static uint64_t get_xcomp_perm(void)
+{
+#if !defined __x86_64__
+  // tile instructions are only valid in 64-bit mode
+  return 0;
+#elif defined __linux__
+  unsigned long features = 0;
+  long ret;
+  __asm__ __volatile__ ("syscall"
+						: "=a" (ret)
+						: "0" (158 /* SYS_arch_prctl */), "D" (ARCH_GET_XCOMP_PERM), "S" (&features)
+						: "rcx", "r11", "memory");
+  return ret < 0 ? 0 : features;
+#else
+  // XXX assume tile data is usable if the OS enabled it in XCR0
+  return XCR0_AMX_STATE;
+#endif
+}
+
 // Arch-dependent data
 struct x86_cpuinfo {
   uint32_t features[CPUINFO_FEATURES_SZ_(X86)];
+  uint32_t hw_features[CPUINFO_FEATURES_SZ_(X86)];	// raw CPUID capabilities
 };
 
 typedef struct x86_cpuinfo x86_cpuinfo_t;
@@ -67,6 +143,7 @@ int cpuinfo_arch_new(struct cpuinfo *cip)
   if (p == NULL)
 	return -1;
   memset(p->features, 0, sizeof(p->features));
+  memset(p->hw_features, 0, sizeof(p->hw_features));
   cip->opaque = p;
   return 0;
 }
@@ -92,8 +169,26 @@ int cpuinfo_dump(struct cpuinfo *cip, FILE *out)
 
   fprintf(out, "Maximum supported standard level: %08x\n", cpuid_level);
   for (i = 0; i <= cpuid_level; i++) {
+	ecx = 0;
 	cpuid(i, &eax, &ebx, &ecx, &edx);
 	fprintf(out, "%08x: eax %08x, ebx %08x, ecx %08x, edx %08x\n", i, eax, ebx, ecx, edx);
+	if (i == 7 || i == 0x24) { // special case for cpuid(7) and cpuid(0x24) subleaves
+	  uint32_t max_subleaf = eax;
+	  for (n = 1; n <= max_subleaf && n < 32; n++) {
+		ecx = n;
+		cpuid(i, &eax, &ebx, &ecx, &edx);
+		fprintf(out, "--- %04d: eax %08x, ebx %08x, ecx %08x, edx %08x\n", n, eax, ebx, ecx, edx);
+	  }
+	}
+	if (i == 0xd) { // special case for cpuid(0xd) state components
+	  for (n = 1; n < 64; n++) {
+		ecx = n;
+		cpuid(0xd, &eax, &ebx, &ecx, &edx);
+		if (n > 1 && eax == 0)
+		  continue;
+		fprintf(out, "--- %04d: eax %08x, ebx %08x, ecx %08x, edx %08x\n", n, eax, ebx, ecx, edx);
+	  }
+	}
 	if (i == 4) { // special case for cpuid(4)
 	  for (n = 0; /* nothing */; n++) {
 		ecx = n;
@@ -113,6 +208,15 @@ int cpuinfo_dump(struct cpuinfo *cip, FILE *out)
 	for (i = 0x80000000; i <= cpuid_level; i++) {
 	  cpuid(i, &eax, &ebx, &ecx, &edx);
 	  fprintf(out, "%08x: eax %08x, ebx %08x, ecx %08x, edx %08x\n", i, eax, ebx, ecx, edx);
+	  if (i == 0x8000001d) { // special case for cpuid(0x8000001d)
+		for (n = 0; /* nothing */; n++) {
+		  ecx = n;
+		  cpuid(0x8000001d, &eax, &ebx, &ecx, &edx);
+		  if ((eax & 0x1f) == 0)
+			break;
+		  fprintf(out, "--- %04d: eax %08x, ebx %08x, ecx %08x, edx %08x\n", n, eax, ebx, ecx, edx);
+		}
+	  }
 	}
 	fprintf(out, "\n");
   }
@@ -154,6 +258,8 @@ int cpuinfo_arch_get_vendor(struct cpuinfo *cip)
 	vendor = CPUINFO_VENDOR_INTEL;
   else if (!strcmp(v, "AuthenticAMD"))
 	vendor = CPUINFO_VENDOR_AMD;
+  else if (!strcmp(v, "HygonGenuine"))
+	vendor = CPUINFO_VENDOR_HYGON;
   else if (!strcmp(v, "GenuineTMx86"))
 	vendor = CPUINFO_VENDOR_TRANSMETA;
   else if (!strcmp(v, "UMC UMC UMC "))
@@ -184,6 +290,34 @@ int cpuinfo_arch_get_vendor(struct cpuinfo *cip)
   return vendor;
 }
 
+// Returns 1 if the processor implements AMD cpuid() leaves, i.e. Hygon processors too
+static int is_amd_compatible(struct cpuinfo *cip)
+{
+  int vendor = cpuinfo_get_vendor(cip);
+  return vendor == CPUINFO_VENDOR_AMD || vendor == CPUINFO_VENDOR_HYGON;
+}
+
+// Format processor name NAME, which comes from the tables file and
+// may only contain a single %d conversion for MODEL_NUMBER
+static char *format_model_name(const char *name, int model_number)
+{
+  const char *cp;
+  int n_conversions = 0;
+  for (cp = strchr(name, '%'); cp != NULL; cp = strchr(cp + 2, '%')) {
+	if (cp[1] != 'd' || ++n_conversions > 1)
+	  return NULL;
+  }
+
+  char *model = (char *)malloc(64);
+  if (model) {
+	if (n_conversions)
+	  snprintf(model, 64, name, model_number);
+	else
+	  snprintf(model, 64, "%s", name);
+  }
+  return model;
+}
+
 // Get AMD processor name
 static char *get_model_amd_npt(struct cpuinfo *cip)
 {
@@ -197,65 +331,21 @@ static char *get_model_amd_npt(struct cpuinfo *cip)
   uint32_t NN = ((BrandId >> 9) & 0x40) | (BrandId & 0x3f);				// BrandId[15,5:0]
   int CmpCap = cpuinfo_get_cores(cip) > 1;
 
-  typedef struct processor_name_string {
-	int8_t cmp;
-	uint8_t index;
-	uint8_t pwr_lmt;
-	const char *name;
-	char model;
-  } processor_name_string_t;
-  static const processor_name_string_t socket_F_table[] = {
-	{  1, 0x01, 0x6, "Opteron 22%d HE",			'R' },
-	{  1, 0x01, 0xA, "Opteron 22%d",			'R' },
-	{  1, 0x01, 0xC, "Opteron 22%d SE",			'R' },
-	{  1, 0x04, 0x6, "Opteron 82%d HE",			'R' },
-	{  1, 0x04, 0xA, "Opteron 82%d",			'R' },
-	{  1, 0x04, 0xC, "Opteron 82%d SE",			'R' },
-	{ -1, 0x00, 0x0, "AMD Engineering Sample",	    },
-	{ -1, 0x00, 0x0, NULL,						    }
-  };
-  static const processor_name_string_t socket_AM2_table[] = {
-	{  0, 0x04, 0x4, "Athlon 64 %d00+",			'T' },
-	{  0, 0x04, 0x8, "Athlon 64 %d00+",			'T' },
-	{  0, 0x06, 0x4, "Sempron %d00+",			'T' },
-	{  0, 0x06, 0x8, "Sempron %d00+",			'T' },
-	{  1, 0x01, 0xA, "Opteron 12%d",			'R' },
-	{  1, 0x01, 0xC, "Opteron 12%d SE",			'R' },
-	{  1, 0x04, 0x2, "Athlon 64 X2 %d00+",		'T' },
-	{  1, 0x04, 0x6, "Athlon 64 X2 %d00+",		'T' },
-	{  1, 0x04, 0x8, "Athlon 64 X2 %d00+",		'T' },
-	{  1, 0x05, 0xC, "Athlon 64 FX-%d",			'Z' },
-	{ -1, 0x00, 0x0, "AMD Engineering Sample",	    },
-	{ -1, 0x00, 0x0, NULL,						    }
-  };
-  static const processor_name_string_t socket_S1_table[] = {
-	{  1, 0x02, 0xC, "Turion 64 X2 TL-%d",		'Y' },
-	{ -1, 0x00, 0x0, "AMD Engineering Sample",	    },
-	{ -1, 0x00, 0x0, NULL,						    }
-  };
-
-  const processor_name_string_t *model_names = NULL;
-  switch (cpuinfo_get_socket(cip)) {
-  case CPUINFO_SOCKET_F:
-	model_names = socket_F_table;
-	break;
-  case CPUINFO_SOCKET_AM2:
-	model_names = socket_AM2_table;
-	break;
-  case CPUINFO_SOCKET_S1:
-	model_names = socket_S1_table;
-	break;
-  }
-  if (model_names == NULL)
+  cpuinfo_db_table_t table;
+  if (cpuinfo_db_get_table(CPUINFO_DB_AMD_NPT_BRAND, 6, &table) < 0)
 	return NULL;
 
-  int i;
-  for (i = 0; model_names[i].name != NULL; i++) {
-	const processor_name_string_t *mp = &model_names[i];
-	if ((mp->cmp == -1 || mp->cmp == CmpCap)
-		&& mp->index == BrandTableIndex
-		&& mp->pwr_lmt == PwrLmt) {
-	  int model_number = mp->model;
+  const cpuinfo_db_record_t *rp;
+  for (rp = cpuinfo_db_lookup(&table, cpuinfo_get_socket(cip)); rp != NULL; rp = cpuinfo_db_next(&table, rp)) {
+	int cmp = cpuinfo_db_field(rp, 1);
+	if ((cmp == -1 || cmp == CmpCap)
+		&& cpuinfo_db_field(rp, 2) == BrandTableIndex
+		&& cpuinfo_db_field(rp, 3) == PwrLmt) {
+	  const char *name = cpuinfo_db_string(rp, 5);
+	  if (name == NULL)
+		return NULL;
+
+	  int model_number = cpuinfo_db_field(rp, 4);
 	  switch (model_number) {
 	  case 'R': model_number = -1 + NN; break;
 	  case 'P': model_number = 26 + NN; break;
@@ -263,14 +353,7 @@ static char *get_model_amd_npt(struct cpuinfo *cip)
 	  case 'Z': model_number = 57 + NN; break;
 	  case 'Y': model_number = 29 + NN; break;
 	  }
-	  char *model = (char *)malloc(64);
-	  if (model) {
-		if (model_number)
-		  sprintf(model, mp->name, model_number);
-		else
-		  sprintf(model, mp->name);
-	  }
-	  return model;
+	  return format_model_name(name, model_number);
 	}
   }
 
@@ -305,79 +388,14 @@ static char *get_model_amd_k8(struct cpuinfo *cip)
 	NN = brand_id & 0x3f;								// BrandId[5:0]
   }
 
-  static const struct {
-	const char *name;
-	char model;
-  }
-  BrandTable[64] = {
-	{ "Engineering Sample",		    }, /* 0x00 */
-	{ NULL,						    }, /* 0x01 */
-	{ NULL,						    }, /* 0x02 */
-	{ NULL,						    }, /* 0x03 */
-	{ "Athlon 64 %d00+",		'X' }, /* 0x04 */
-	{ "Athlon 64 X2 %d00+",		'X' }, /* 0x05 */
-	{ NULL,						    }, /* 0x06 */
-	{ NULL,						    }, /* 0x07 */
-	{ "Athlon 64 %d00+",		'X' }, /* 0x08 */
-	{ "Athlon 64 %d00+",		'X' }, /* 0x09 */
-	{ "Turion 64 ML-%d",		'X' }, /* 0x0A */
-	{ "Turion 64 MT-%d",		'X' }, /* 0x0B */
-	{ "Opteron 1%d",			'Y' }, /* 0x0C */
-	{ "Opteron 1%d",			'Y' }, /* 0x0D */
-	{ "Opteron 1%d HE",			'Y' }, /* 0x0E */
-	{ "Opteron 1%d EE",			'Y' }, /* 0x0F */
-	{ "Opteron 2%d",			'Y' }, /* 0x10 */
-	{ "Opteron 2%d",			'Y' }, /* 0x11 */
-	{ "Opteron 2%d HE",			'Y' }, /* 0x12 */
-	{ "Opteron 2%d EE",			'Y' }, /* 0x13 */
-	{ "Opteron 8%d",			'Y' }, /* 0x14 */
-	{ "Opteron 8%d",			'Y' }, /* 0x15 */
-	{ "Opteron 8%d HE",			'Y' }, /* 0x16 */
-	{ "Opteron 8%d EE",			'Y' }, /* 0x17 */
-	{ "Athlon 64 %d00+",		'E' }, /* 0x18 */
-	{ NULL,						    }, /* 0x19 */
-	{ NULL,						    }, /* 0x1A */
-	{ NULL,						    }, /* 0x1B */
-	{ NULL,						    }, /* 0x1C */
-	{ "Athlon XP-M %d00+",		'X' }, /* 0x1D */
-	{ "Athlon XP-M %d00+",		'X' }, /* 0x1E */
-	{ NULL,						    }, /* 0x1F */
-	{ "Athlon XP %d00+",		'X' }, /* 0x20 */
-	{ "Sempron %d00+",			'T' }, /* 0x21 */
-	{ "Sempron %d00+",			'T' }, /* 0x22 */
-	{ "Sempron %d00+",			'T' }, /* 0x23 */
-	{ "Athlon 64 FX-%d",		'Z' }, /* 0x24 */
-	{ NULL,						    }, /* 0x01 */
-	{ "Sempron %d00+",			'T' }, /* 0x26 */
-	{ NULL,						    }, /* 0x27 */
-	{ NULL,						    }, /* 0x28 */
-	{ "Opteron 1%d SE",			'R' }, /* 0x29 */
-	{ "Opteron 2%d SE",			'R' }, /* 0x2A */
-	{ "Opteron 8%d SE",			'R' }, /* 0x2B */
-	{ "Opteron 1%d",			'R' }, /* 0x2C */
-	{ "Opteron 1%d",			'R' }, /* 0x2D */
-	{ "Opteron 1%d HE",			'R' }, /* 0x2E */
-	{ "Opteron 1%d EE",			'R' }, /* 0x2F */
-	{ "Opteron 2%d",			'R' }, /* 0x30 */
-	{ "Opteron 2%d",			'R' }, /* 0x31 */
-	{ "Opteron 2%d HE",			'R' }, /* 0x32 */
-	{ "Opteron 2%d EE",			'R' }, /* 0x33 */
-	{ "Opteron 8%d",			'R' }, /* 0x34 */
-	{ "Opteron 8%d",			'R' }, /* 0x35 */
-	{ "Opteron 8%d HE",			'R' }, /* 0x36 */
-	{ "Opteron 8%d EE",			'R' }, /* 0x37 */
-	{ "Opteron 1%d",			'R' }, /* 0x38 */
-	{ "Opteron 2%d",			'R' }, /* 0x39 */
-	{ "Opteron 8%d",			'R' }, /* 0x3A */
-	{ NULL,						    }, /* 0x3B */
-	{ NULL,						    }, /* 0x3C */
-	{ NULL,						    }, /* 0x3D */
-	{ NULL,						    }, /* 0x3E */
-	{ NULL,						    }  /* 0x3F */
-  };
-  assert((sizeof(BrandTable) / sizeof(BrandTable[0])) == 64);
+  cpuinfo_db_table_t table;
+  if (cpuinfo_db_get_table(CPUINFO_DB_AMD_K8_BRAND, 3, &table) < 0)
+	return NULL;
+  const cpuinfo_db_record_t *rp = cpuinfo_db_lookup(&table, BrandTableIndex);
+  if (rp == NULL)
+	return NULL;
 
-  int model_number = BrandTable[BrandTableIndex].model;
+  int model_number = cpuinfo_db_field(rp, 1);
   switch (model_number) {
   case 'X': model_number = 22 + NN; break;
   case 'Y': model_number = 38 + (2 * NN); break;
@@ -387,19 +405,11 @@ static char *get_model_amd_k8(struct cpuinfo *cip)
   case 'E': model_number = 9 + NN; break;
   }
 
-  const char *name = BrandTable[BrandTableIndex].name;
+  const char *name = cpuinfo_db_string(rp, 2);
   if (name == NULL)
 	return NULL;
 
-  char *model = (char *)malloc(64);
-  if (model) {
-	if (model_number)
-	  sprintf(model, name, model_number);
-	else
-	  sprintf(model, name);
-  }
-
-  return model;
+  return format_model_name(name, model_number);
 }
 
 static char *get_model_amd_k7(struct cpuinfo *cip)
@@ -473,27 +483,15 @@ static char *get_model_intel(struct cpuinfo *cip)
   uint32_t brand_id = ebx & 0xff;
   if (brand_id) {
 	// AP485, Table 5-1
-	switch (brand_id) {
-	case 0x01: processor = "Celeron";											break;
-	case 0x02: processor = "Pentium III";										break;
-	case 0x03: processor = fms == 0x6b1 ? "Celeron" : "Pentium III Xeon";		break;
-	case 0x04: processor = "Pentium III";										break;
-	case 0x06: processor = "Mobile Pentium III";								break;
-	case 0x07: processor = "Mobile Celeron";									break;
-	case 0x08: processor = fms >= 0xf13 ? "Genuine" : "Pentium 4";				break;
-	case 0x09: processor = "Pentium 4";											break;
-	case 0x0a: processor = "Celeron";											break;
-	case 0x0b: processor = fms < 0xf13 ? "Xeon MP" : "Xeon";					break;
-	case 0x0c: processor = "Xeon MP";											break;
-	case 0x0e: processor = fms < 0xf13 ? "Xeon" : "Mobile Pentium 4";			break;
-	case 0x0f: processor = "Mobile Celeron";									break;
-	case 0x11: processor = "Mobile Genuine";									break;
-	case 0x12: processor = "Celeron M";											break;
-	case 0x13: processor = "Mobile Celeron";									break;
-	case 0x14: processor = "Celeron";											break;
-	case 0x15: processor = "Mobile Genuine";									break;
-	case 0x16: processor = "Pentium M";											break;
-	case 0x17: processor = "Mobile Celeron";									break;
+	cpuinfo_db_table_t table;
+	if (cpuinfo_db_get_table(CPUINFO_DB_INTEL_BRAND, 4, &table) == 0) {
+	  const cpuinfo_db_record_t *rp;
+	  for (rp = cpuinfo_db_lookup(&table, brand_id); rp != NULL; rp = cpuinfo_db_next(&table, rp)) {
+		if (fms >= cpuinfo_db_field(rp, 1) && fms <= cpuinfo_db_field(rp, 2)) {
+		  processor = cpuinfo_db_string(rp, 3);
+		  break;
+		}
+	  }
 	}
   }
 
@@ -713,6 +711,11 @@ int cpuinfo_arch_get_frequency(struct cpuinfo *cip)
   if ((edx & (1 << 4)) == 0)
 	return os_get_frequency();
 
+  // Calibration is unreliable in a virtual machine, trust the virtualizer
+  const cpuinfo_virtualizer_info_t *vip = cpuinfo_get_virtualizer_info(cip);
+  if (vip && vip->id != CPUINFO_VIRTUALIZER_NONE && vip->tsc_frequency > 0)
+	return (vip->tsc_frequency + 500) / 1000;
+
   start = get_ticks_usec();
   ticks_start = get_ticks();
   while ((get_ticks_usec() - start) < 50000) {
@@ -779,6 +782,41 @@ int cpuinfo_arch_get_socket(struct cpuinfo *cip)
   return socket;
 }
 
+// Get processor family (including extended family)
+static int get_family(void)
+{
+  uint32_t eax;
+  cpuid(1, &eax, NULL, NULL, NULL);
+  int family = (eax >> 8) & 0xf;
+  if (family == 0xf)
+	family += (eax >> 20) & 0xff;
+  return family;
+}
+
+// Check for AMD TopologyExtensions, i.e. cpuid(0x8000001d) and cpuid(0x8000001e)
+static int has_topology_extensions(void)
+{
+  uint32_t eax, ecx = 0;
+  cpuid(0x80000000, &eax, NULL, NULL, NULL);
+  if ((eax & 0xffff0000) != 0x80000000 || eax < 0x8000001e)
+	return 0;
+  cpuid(0x80000001, NULL, NULL, &ecx, NULL);
+  return (ecx & (1 << 22)) != 0;
+}
+
+// Get number of threads per AMD core (Family 17h and later)
+// Reference: AMD64 Architecture Programmer's Manual Volume 3, Appendix E.4
+static int get_threads_per_core_amd(void)
+{
+  // cpuid(0x8000001e) EBX[15:8] is CoresPerComputeUnit on Family 15h
+  // (all of them are real cores), and ThreadsPerCore since Family 17h
+  if (get_family() < 0x17 || !has_topology_extensions())
+	return 1;
+  uint32_t ebx;
+  cpuid(0x8000001e, NULL, &ebx, NULL, NULL);
+  return 1 + ((ebx >> 8) & 0xff);
+}
+
 // Get number of cores per CPU package
 int cpuinfo_arch_get_cores(struct cpuinfo *cip)
 {
@@ -794,12 +832,19 @@ int cpuinfo_arch_get_cores(struct cpuinfo *cip)
 	}
   }
 
-  /* AMD Dual Core characterisation */
-  else if (cpuinfo_get_vendor(cip) == CPUINFO_VENDOR_AMD) {
+  /* AMD Multi Core characterisation */
+  else if (is_amd_compatible(cip)) {
 	cpuid(0x80000000, &eax, NULL, NULL, NULL);
 	if (eax >= 0x80000008) {
 	  cpuid(0x80000008, NULL, NULL, &ecx, NULL);
-	  return 1 + (ecx & 0xff);
+	  // NC is the number of threads in the package minus one, it is
+	  // bounded by ApicIdCoreIdSize, if defined
+	  int n_threads = 1 + (ecx & 0xff);
+	  int apic_id_core_id_size = (ecx >> 12) & 0xf;
+	  if (apic_id_core_id_size > 0 && n_threads > (1 << apic_id_core_id_size))
+		n_threads = 1 << apic_id_core_id_size;
+	  int n_cores = n_threads / get_threads_per_core_amd();
+	  return n_cores > 0 ? n_cores : 1;
 	}
   }
 
@@ -812,6 +857,9 @@ int cpuinfo_arch_get_threads(struct cpuinfo *cip)
   uint32_t eax, ebx, edx;
 
   switch (cpuinfo_get_vendor(cip)) {
+  case CPUINFO_VENDOR_AMD:
+  case CPUINFO_VENDOR_HYGON:
+	return get_threads_per_core_amd();
   case CPUINFO_VENDOR_INTEL:
 	/* Check for Hyper Threading Technology activated */
 	/* See "Intel Processor Identification and the CPUID Instruction" (3.3 Feature Flags) */
@@ -830,79 +878,537 @@ int cpuinfo_arch_get_threads(struct cpuinfo *cip)
   return 1;
 }
 
-// Get cache information (initialize with iter = 0, returns the
-// iteration number or -1 if no more information available)
-// Reference: Application Note 485 -- Intel Processor Identification
+// Get type of the current processor core
+int cpuinfo_arch_get_core_type(struct cpuinfo *cip, int *native_model)
+{
+  uint32_t eax, edx;
+
+  *native_model = -1;
+  if (cpuinfo_get_vendor(cip) != CPUINFO_VENDOR_INTEL)
+	return CPUINFO_CORE_TYPE_UNKNOWN;
+
+  /* See "Intel 64 and IA-32 Architectures Software Developer's Manual", CPUID leaf 1AH */
+  cpuid(0, &eax, NULL, NULL, NULL);
+  if (eax < 0x1a)
+	return CPUINFO_CORE_TYPE_UNKNOWN;
+  cpuid(7, NULL, NULL, NULL, &edx);
+  if ((edx & (1 << 15)) == 0) /* Hybrid flag */
+	return CPUINFO_CORE_TYPE_UNKNOWN;
+  cpuid(0x1a, &eax, NULL, NULL, NULL);
+  *native_model = eax & 0xffffff;
+  switch (eax >> 24) {
+  case 0x20: /* Intel Atom */
+	return CPUINFO_CORE_TYPE_EFFICIENCY;
+  case 0x40: /* Intel Core */
+	return CPUINFO_CORE_TYPE_PERFORMANCE;
+  }
+  return CPUINFO_CORE_TYPE_UNKNOWN;
+}
+
+// Intel Family 6 models
+// Reference: Intel 64 and IA-32 Architectures Software Developer's Manual, Volume 4, Table 2-1
+static const struct {
+  uint8_t model;
+  uint8_t min_stepping;
+  uint8_t uarch;			// CPUINFO_UARCH_* - CPUINFO_UARCH_P5
+  uint8_t atom_uarch;		// same for efficiency cores of hybrid processors, 0 if none
+}
+intel_uarch_table[] = {
+#define U_(NAME) CPUINFO_UARCH_##NAME - CPUINFO_UARCH_P5
+  { 0x01, 0, U_(P6),				0						}, // Pentium Pro
+  { 0x03, 0, U_(P6),				0						}, // Pentium II (Klamath)
+  { 0x05, 0, U_(P6),				0						}, // Pentium II (Deschutes)
+  { 0x06, 0, U_(P6),				0						}, // Celeron (Mendocino)
+  { 0x07, 0, U_(P6),				0						}, // Pentium III (Katmai)
+  { 0x08, 0, U_(P6),				0						}, // Pentium III (Coppermine)
+  { 0x09, 0, U_(PENTIUM_M),			0						}, // Pentium M (Banias)
+  { 0x0a, 0, U_(P6),				0						}, // Pentium III Xeon (Cascades)
+  { 0x0b, 0, U_(P6),				0						}, // Pentium III (Tualatin)
+  { 0x0d, 0, U_(PENTIUM_M),			0						}, // Pentium M (Dothan)
+  { 0x0e, 0, U_(CORE),				0						}, // Core Duo (Yonah)
+  { 0x0f, 0, U_(CORE2),				0						}, // Core 2 (Merom)
+  { 0x16, 0, U_(CORE2),				0						}, // Core 2 (Merom-L)
+  { 0x17, 0, U_(PENRYN),			0						},
+  { 0x1a, 0, U_(NEHALEM),			0						}, // Nehalem-EP
+  { 0x1c, 0, U_(BONNELL),			0						},
+  { 0x1d, 0, U_(PENRYN),			0						}, // Dunnington
+  { 0x1e, 0, U_(NEHALEM),			0						}, // Lynnfield
+  { 0x1f, 0, U_(NEHALEM),			0						}, // Havendale
+  { 0x25, 0, U_(WESTMERE),			0						}, // Arrandale
+  { 0x26, 0, U_(BONNELL),			0						}, // Lincroft
+  { 0x27, 0, U_(SALTWELL),			0						}, // Penwell
+  { 0x2a, 0, U_(SANDY_BRIDGE),		0						},
+  { 0x2c, 0, U_(WESTMERE),			0						}, // Westmere-EP
+  { 0x2d, 0, U_(SANDY_BRIDGE),		0						}, // Sandy Bridge-E
+  { 0x2e, 0, U_(NEHALEM),			0						}, // Nehalem-EX
+  { 0x2f, 0, U_(WESTMERE),			0						}, // Westmere-EX
+  { 0x35, 0, U_(SALTWELL),			0						}, // Cloverview
+  { 0x36, 0, U_(SALTWELL),			0						}, // Cedarview
+  { 0x37, 0, U_(SILVERMONT),		0						}, // Bay Trail
+  { 0x3a, 0, U_(IVY_BRIDGE),		0						},
+  { 0x3c, 0, U_(HASWELL),			0						},
+  { 0x3d, 0, U_(BROADWELL),			0						},
+  { 0x3e, 0, U_(IVY_BRIDGE),		0						}, // Ivy Bridge-E
+  { 0x3f, 0, U_(HASWELL),			0						}, // Haswell-E
+  { 0x45, 0, U_(HASWELL),			0						}, // Haswell-ULT
+  { 0x46, 0, U_(HASWELL),			0						}, // Crystal Well
+  { 0x47, 0, U_(BROADWELL),			0						}, // Broadwell-H
+  { 0x4a, 0, U_(SILVERMONT),		0						}, // Merrifield
+  { 0x4c, 0, U_(AIRMONT),			0						}, // Cherry Trail
+  { 0x4d, 0, U_(SILVERMONT),		0						}, // Avoton
+  { 0x4e, 0, U_(SKYLAKE),			0						}, // Skylake-U/Y
+  { 0x4f, 0, U_(BROADWELL),			0						}, // Broadwell-E
+  { 0x55, 0, U_(SKYLAKE_SP),		0						},
+  { 0x55, 5, U_(CASCADE_LAKE),		0						},
+  { 0x55, 10, U_(COOPER_LAKE),		0						},
+  { 0x56, 0, U_(BROADWELL),			0						}, // Broadwell-DE
+  { 0x57, 0, U_(KNIGHTS_LANDING),	0						},
+  { 0x5a, 0, U_(SILVERMONT),		0						}, // Moorefield
+  { 0x5c, 0, U_(GOLDMONT),			0						}, // Apollo Lake
+  { 0x5d, 0, U_(SILVERMONT),		0						}, // SoFIA
+  { 0x5e, 0, U_(SKYLAKE),			0						}, // Skylake-H/S
+  { 0x5f, 0, U_(GOLDMONT),			0						}, // Denverton
+  { 0x66, 0, U_(CANNON_LAKE),		0						},
+  { 0x6a, 0, U_(ICE_LAKE_SP),		0						},
+  { 0x6c, 0, U_(ICE_LAKE_SP),		0						}, // Ice Lake-D
+  { 0x7a, 0, U_(GOLDMONT_PLUS),		0						}, // Gemini Lake
+  { 0x7d, 0, U_(ICE_LAKE),			0						},
+  { 0x7e, 0, U_(ICE_LAKE),			0						}, // Ice Lake-U/Y
+  { 0x85, 0, U_(KNIGHTS_MILL),		0						},
+  { 0x86, 0, U_(TREMONT),			0						}, // Jacobsville
+  { 0x8a, 0, U_(ICE_LAKE),			U_(TREMONT)				}, // Lakefield
+  { 0x8c, 0, U_(TIGER_LAKE),		0						},
+  { 0x8d, 0, U_(TIGER_LAKE),		0						}, // Tiger Lake-H
+  { 0x8e, 0, U_(SKYLAKE),			0						}, // Kaby/Coffee/Whiskey/Amber/Comet Lake-U
+  { 0x8f, 0, U_(SAPPHIRE_RAPIDS),	0						},
+  { 0x96, 0, U_(TREMONT),			0						}, // Elkhart Lake
+  { 0x97, 0, U_(GOLDEN_COVE),		U_(GRACEMONT)			}, // Alder Lake-S
+  { 0x9a, 0, U_(GOLDEN_COVE),		U_(GRACEMONT)			}, // Alder Lake-P
+  { 0x9c, 0, U_(TREMONT),			0						}, // Jasper Lake
+  { 0x9e, 0, U_(SKYLAKE),			0						}, // Kaby/Coffee Lake-S/H
+  { 0xa5, 0, U_(SKYLAKE),			0						}, // Comet Lake-S/H
+  { 0xa6, 0, U_(SKYLAKE),			0						}, // Comet Lake-U
+  { 0xa7, 0, U_(ROCKET_LAKE),		0						},
+  { 0xaa, 0, U_(REDWOOD_COVE),		U_(CRESTMONT)			}, // Meteor Lake
+  { 0xac, 0, U_(REDWOOD_COVE),		U_(CRESTMONT)			}, // Meteor Lake-S
+  { 0xad, 0, U_(GRANITE_RAPIDS),	0						},
+  { 0xae, 0, U_(GRANITE_RAPIDS),	0						}, // Granite Rapids-D
+  { 0xaf, 0, U_(CRESTMONT),			0						}, // Sierra Forest
+  { 0xb6, 0, U_(CRESTMONT),			0						}, // Grand Ridge
+  { 0xb7, 0, U_(RAPTOR_COVE),		U_(GRACEMONT)			}, // Raptor Lake-S
+  { 0xba, 0, U_(RAPTOR_COVE),		U_(GRACEMONT)			}, // Raptor Lake-P
+  { 0xbd, 0, U_(LION_COVE),			U_(SKYMONT)				}, // Lunar Lake
+  { 0xbe, 0, U_(GRACEMONT),			0						}, // Alder Lake-N
+  { 0xbf, 0, U_(RAPTOR_COVE),		U_(GRACEMONT)			}, // Raptor Lake-S refresh
+  { 0xc5, 0, U_(LION_COVE),			U_(SKYMONT)				}, // Arrow Lake-H
+  { 0xc6, 0, U_(LION_COVE),			U_(SKYMONT)				}, // Arrow Lake-S
+  { 0xcf, 0, U_(EMERALD_RAPIDS),	0						},
+  { 0x00, 0, 0,						0						}
+#undef U_
+};
+
+// Get Intel processor microarchitecture
+static int get_uarch_intel(struct cpuinfo *cip, int core_type, int family, int model, int stepping)
+{
+  int k, uarch = CPUINFO_UARCH_UNKNOWN;
+
+  switch (family) {
+  case 5:
+	return CPUINFO_UARCH_P5;
+  case 6:
+	break;
+  case 15:
+	return CPUINFO_UARCH_NETBURST;
+  default:
+	return CPUINFO_UARCH_UNKNOWN;
+  }
+
+  // entries with the same model are sorted by increasing stepping
+  for (k = 0; intel_uarch_table[k].model != 0; k++) {
+	if (intel_uarch_table[k].model == model && stepping >= intel_uarch_table[k].min_stepping) {
+	  uarch = CPUINFO_UARCH_P5 + intel_uarch_table[k].uarch;
+	  if (intel_uarch_table[k].atom_uarch) {
+		int native_model;
+		if (core_type == CPUINFO_CORE_TYPE_UNKNOWN)
+		  core_type = cpuinfo_arch_get_core_type(cip, &native_model);
+		if (core_type == CPUINFO_CORE_TYPE_EFFICIENCY)
+		  uarch = CPUINFO_UARCH_P5 + intel_uarch_table[k].atom_uarch;
+	  }
+	}
+  }
+  return uarch;
+}
+
+// Get AMD processor microarchitecture
+static int get_uarch_amd(int family, int model)
+{
+  switch (family) {
+  case 0x05:
+	return model >= 6 ? CPUINFO_UARCH_K6 : CPUINFO_UARCH_UNKNOWN;
+  case 0x06:
+	return CPUINFO_UARCH_K7;
+  case 0x0f:
+  case 0x11:
+	return CPUINFO_UARCH_K8;
+  case 0x10:
+  case 0x12:
+	return CPUINFO_UARCH_K10;
+  case 0x14:
+	return CPUINFO_UARCH_BOBCAT;
+  case 0x15:
+	if (model >= 0x60)
+	  return CPUINFO_UARCH_EXCAVATOR;
+	if (model >= 0x30)
+	  return CPUINFO_UARCH_STEAMROLLER;
+	if (model >= 0x10 || model == 0x02)
+	  return CPUINFO_UARCH_PILEDRIVER;
+	return CPUINFO_UARCH_BULLDOZER;
+  case 0x16:
+	return model >= 0x30 ? CPUINFO_UARCH_PUMA : CPUINFO_UARCH_JAGUAR;
+  case 0x17:
+	if (model >= 0x30)
+	  return CPUINFO_UARCH_ZEN2;
+	if (model == 0x08 || model == 0x18)	// Pinnacle Ridge, Picasso
+	  return CPUINFO_UARCH_ZEN_PLUS;
+	return CPUINFO_UARCH_ZEN;
+  case 0x18:	// Hygon Dhyana
+	return CPUINFO_UARCH_ZEN;
+  case 0x19:
+	if ((model >= 0x10 && model <= 0x1f) || (model >= 0x60 && model <= 0xaf))
+	  return CPUINFO_UARCH_ZEN4;
+	return CPUINFO_UARCH_ZEN3;
+  case 0x1a:
+	return CPUINFO_UARCH_ZEN5;
+  }
+  return CPUINFO_UARCH_UNKNOWN;
+}
+
+// Get processor signature (family, model, stepping)
+uint32_t cpuinfo_arch_get_signature(struct cpuinfo *cip)
+{
+  uint32_t eax;
+  cpuid(1, &eax, NULL, NULL, NULL);
+  return eax;
+}
+
+// Get processor microarchitecture (of the current core if CORE_TYPE is unknown)
+int cpuinfo_arch_get_uarch(struct cpuinfo *cip, int core_type)
+{
+  uint32_t eax;
+  cpuid(1, &eax, NULL, NULL, NULL);
+  int stepping = eax & 0xf;
+  int model = (eax >> 4) & 0xf;
+  int family = (eax >> 8) & 0xf;
+  if (family == 0x6 || family == 0xf)
+	model |= (eax >> 12) & 0xf0;
+  if (family == 0xf)
+	family += (eax >> 20) & 0xff;
+  D(bug("cpuinfo_get_uarch: family %02x, model %02x, stepping %d\n", family, model, stepping));
+
+  switch (cpuinfo_get_vendor(cip)) {
+  case CPUINFO_VENDOR_INTEL:
+	return get_uarch_intel(cip, core_type, family, model, stepping);
+  case CPUINFO_VENDOR_AMD:
+  case CPUINFO_VENDOR_HYGON:
+	return get_uarch_amd(family, model);
+  }
+  return CPUINFO_UARCH_UNKNOWN;
+}
+
+// Get extended state components enabled by the OS
+int cpuinfo_arch_get_xsave_info(struct cpuinfo *cip, cpuinfo_xsave_t *xsp)
+{
+  uint32_t eax, ebx, ecx, edx;
+  int i, count;
+
+  cpuid(0, &eax, NULL, NULL, NULL);
+  if (eax < 1)
+	return -1;
+  cpuid(1, NULL, NULL, NULL, &edx);
+  if ((edx & (1 << 24)) == 0) /* FXSR */
+	return -1;
+
+  // legacy region: x87 and SSE state (FXSAVE format)
+  uint64_t xcr0 = get_xcr0();
+  if (xcr0 == 0 || eax < 0xd)
+	xcr0 = XCR0_X87 | XCR0_SSE;
+  // the legacy region always holds both, even if SSE state is not enabled
+  for (i = 2, count = 2; i < 64; i++) {
+	if (xcr0 & ((uint64_t)1 << i))
+	  ++count;
+  }
+  cpuinfo_xsave_component_t *components = (cpuinfo_xsave_component_t *)calloc(count, sizeof(*components));
+  if (components == NULL)
+	return -1;
+  xsp->components = components;
+  components[0].id = CPUINFO_XSAVE_COMPONENT_X87;
+  components[0].size = 160;
+  components[0].offset = 0;
+  components[1].id = CPUINFO_XSAVE_COMPONENT_SSE;
+  components[1].size = 256;
+  components[1].offset = 160;
+  xsp->count = 2;
+  xsp->size = 512;
+  xsp->max_size = 512;
+  xsp->save_insn = CPUINFO_XSAVE_INSN_FXSAVE;
+  if (!cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_OSXSAVE))
+	return 0;
+
+  /* See "Intel 64 and IA-32 Architectures Software Developer's Manual", CPUID leaf 0DH */
+  ecx = 0;
+  cpuid(0xd, NULL, &ebx, &ecx, NULL);
+  xsp->size = ebx;
+  xsp->max_size = ecx;
+  int compacted_size = 512 + 64; // legacy region + XSAVE header
+  for (i = 2; i < 64; i++) {
+	if ((xcr0 & ((uint64_t)1 << i)) == 0)
+	  continue;
+	ecx = i;
+	cpuid(0xd, &eax, &ebx, &ecx, NULL);
+	cpuinfo_xsave_component_t *xcp = &components[xsp->count++];
+	xcp->id = i;
+	xcp->size = eax;
+	xcp->offset = ebx;
+	xcp->aligned = (ecx & (1 << 1)) != 0;
+	if (xcp->aligned)
+	  compacted_size = (compacted_size + 63) & -64;
+	compacted_size += xcp->size;
+  }
+
+  // XSAVEC saves the smallest area, XSAVEOPT skips unmodified components
+  if (cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_XSAVEC)) {
+	xsp->compacted_size = compacted_size;
+	xsp->save_insn = CPUINFO_XSAVE_INSN_XSAVEC;
+  }
+  else if (cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_XSAVEOPT))
+	xsp->save_insn = CPUINFO_XSAVE_INSN_XSAVEOPT;
+  else
+	xsp->save_insn = CPUINFO_XSAVE_INSN_XSAVE;
+  return 0;
+}
+
+// Get AMX tile palette information
+int cpuinfo_arch_get_tile_info(struct cpuinfo *cip, cpuinfo_tile_info_t *tip)
+{
+  uint32_t eax, ebx, ecx, edx;
+
+  if (!cpuinfo_arch_has_hardware_feature(cip, CPUINFO_FEATURE_X86_AMX_TILE))
+	return -1;
+
+  /* See "Intel 64 and IA-32 Architectures Software Developer's Manual", CPUID leaves 1DH and 1EH */
+  cpuid(0, &eax, NULL, NULL, NULL);
+  if (eax < 0x1d)
+	return -1;
+  ecx = 0;
+  cpuid(0x1d, &eax, NULL, &ecx, NULL);
+  tip->max_palette = eax;
+  if (tip->max_palette < 1)
+	return -1;
+  ecx = 1;
+  cpuid(0x1d, &eax, &ebx, &ecx, &edx);
+  tip->total_tile_bytes = eax & 0xffff;
+  tip->bytes_per_tile = eax >> 16;
+  tip->bytes_per_row = ebx & 0xffff;
+  tip->max_names = ebx >> 16;
+  tip->max_rows = ecx & 0xffff;
+
+  cpuid(0, &eax, NULL, NULL, NULL);
+  if (eax >= 0x1e) {
+	ecx = 0;
+	cpuid(0x1e, NULL, &ebx, &ecx, NULL);
+	tip->tmul_maxk = ebx & 0xff;
+	tip->tmul_maxn = (ebx >> 8) & 0xffff;
+  }
+  return 0;
+}
+
+static void get_features(uint32_t *features, uint32_t *hw_features, int vendor);
+
+// Request permission to use AMX tile data
+int cpuinfo_arch_request_tile_permission(struct cpuinfo *cip)
+{
+  // the feature bits are cleared until permission is granted
+  if (!cpuinfo_arch_has_hardware_feature(cip, CPUINFO_FEATURE_X86_AMX_TILE))
+	return 0;
+  if ((get_xcr0() & XCR0_AMX_STATE) != XCR0_AMX_STATE)
+	return 0;
+  if (get_xcomp_perm() & (1UL << XFEATURE_XTILEDATA))
+	return 1;
+
+#if defined __x86_64__ && defined __linux__ && defined SYS_arch_prctl
+  if (syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) < 0)
+	return 0;
+  if ((get_xcomp_perm() & (1UL << XFEATURE_XTILEDATA)) == 0)
+	return 0;
+  // report the tile features again
+  x86_cpuinfo_t *p = (x86_cpuinfo_t *)(cip->opaque);
+  get_features(p->features, NULL, cpuinfo_get_vendor(cip));
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+// Virtualizer signatures in CPUID leaf 0x40000000
 static const struct {
-  uint8_t desc;
-  uint8_t level;
-  uint8_t type;
-  uint16_t size;
-}
-intel_cache_table[] = {
-#define C_(LEVEL, TYPE) LEVEL, CPUINFO_CACHE_TYPE_##TYPE
-  { 0x06, C_(1, CODE),		    8 }, // 4-way set assoc, 32 byte line size
-  { 0x08, C_(1, CODE),		   16 }, // 4-way set assoc, 32 byte line size
-  { 0x0a, C_(1, DATA),		    8 }, // 2 way set assoc, 32 byte line size
-  { 0x0c, C_(1, DATA),		   16 }, // 4-way set assoc, 32 byte line size
-  { 0x10, C_(1, DATA),		   16 }, // 4-way set assoc, 64 byte line size
-  { 0x15, C_(1, CODE),		   16 }, // 4-way set assoc, 64 byte line size
-  { 0x1a, C_(2, UNIFIED),	   96 }, // 6-way set assoc, 64 byte line size
-  { 0x22, C_(3, UNIFIED),	  512 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x23, C_(3, UNIFIED),	 1024 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x25, C_(3, UNIFIED),	 2048 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x29, C_(3, UNIFIED),	 4096 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x2c, C_(1, DATA),		   32 }, // 8-way set assoc, 64 byte line size
-  { 0x30, C_(1, CODE),		   32 }, // 8-way set assoc, 64 byte line size
-  { 0x39, C_(2, UNIFIED),	  128 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x3a, C_(2, UNIFIED),	  192 }, // 6-way set assoc, sectored cache, 64 byte line size
-  { 0x3b, C_(2, UNIFIED),	  128 }, // 2-way set assoc, sectored cache, 64 byte line size
-  { 0x3c, C_(2, UNIFIED),	  256 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x3d, C_(2, UNIFIED),	  384 }, // 6-way set assoc, sectored cache, 64 byte line size
-  { 0x3e, C_(2, UNIFIED),	  512 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x41, C_(2, UNIFIED),	  128 }, // 4-way set assoc, 32 byte line size
-  { 0x42, C_(2, UNIFIED),	  256 }, // 4-way set assoc, 32 byte line size
-  { 0x43, C_(2, UNIFIED),	  512 }, // 4-way set assoc, 32 byte line size
-  { 0x44, C_(2, UNIFIED),	 1024 }, // 4-way set assoc, 32 byte line size
-  { 0x45, C_(2, UNIFIED),	 2048 }, // 4-way set assoc, 32 byte line size
-  { 0x46, C_(3, UNIFIED),	 4096 }, // 4-way set assoc, 64 byte line size
-  { 0x47, C_(3, UNIFIED),	 8192 }, // 8-way set assoc, 64 byte line size
-  { 0x49, C_(3, UNIFIED),	 4096 }, // 16-way set assoc, 64 byte line size
-  { 0x4a, C_(3, UNIFIED),	 6144 }, // 12-way set assoc, 64 byte line size
-  { 0x4b, C_(3, UNIFIED),	 8192 }, // 16-way set assoc, 64 byte line size
-  { 0x4c, C_(3, UNIFIED),	12288 }, // 12-way set assoc, 64 byte line size
-  { 0x4d, C_(3, UNIFIED),	16384 }, // 16-way set assoc, 64 byte line size
-  { 0x60, C_(1, DATA),		   16 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x66, C_(1, DATA),		    8 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x67, C_(1, DATA),		   16 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x68, C_(1, DATA),		   32 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x70, C_(0, TRACE),		   12 }, // 8-way set assoc
-  { 0x71, C_(0, TRACE),		   16 }, // 8-way set assoc
-  { 0x72, C_(0, TRACE),		   32 }, // 8-way set assoc
-  { 0x73, C_(0, TRACE),		   64 }, // 8-way set assoc
-  { 0x77, C_(1, CODE),		   16 }, // 4-way set assoc, sectored cache, 64 byte line size
-  { 0x78, C_(2, UNIFIED),	 1024 }, // 4-way set assoc, 64 byte line size
-  { 0x79, C_(2, UNIFIED),	  128 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x7a, C_(2, UNIFIED),	  256 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x7b, C_(2, UNIFIED),	  512 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x7c, C_(2, UNIFIED),	 1024 }, // 8-way set assoc, sectored cache, 64 byte line size
-  { 0x7e, C_(2, UNIFIED),	  256 }, // 8-way set assoc, sectored cache, 128 byte line size
-  { 0x7d, C_(2, UNIFIED),	 2048 }, // 8-way set assoc, 64 byte line size
-  { 0x7f, C_(2, UNIFIED),	  512 }, // 2-way set assoc, 64 byte line size
-  { 0x82, C_(2, UNIFIED),	  256 }, // 8-way set assoc, 32 byte line size
-  { 0x83, C_(2, UNIFIED),	  512 }, // 8-way set assoc, 32 byte line size
-  { 0x84, C_(2, UNIFIED),	 1024 }, // 8-way set assoc, 32 byte line size
-  { 0x85, C_(2, UNIFIED),	 2048 }, // 8-way set assoc, 32 byte line size
-  { 0x86, C_(2, UNIFIED),	  512 }, // 4-way set assoc, 64 byte line size
-  { 0x87, C_(2, UNIFIED),	 1024 }, // 8-way set assoc, 64 byte line size
-  { 0x88, C_(3, UNIFIED),	 2048 }, // 4-way set assoc, 64 byte line size
-  { 0x89, C_(3, UNIFIED),	 4096 }, // 4-way set assoc, 64 byte line size
-  { 0x8a, C_(3, UNIFIED),	 8192 }, // 4-way set assoc, 64 byte line size
-  { 0x8d, C_(3, UNIFIED),	 3072 }, // 12-way set assoc, 128 byte line size
-  { 0x00, C_(0, UNKNOWN),	    0 }
-#undef C_
+  const char *signature;
+  int id;
+} x86_virtualizers[] = {
+  { "KVMKVMKVM",		CPUINFO_VIRTUALIZER_KVM			},
+  { "XenVMMXenVMM",		CPUINFO_VIRTUALIZER_XEN			},
+  { "Microsoft Hv",		CPUINFO_VIRTUALIZER_HYPERV		},
+  { "VMwareVMware",		CPUINFO_VIRTUALIZER_VMWARE		},
+  { "VBoxVBoxVBox",		CPUINFO_VIRTUALIZER_VIRTUALBOX	},
+  { " lrpepyh  vr",		CPUINFO_VIRTUALIZER_PARALLELS	},
+  { "TCGTCGTCGTCG",		CPUINFO_VIRTUALIZER_QEMU		},
+  { "bhyve bhyve ",		CPUINFO_VIRTUALIZER_BHYVE		},
+  { "ACRNACRNACRN",		CPUINFO_VIRTUALIZER_ACRN		},
+  { NULL,				-1								}
 };
 
+// Get virtualizer from the hypervisor CPUID leaves at BASE
+static int get_virtualizer_id(uint32_t base, uint32_t *max_leaf)
+{
+  union { uint32_t r[3]; char str[13]; } sig = { { 0, 0, 0 } };
+  int i;
+
+  cpuid(base, max_leaf, &sig.r[0], &sig.r[1], &sig.r[2]);
+  sig.str[12] = '\0';
+  for (i = 0; x86_virtualizers[i].signature != NULL; i++) {
+	if (strcmp(sig.str, x86_virtualizers[i].signature) == 0)
+	  return x86_virtualizers[i].id;
+  }
+  D(bug("unknown hypervisor signature '%s' at %08x\n", sig.str, base));
+  return CPUINFO_VIRTUALIZER_UNKNOWN;
+}
+
+// Measure the cost of one CPUID instruction in TSC ticks
+static int get_cpuid_cost(void)
+{
+  uint64_t ticks, best_cpuid = (uint64_t)-1, best_empty = (uint64_t)-1;
+  int i;
+
+  uint32_t edx;
+  cpuid(1, NULL, NULL, NULL, &edx);
+  if ((edx & (1 << 4)) == 0) /* TSC */
+	return -1;
+
+  // keep the minimum to filter out interrupts and host preemption
+  for (i = 0; i < 100; i++) {
+	ticks = get_ticks();
+	ticks = get_ticks() - ticks;
+	if (best_empty > ticks)
+	  best_empty = ticks;
+	ticks = get_ticks();
+	cpuid(0, NULL, NULL, NULL, NULL);
+	ticks = get_ticks() - ticks;
+	if (best_cpuid > ticks)
+	  best_cpuid = ticks;
+  }
+  return best_cpuid > best_empty ? best_cpuid - best_empty : 0;
+}
+
+// Get virtualizer and paravirtual timing information
+int cpuinfo_arch_get_virtualizer(struct cpuinfo *cip, cpuinfo_virtualizer_info_t *vip)
+{
+  uint32_t eax, ebx, ecx = 0;
+
+  vip->cpuid_cost = get_cpuid_cost();
+
+  cpuid(1, NULL, NULL, &ecx, NULL);
+  if ((ecx & (1U << 31)) == 0) { /* hypervisor present */
+	vip->id = CPUINFO_VIRTUALIZER_NONE;
+	return 0;
+  }
+
+  // KVM and Xen move their own leaves to 0x40000100 when they also expose Hyper-V enlightenments
+  uint32_t base = 0x40000000, max_leaf;
+  vip->id = get_virtualizer_id(base, &max_leaf);
+  if (vip->id == CPUINFO_VIRTUALIZER_HYPERV || vip->id == CPUINFO_VIRTUALIZER_UNKNOWN) {
+	uint32_t alt_max_leaf;
+	int id = get_virtualizer_id(base + 0x100, &alt_max_leaf);
+	if (id == CPUINFO_VIRTUALIZER_KVM || id == CPUINFO_VIRTUALIZER_XEN) {
+	  vip->id = id;
+	  base += 0x100;
+	  max_leaf = alt_max_leaf;
+	}
+  }
+  if (vip->id == CPUINFO_VIRTUALIZER_KVM && max_leaf == 0)
+	max_leaf = base + 1;
+  if (max_leaf < base || max_leaf > base + 0xff)
+	return 0;
+
+  // Generic timing information leaf, originally defined by VMware
+  if (max_leaf >= base + 0x10) {
+	cpuid(base + 0x10, &eax, &ebx, NULL, NULL);
+	vip->tsc_frequency = eax;
+	vip->apic_frequency = ebx;
+  }
+
+  switch (vip->id) {
+  case CPUINFO_VIRTUALIZER_KVM:
+	if (max_leaf >= base + 1) {
+	  cpuid(base + 1, &eax, NULL, NULL, NULL);
+	  if (eax & ((1 << 0) | (1 << 3))) /* KVM_FEATURE_CLOCKSOURCE{,2} */
+		vip->has_pvclock = 1;
+	}
+	break;
+  case CPUINFO_VIRTUALIZER_XEN:
+	// the Xen shared info page always provides a paravirtual clock
+	vip->has_pvclock = 1;
+	break;
+  case CPUINFO_VIRTUALIZER_HYPERV:
+	if (max_leaf >= base + 3) {
+	  cpuid(base + 3, &eax, NULL, NULL, NULL);
+	  if (eax & (1 << 9)) /* reference TSC page */
+		vip->has_pvclock = 1;
+	}
+	break;
+  }
+  return 0;
+}
+
+// Special cpuid(2) descriptors
+#define INTEL_DESC_PREFETCH_64		0xf0	// 64-byte prefetching
+#define INTEL_DESC_PREFETCH_128		0xf1	// 128-byte prefetching
+#define INTEL_DESC_NO_TLB_INFO		0xfe	// use cpuid(0x18) for TLB information
+#define INTEL_DESC_NO_CACHE_INFO	0xff	// use cpuid(4) for cache information
+
+// Get descriptor bytes returned by cpuid(2), returns the number of descriptors
+static int get_intel_descriptors(uint8_t *descs, int max_descs)
+{
+  int i, j, n, n_descs = 0;
+  uint32_t regs[4];
+  uint8_t *dp = (uint8_t *)regs;
+
+  cpuid(2, &regs[0], NULL, NULL, NULL);
+  n = regs[0] & 0xff;						// number of times to iterate
+  for (i = 0; i < n; i++) {
+	cpuid(2, &regs[0], &regs[1], &regs[2], &regs[3]);
+	for (j = 0; j < 4; j++) {
+	  if (regs[j] & 0x80000000)
+		regs[j] = 0;
+	}
+	for (j = 1; j < 16; j++) {
+	  if (dp[j] != 0 && n_descs < max_descs)
+		descs[n_descs++] = dp[j];
+	}
+  }
+  return n_descs;
+}
+
+// Returns 1 if cpuid(2) reports descriptor DESC
+static int has_intel_descriptor(uint8_t desc)
+{
+  uint8_t descs[64];
+  int i, n_descs = get_intel_descriptors(descs, sizeof(descs));
+  for (i = 0; i < n_descs; i++) {
+	if (descs[i] == desc)
+	  return 1;
+  }
+  return 0;
+}
+
 enum {
   CACHE_INFO_ERRATA_AMD_DURON = 1,	 // AMD K7 processors with CPUID=630h (Duron)
   CACHE_INFO_ERRATA_VIA_C3_1,		 // VIA C3 processors with CPUID=670..68Fh
@@ -959,6 +1465,64 @@ static inline int has_cache_info_errata(struct cpuinfo *cip, int errata)
   return 0;
 }
 
+// Decode deterministic cache parameters, as returned by cpuid(4) on
+// Intel processors or cpuid(0x8000001d) on AMD processors
+static int decode_cache_parameters(uint32_t leaf, int index, cpuinfo_cache_descriptor_t *cdp)
+{
+  uint32_t eax, ebx, ecx, edx;
+  ecx = index;
+  cpuid(leaf, &eax, &ebx, &ecx, &edx);
+  int cache_type = eax & 0x1f;
+  if (cache_type == 0)
+	return -1;
+  switch (cache_type) {
+  case 1: cache_type = CPUINFO_CACHE_TYPE_DATA; break;
+  case 2: cache_type = CPUINFO_CACHE_TYPE_CODE; break;
+  case 3: cache_type = CPUINFO_CACHE_TYPE_UNIFIED; break;
+  default: cache_type = CPUINFO_CACHE_TYPE_UNKNOWN; break;
+  }
+  cdp->type = cache_type;
+  cdp->level = (eax >> 5) & 7;
+  uint32_t W = 1 + ((ebx >> 22) & 0x3f);	// ways of associativity
+  uint32_t P = 1 + ((ebx >> 12) & 0x1f);	// physical line partition
+  uint32_t L = 1 + (ebx & 0xfff);			// system coherency line size
+  uint32_t S = 1 + ecx;						// number of sets
+  cdp->size = (L * W * P * S) / 1024;
+  cdp->sharing = 1 + ((eax >> 14) & 0xfff);	// addressable IDs sharing this cache
+  cdp->line_size = L;
+  cdp->ways = (eax & (1 << 9)) ? -1 : W;		// fully associative cache
+  return 0;
+}
+
+// Convert the maximum number of addressable logical processor IDs
+// sharing a cache or TLB into the number of enabled logical processors
+// XXX assumes the addressable IDs are split the same way as the APIC IDs
+static int get_enabled_sharing(struct cpuinfo *cip, int max_ids)
+{
+  int n_threads = cpuinfo_get_threads(cip);
+  int n_cores = cpuinfo_get_cores(cip);
+  int smt_ids = 1;
+  while (smt_ids < n_threads)
+	smt_ids <<= 1;
+  if (max_ids <= smt_ids)
+	return max_ids < n_threads ? max_ids : n_threads;
+  int core_ids = max_ids / smt_ids;
+  return (core_ids < n_cores ? core_ids : n_cores) * n_threads;
+}
+
+// Decode L1 cache associativity of cpuid(0x80000005)
+static int decode_amd_l1_ways(int assoc)
+{
+  return assoc == 0xff ? -1 : assoc;
+}
+
+// Decode 4-bit associativity field of cpuid(0x80000006) caches and TLBs, and of cpuid(0x80000019) TLBs
+static int decode_amd_ways(int assoc)
+{
+  static const int ways[16] = { 0, 1, 2, 3, 4, 6, 8, 0, 16, 0, 32, 48, 64, 96, 128, -1 };
+  return ways[assoc & 0xf];
+}
+
 cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
 {
   uint32_t cpuid_level;
@@ -966,71 +1530,70 @@ cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
 
   cpuinfo_list_t caches_list = NULL;
   cpuinfo_cache_descriptor_t cache_desc;
+  cache_desc.sharing = 0;
+  cache_desc.line_size = 0;
+  cache_desc.ways = 0;
+
+  if (is_amd_compatible(cip) && has_topology_extensions()) {
+	D(bug("cpuinfo_get_cache: cpuid(0x8000001d)\n"));
+	int count;
+	for (count = 0; decode_cache_parameters(0x8000001d, count, &cache_desc) == 0; count++) {
+	  cache_desc.sharing = get_enabled_sharing(cip, cache_desc.sharing);
+	  cpuinfo_caches_list_insert(&cache_desc);
+	}
+	if (caches_list)
+	  return caches_list;
+	cache_desc.sharing = 0;
+	cache_desc.line_size = 0;
+	cache_desc.ways = 0;
+  }
 
   if (cpuid_level >= 4) {
 	// XXX not MP safe cpuid()
 	D(bug("cpuinfo_get_cache: cpuid(4)\n"));
-	uint32_t eax, ebx, ecx, edx;
 	int count = 0;
 	int saw_L1I_cache = 0;
-	for (;;) {
-	  ecx = count;
-	  cpuid(4, &eax, &ebx, &ecx, &edx);
-	  int cache_type = eax & 0x1f;
-	  if (cache_type == 0)
-		break;
-	  switch (cache_type) {
-	  case 1: cache_type = CPUINFO_CACHE_TYPE_DATA; break;
-	  case 2: cache_type = CPUINFO_CACHE_TYPE_CODE; break;
-	  case 3: cache_type = CPUINFO_CACHE_TYPE_UNIFIED; break;
-	  default: cache_type = CPUINFO_CACHE_TYPE_UNKNOWN; break;
-	  }
-	  cache_desc.type = cache_type;
-	  cache_desc.level = (eax >> 5) & 7;
-	  uint32_t W = 1 + ((ebx >> 22) & 0x3f);	// ways of associativity
-	  uint32_t P = 1 + ((ebx >> 12) & 0x1f);	// physical line partition
-	  uint32_t L = 1 + (ebx & 0xfff);			// system coherency line size
-	  uint32_t S = 1 + ecx;						// number of sets
-	  cache_desc.size = (L * W * P * S) / 1024;
+	while (decode_cache_parameters(4, count, &cache_desc) == 0) {
+	  cache_desc.sharing = get_enabled_sharing(cip, cache_desc.sharing);
 	  cpuinfo_caches_list_insert(&cache_desc);
 	  ++count;
 	  if (cache_desc.type == CPUINFO_CACHE_TYPE_CODE && cache_desc.level == 1)
 		saw_L1I_cache = 1;
 	}
 	/* XXX find a better way to detect 'Instruction Trace Cache'-based processors? */
-	if (saw_L1I_cache)
+	if (saw_L1I_cache || (cpuid_level >= 2 && has_intel_descriptor(INTEL_DESC_NO_CACHE_INFO)))
 	  return caches_list;
 	cpuinfo_list_clear(&caches_list);
+	cache_desc.sharing = 0;
+	cache_desc.line_size = 0;
+	cache_desc.ways = 0;
   }
 
   if (cpuid_level >= 2) {
-	int i, j, k, n;
-	uint32_t regs[4];
-	uint8_t *dp = (uint8_t *)regs;
+	int i;
+	uint8_t descs[64];
 	D(bug("cpuinfo_get_cache: cpuid(2)\n"));
-	cpuid(2, &regs[0], NULL, NULL, NULL);
-	n = regs[0] & 0xff;						// number of times to iterate
-	for (i = 0; i < n; i++) {
-	  cpuid(2, &regs[0], &regs[1], &regs[2], &regs[3]);
-	  for (j = 0; j < 4; j++) {
-		if (regs[j] & 0x80000000)
-		  regs[j] = 0;
-	  }
-	  for (j = 1; j < 16; j++) {
-		uint8_t desc = dp[j];
-		for (k = 0; intel_cache_table[k].desc != 0; k++) {
-		  if (intel_cache_table[k].desc == desc) {
-			cache_desc.type = intel_cache_table[k].type;
-			cache_desc.level = intel_cache_table[k].level;
-			cache_desc.size = intel_cache_table[k].size;
-			cpuinfo_caches_list_insert(&cache_desc);
-			D(bug("%02x\n", desc));
-			break;
-		  }
-		}
-	  }
+	cpuinfo_db_table_t table;
+	int n_descs = 0;
+	if (cpuinfo_db_get_table(CPUINFO_DB_INTEL_CACHE, 4, &table) == 0)
+	  n_descs = get_intel_descriptors(descs, sizeof(descs));
+	// descriptors don't tell line sizes, assume all caches use the CLFLUSH line size
+	uint32_t ebx;
+	cpuid(1, NULL, &ebx, NULL, NULL);
+	cache_desc.line_size = ((ebx >> 8) & 0xff) * 8;
+	for (i = 0; i < n_descs; i++) {
+	  const cpuinfo_db_record_t *rp = cpuinfo_db_lookup(&table, descs[i]);
+	  if (rp == NULL)
+		continue;
+	  cache_desc.level = cpuinfo_db_field(rp, 1);
+	  cache_desc.type = cpuinfo_db_field(rp, 2);
+	  cache_desc.size = cpuinfo_db_field(rp, 3);
+	  cpuinfo_caches_list_insert(&cache_desc);
+	  D(bug("%02x\n", descs[i]));
 	}
-	return caches_list;
+	// AMD processors don't implement cpuid(2), try extended levels
+	if (caches_list)
+	  return caches_list;
   }
 
   cpuid(0x80000000, &cpuid_level, NULL, NULL, NULL);
@@ -1041,14 +1604,20 @@ cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
 	cache_desc.level = 1;
 	cache_desc.type = CPUINFO_CACHE_TYPE_CODE;
 	cache_desc.size = (edx >> 24) & 0xff;
+	cache_desc.line_size = edx & 0xff;
+	cache_desc.ways = decode_amd_l1_ways((edx >> 16) & 0xff);
 	cpuinfo_caches_list_insert(&cache_desc);
 	cache_desc.level = 1;
 	cache_desc.type = CPUINFO_CACHE_TYPE_DATA;
 	cache_desc.size = (ecx >> 24) & 0xff;
+	cache_desc.line_size = ecx & 0xff;
+	cache_desc.ways = decode_amd_l1_ways((ecx >> 16) & 0xff);
 	cpuinfo_caches_list_insert(&cache_desc);
+	cache_desc.line_size = 0;
+	cache_desc.ways = 0;
 	if (cpuid_level >= 0x80000006) {
 	  D(bug("cpuinfo_get_cache: cpuid(0x80000006)\n"));
-	  cpuid(0x80000006, NULL, NULL, &ecx, NULL);
+	  cpuid(0x80000006, NULL, NULL, &ecx, &edx);
 	  if (has_cache_info_errata(cip, CACHE_INFO_ERRATA_VIA_C3_1)) {
 		if (((ecx >> 16) & 0xffff) != 0) {
 		  cache_desc.level = 2;
@@ -1068,9 +1637,20 @@ cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
 			if (cache_desc.size == 65)
 			  cache_desc.size = 64;
 		  }
+		  cache_desc.line_size = ecx & 0xff;
+		  cache_desc.ways = decode_amd_ways((ecx >> 12) & 0xf);
 		  cpuinfo_caches_list_insert(&cache_desc);
 		}
 	  }
+	  // AMD Family 10h and later processors report L3 cache size in 512 KB units
+	  if (is_amd_compatible(cip) && ((edx >> 18) & 0x3fff) != 0) {
+		cache_desc.level = 3;
+		cache_desc.type = CPUINFO_CACHE_TYPE_UNIFIED;
+		cache_desc.size = ((edx >> 18) & 0x3fff) * 512;
+		cache_desc.line_size = edx & 0xff;
+		cache_desc.ways = decode_amd_ways((edx >> 12) & 0xf);
+		cpuinfo_caches_list_insert(&cache_desc);
+	  }
 	}
 	return caches_list;
   }
@@ -1078,6 +1658,174 @@ cpuinfo_list_t cpuinfo_arch_get_caches(struct cpuinfo *cip)
   return NULL;
 }
 
+// Decode deterministic address translation parameters, as returned by cpuid(0x18)
+static int decode_tlb_parameters(int index, cpuinfo_tlb_descriptor_t *tdp)
+{
+  uint32_t eax, ebx, ecx, edx;
+  ecx = index;
+  cpuid(0x18, &eax, &ebx, &ecx, &edx);
+  switch (edx & 0x1f) {
+  case 0: return -1;
+  case 1: tdp->type = CPUINFO_CACHE_TYPE_DATA; break;
+  case 2: tdp->type = CPUINFO_CACHE_TYPE_CODE; break;
+  case 3: tdp->type = CPUINFO_CACHE_TYPE_UNIFIED; break;
+  case 4: tdp->type = CPUINFO_CACHE_TYPE_DATA; break;	// load-only
+  case 5: tdp->type = CPUINFO_CACHE_TYPE_DATA; break;	// store-only
+  default: tdp->type = CPUINFO_CACHE_TYPE_UNKNOWN; break;
+  }
+  tdp->level = (edx >> 5) & 7;
+  tdp->page_sizes = ebx & 0xf;								// same bit layout as CPUINFO_PAGE_SIZE_*
+  tdp->ways = (edx & (1 << 8)) ? -1 : (ebx >> 16);			// fully associative
+  tdp->entries = (ebx >> 16) * ecx;							// ways * sets
+  tdp->sharing = 1 + ((edx >> 14) & 0xfff);				// addressable IDs sharing this TLB
+  return 0;
+}
+
+#define cpuinfo_amd_tlbs_insert(LEVEL, TYPE, PAGES, ENTRIES, WAYS) do {	\
+  tlb_desc.level = (LEVEL);												\
+  tlb_desc.type = (TYPE);												\
+  tlb_desc.page_sizes = (PAGES);										\
+  tlb_desc.entries = (ENTRIES);											\
+  tlb_desc.ways = (WAYS);												\
+  if (tlb_desc.entries > 0)												\
+	cpuinfo_tlbs_list_insert(&tlb_desc);								\
+} while (0)
+
+// Returns 1 if the processor supports pages of SIZE KB, 0 if not, -1 if unknown
+int cpuinfo_arch_has_page_size(struct cpuinfo *cip, int size)
+{
+  switch (size) {
+  case 4:
+	return 1;
+  case 2048:
+	// PAE paging and long mode always map 2 MB pages
+	return cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_PAE) || cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_LM);
+  case 4096:
+	// 4 MB pages are only available with 32-bit paging
+	return sizeof(void *) == 4 && cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_PSE);
+  case 1024 * 1024:
+	return cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86_PDPE1GB);
+  }
+  return -1;
+}
+
+// Get hardware prefetch size in bytes
+int cpuinfo_arch_get_prefetch_size(struct cpuinfo *cip)
+{
+  uint32_t cpuid_level;
+  cpuid(0, &cpuid_level, NULL, NULL, NULL);
+  if (cpuid_level < 2)
+	return 0;
+  uint8_t descs[64];
+  int i, n_descs = get_intel_descriptors(descs, sizeof(descs));
+  for (i = 0; i < n_descs; i++) {
+	switch (descs[i]) {
+	case INTEL_DESC_PREFETCH_64:	return 64;
+	case INTEL_DESC_PREFETCH_128:	return 128;
+	}
+  }
+  return 0;
+}
+
+// Get TLB information
+cpuinfo_list_t cpuinfo_arch_get_tlbs(struct cpuinfo *cip)
+{
+  uint32_t cpuid_level;
+  cpuid(0, &cpuid_level, NULL, NULL, NULL);
+
+  cpuinfo_list_t tlbs_list = NULL;
+  cpuinfo_tlb_descriptor_t tlb_desc;
+  tlb_desc.sharing = 0;
+
+  // cpuid(2) reports TLBs unless it tells to use cpuid(0x18)
+  if (cpuid_level >= 0x18 && has_intel_descriptor(INTEL_DESC_NO_TLB_INFO)) {
+	// XXX not MP safe cpuid()
+	D(bug("cpuinfo_get_tlbs: cpuid(0x18)\n"));
+	uint32_t eax, ecx = 0;
+	cpuid(0x18, &eax, NULL, &ecx, NULL);
+	int index, max_index = eax;
+	for (index = 0; index <= max_index; index++) {
+	  if (decode_tlb_parameters(index, &tlb_desc) == 0) {
+		tlb_desc.sharing = get_enabled_sharing(cip, tlb_desc.sharing);
+		cpuinfo_tlbs_list_insert(&tlb_desc);
+	  }
+	}
+	if (tlbs_list)
+	  return tlbs_list;
+	tlb_desc.sharing = 0;
+  }
+
+  if (cpuid_level >= 2) {
+	int i;
+	uint8_t descs[64];
+	D(bug("cpuinfo_get_tlbs: cpuid(2)\n"));
+	cpuinfo_db_table_t table;
+	int n_descs = 0;
+	if (cpuinfo_db_get_table(CPUINFO_DB_INTEL_TLB, 6, &table) == 0)
+	  n_descs = get_intel_descriptors(descs, sizeof(descs));
+	for (i = 0; i < n_descs; i++) {
+	  // multiple TLB arrays may share a descriptor
+	  const cpuinfo_db_record_t *rp;
+	  for (rp = cpuinfo_db_lookup(&table, descs[i]); rp != NULL; rp = cpuinfo_db_next(&table, rp)) {
+		tlb_desc.level = cpuinfo_db_field(rp, 1);
+		tlb_desc.type = cpuinfo_db_field(rp, 2);
+		tlb_desc.ways = cpuinfo_db_field(rp, 3);
+		tlb_desc.entries = cpuinfo_db_field(rp, 4);
+		tlb_desc.page_sizes = cpuinfo_db_field(rp, 5);
+		cpuinfo_tlbs_list_insert(&tlb_desc);
+	  }
+	}
+	if (tlbs_list)
+	  return tlbs_list;
+  }
+
+  cpuid(0x80000000, &cpuid_level, NULL, NULL, NULL);
+  if ((cpuid_level & 0xffff0000) == 0x80000000 && cpuid_level >= 0x80000005) {
+	uint32_t eax, ebx;
+	D(bug("cpuinfo_get_tlbs: cpuid(0x80000005)\n"));
+	cpuid(0x80000005, &eax, &ebx, NULL, NULL);
+	// L1 associativity is the number of ways, 0xff for fully associative
+#define L1_WAYS(ASSOC) ((ASSOC) == 0xff ? -1 : (int)(ASSOC))
+	cpuinfo_amd_tlbs_insert(1, CPUINFO_CACHE_TYPE_CODE, CPUINFO_PAGE_SIZE_4K,
+							ebx & 0xff, L1_WAYS((ebx >> 8) & 0xff));
+	cpuinfo_amd_tlbs_insert(1, CPUINFO_CACHE_TYPE_DATA, CPUINFO_PAGE_SIZE_4K,
+							(ebx >> 16) & 0xff, L1_WAYS(ebx >> 24));
+	cpuinfo_amd_tlbs_insert(1, CPUINFO_CACHE_TYPE_CODE, CPUINFO_PAGE_SIZE_2M | CPUINFO_PAGE_SIZE_4M,
+							eax & 0xff, L1_WAYS((eax >> 8) & 0xff));
+	cpuinfo_amd_tlbs_insert(1, CPUINFO_CACHE_TYPE_DATA, CPUINFO_PAGE_SIZE_2M | CPUINFO_PAGE_SIZE_4M,
+							(eax >> 16) & 0xff, L1_WAYS(eax >> 24));
+#undef L1_WAYS
+	if (cpuid_level >= 0x80000006) {
+	  D(bug("cpuinfo_get_tlbs: cpuid(0x80000006)\n"));
+	  cpuid(0x80000006, &eax, &ebx, NULL, NULL);
+	  cpuinfo_amd_tlbs_insert(2, CPUINFO_CACHE_TYPE_CODE, CPUINFO_PAGE_SIZE_4K,
+							  ebx & 0xfff, decode_amd_ways(ebx >> 12));
+	  cpuinfo_amd_tlbs_insert(2, CPUINFO_CACHE_TYPE_DATA, CPUINFO_PAGE_SIZE_4K,
+							  (ebx >> 16) & 0xfff, decode_amd_ways(ebx >> 28));
+	  cpuinfo_amd_tlbs_insert(2, CPUINFO_CACHE_TYPE_CODE, CPUINFO_PAGE_SIZE_2M | CPUINFO_PAGE_SIZE_4M,
+							  eax & 0xfff, decode_amd_ways(eax >> 12));
+	  cpuinfo_amd_tlbs_insert(2, CPUINFO_CACHE_TYPE_DATA, CPUINFO_PAGE_SIZE_2M | CPUINFO_PAGE_SIZE_4M,
+							  (eax >> 16) & 0xfff, decode_amd_ways(eax >> 28));
+	}
+	if (cpuid_level >= 0x80000019) {
+	  D(bug("cpuinfo_get_tlbs: cpuid(0x80000019)\n"));
+	  cpuid(0x80000019, &eax, &ebx, NULL, NULL);
+	  cpuinfo_amd_tlbs_insert(1, CPUINFO_CACHE_TYPE_CODE, CPUINFO_PAGE_SIZE_1G,
+							  eax & 0xfff, decode_amd_ways(eax >> 12));
+	  cpuinfo_amd_tlbs_insert(1, CPUINFO_CACHE_TYPE_DATA, CPUINFO_PAGE_SIZE_1G,
+							  (eax >> 16) & 0xfff, decode_amd_ways(eax >> 28));
+	  cpuinfo_amd_tlbs_insert(2, CPUINFO_CACHE_TYPE_CODE, CPUINFO_PAGE_SIZE_1G,
+							  ebx & 0xfff, decode_amd_ways(ebx >> 12));
+	  cpuinfo_amd_tlbs_insert(2, CPUINFO_CACHE_TYPE_DATA, CPUINFO_PAGE_SIZE_1G,
+							  (ebx >> 16) & 0xfff, decode_amd_ways(ebx >> 28));
+	}
+	return tlbs_list;
+  }
+
+  return NULL;
+}
+
+attribute_no_stack_protector
 static int bsf_clobbers_eflags(void)
 {
   int mismatch = 0;
@@ -1118,77 +1866,476 @@ uint32_t *cpuinfo_arch_feature_table(struct cpuinfo *cip, int feature)
   return NULL;
 }
 
-#define feature_get_bit(NAME) cpuinfo_feature_get_bit(cip, CPUINFO_FEATURE_X86_##NAME)
-#define feature_set_bit(NAME) cpuinfo_feature_set_bit(cip, CPUINFO_FEATURE_X86_##NAME)
+// Register state the OS must save for features to be usable
+static const struct {
+  int feature;
+  uint64_t xcr0;
+} x86_feature_states[] = {
+  { CPUINFO_FEATURE_X86_AVX,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX2,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_FMA,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_FMA4,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_F16C,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_VAES,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_VPCLMULQDQ,				XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX_VNNI,				XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX_VNNI_INT8,			XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX_VNNI_INT16,			XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX_IFMA,				XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX_NE_CONVERT,			XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_SHA512,				XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_SM3,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_SM4,					XCR0_AVX_STATE		},
+  { CPUINFO_FEATURE_X86_AVX512F,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512CD,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512DQ,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512BW,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512VL,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512PF,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512ER,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512IFMA,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512VBMI,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512VBMI2,			XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512VNNI,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512BITALG,			XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512VPOPCNTDQ,		XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512_4VNNIW,			XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512_4FMAPS,			XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512_VP2INTERSECT,	XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512_BF16,			XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX512_FP16,			XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX10_1,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX10_2,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX10_256,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_AVX10_512,				XCR0_AVX512_STATE	},
+  { CPUINFO_FEATURE_X86_APX_F,					XCR0_APX			},
+  // AMX tile data also needs permission from Linux, see get_xcomp_perm()
+  { CPUINFO_FEATURE_X86_AMX_TILE,				XCR0_AMX_STATE		},
+  { CPUINFO_FEATURE_X86_AMX_BF16,				XCR0_AMX_STATE		},
+  { CPUINFO_FEATURE_X86_AMX_INT8,				XCR0_AMX_STATE		},
+  { CPUINFO_FEATURE_X86_AMX_FP16,				XCR0_AMX_STATE		},
+  { CPUINFO_FEATURE_X86_AMX_COMPLEX,			XCR0_AMX_STATE		},
+};
 
-// Returns 1 if CPU supports the specified feature
-int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
+// Feature names in the Linux /proc/cpuinfo "flags" line, and the first Linux version reporting them
+static const struct {
+  int feature;
+  const char *name;
+  int linux_version;
+} x86_feature_os_names[] = {
+  { CPUINFO_FEATURE_X86_CMOV,					"cmov",					0	},
+  { CPUINFO_FEATURE_X86_MMX,					"mmx",					0	},
+  { CPUINFO_FEATURE_X86_MMX_PLUS,				"mmxext",				0	},
+  { CPUINFO_FEATURE_X86_3DNOW,					"3dnow",				0	},
+  { CPUINFO_FEATURE_X86_3DNOW_PLUS,				"3dnowext",				0	},
+  { CPUINFO_FEATURE_X86_SSE,					"sse",					0	},
+  { CPUINFO_FEATURE_X86_SSE2,					"sse2",					0	},
+  { CPUINFO_FEATURE_X86_SSE3,					"pni",					0	},
+  { CPUINFO_FEATURE_X86_SSSE3,					"ssse3",				0	},
+  { CPUINFO_FEATURE_X86_SSE4_1,					"sse4_1",				0	},
+  { CPUINFO_FEATURE_X86_SSE4_2,					"sse4_2",				0	},
+  { CPUINFO_FEATURE_X86_SSE4A,					"sse4a",				0	},
+  { CPUINFO_FEATURE_X86_SSE5,					"xop",					CPUINFO_LINUX_VERSION(2, 6, 37)	},
+  { CPUINFO_FEATURE_X86_MSSE,					"misalignsse",			0	},
+  { CPUINFO_FEATURE_X86_VMX,					"vmx",					0	},
+  { CPUINFO_FEATURE_X86_SVM,					"svm",					0	},
+  { CPUINFO_FEATURE_X86_LM,						"lm",					0	},
+  { CPUINFO_FEATURE_X86_LAHF64,					"lahf_lm",				0	},
+  { CPUINFO_FEATURE_X86_POPCNT,					"popcnt",				0	},
+  { CPUINFO_FEATURE_X86_ABM,					"abm",					0	},
+  { CPUINFO_FEATURE_X86_TM,						"tm",					0	},
+  { CPUINFO_FEATURE_X86_TM2,					"tm2",					0	},
+  { CPUINFO_FEATURE_X86_EIST,					"est",					0	},
+  { CPUINFO_FEATURE_X86_NX,						"nx",					0	},
+  { CPUINFO_FEATURE_X86_CX16,					"cx16",					0	},
+  { CPUINFO_FEATURE_X86_MOVBE,					"movbe",				0	},
+  { CPUINFO_FEATURE_X86_PCLMULQDQ,				"pclmulqdq",			0	},
+  { CPUINFO_FEATURE_X86_AES,					"aes",					0	},
+  { CPUINFO_FEATURE_X86_RDRAND,					"rdrand",				CPUINFO_LINUX_VERSION(3, 2, 0)	},
+  { CPUINFO_FEATURE_X86_RDSEED,					"rdseed",				CPUINFO_LINUX_VERSION(3, 10, 0)	},
+  { CPUINFO_FEATURE_X86_XSAVE,					"xsave",				0	},
+  { CPUINFO_FEATURE_X86_XSAVEOPT,				"xsaveopt",				CPUINFO_LINUX_VERSION(2, 6, 38)	},
+  { CPUINFO_FEATURE_X86_XSAVEC,					"xsavec",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_XGETBV1,				"xgetbv1",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_XSAVES,					"xsaves",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_AVX,					"avx",					0	},
+  { CPUINFO_FEATURE_X86_AVX2,					"avx2",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_FMA,					"fma",					0	},
+  { CPUINFO_FEATURE_X86_FMA4,					"fma4",					CPUINFO_LINUX_VERSION(2, 6, 37)	},
+  { CPUINFO_FEATURE_X86_F16C,					"f16c",					CPUINFO_LINUX_VERSION(3, 2, 0)	},
+  { CPUINFO_FEATURE_X86_BMI1,					"bmi1",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_BMI2,					"bmi2",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_TBM,					"tbm",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_ADX,					"adx",					CPUINFO_LINUX_VERSION(3, 10, 0)	},
+  { CPUINFO_FEATURE_X86_SHA,					"sha_ni",				CPUINFO_LINUX_VERSION(4, 4, 0)	},
+  { CPUINFO_FEATURE_X86_VAES,					"vaes",					CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_VPCLMULQDQ,				"vpclmulqdq",			CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_GFNI,					"gfni",					CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_ERMS,					"erms",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_FSRM,					"fsrm",					CPUINFO_LINUX_VERSION(5, 7, 0)	},
+  { CPUINFO_FEATURE_X86_RDTSCP,					"rdtscp",				0	},
+  { CPUINFO_FEATURE_X86_RDPID,					"rdpid",				CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_PREFETCHW,				"3dnowprefetch",		0	},
+  { CPUINFO_FEATURE_X86_CLFLUSHOPT,				"clflushopt",			CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_CLWB,					"clwb",					CPUINFO_LINUX_VERSION(4, 4, 0)	},
+  { CPUINFO_FEATURE_X86_MOVDIRI,				"movdiri",				CPUINFO_LINUX_VERSION(5, 0, 0)	},
+  { CPUINFO_FEATURE_X86_MOVDIR64B,				"movdir64b",			CPUINFO_LINUX_VERSION(5, 0, 0)	},
+  { CPUINFO_FEATURE_X86_SERIALIZE,				"serialize",			CPUINFO_LINUX_VERSION(5, 10, 0)	},
+  { CPUINFO_FEATURE_X86_WAITPKG,				"waitpkg",				CPUINFO_LINUX_VERSION(5, 5, 0)	},
+  { CPUINFO_FEATURE_X86_HLE,					"hle",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_RTM,					"rtm",					CPUINFO_LINUX_VERSION(3, 5, 0)	},
+  { CPUINFO_FEATURE_X86_AVX_VNNI,				"avx_vnni",				CPUINFO_LINUX_VERSION(5, 15, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512F,				"avx512f",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512CD,				"avx512cd",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512DQ,				"avx512dq",				CPUINFO_LINUX_VERSION(4, 4, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512BW,				"avx512bw",				CPUINFO_LINUX_VERSION(4, 4, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512VL,				"avx512vl",				CPUINFO_LINUX_VERSION(4, 4, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512PF,				"avx512pf",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512ER,				"avx512er",				CPUINFO_LINUX_VERSION(4, 0, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512IFMA,				"avx512ifma",			CPUINFO_LINUX_VERSION(4, 10, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512VBMI,				"avx512vbmi",			CPUINFO_LINUX_VERSION(4, 10, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512VBMI2,			"avx512_vbmi2",			CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512VNNI,				"avx512_vnni",			CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512BITALG,			"avx512_bitalg",		CPUINFO_LINUX_VERSION(4, 18, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512VPOPCNTDQ,		"avx512_vpopcntdq",		CPUINFO_LINUX_VERSION(4, 14, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512_4VNNIW,			"avx512_4vnniw",		CPUINFO_LINUX_VERSION(4, 10, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512_4FMAPS,			"avx512_4fmaps",		CPUINFO_LINUX_VERSION(4, 10, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512_VP2INTERSECT,	"avx512_vp2intersect",	CPUINFO_LINUX_VERSION(5, 10, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512_BF16,			"avx512_bf16",			CPUINFO_LINUX_VERSION(5, 5, 0)	},
+  { CPUINFO_FEATURE_X86_AVX512_FP16,			"avx512_fp16",			CPUINFO_LINUX_VERSION(5, 12, 0)	},
+  { CPUINFO_FEATURE_X86_AMX_TILE,				"amx_tile",				CPUINFO_LINUX_VERSION(5, 12, 0)	},
+  { CPUINFO_FEATURE_X86_AMX_BF16,				"amx_bf16",				CPUINFO_LINUX_VERSION(5, 12, 0)	},
+  { CPUINFO_FEATURE_X86_AMX_INT8,				"amx_int8",				CPUINFO_LINUX_VERSION(5, 12, 0)	},
+  { CPUINFO_FEATURE_X86_PSE,					"pse",					0	},
+  { CPUINFO_FEATURE_X86_PAE,					"pae",					0	},
+  { CPUINFO_FEATURE_X86_PDPE1GB,				"pdpe1gb",				0	},
+};
+
+#define feature_get_bit(NAME) get_feature_bit(features, CPUINFO_FEATURE_X86_##NAME)
+#define feature_set_bit(NAME) set_feature_bit(features, CPUINFO_FEATURE_X86_##NAME)
+
+// Accessors for x86 feature tables, usable without a cpuinfo descriptor
+attribute_no_stack_protector
+static inline int get_feature_bit(const uint32_t *features, int feature)
 {
-  if (!cpuinfo_feature_get_bit(cip, CPUINFO_FEATURE_X86)) {
-	cpuinfo_feature_set_bit(cip, CPUINFO_FEATURE_X86);
+  feature &= CPUINFO_FEATURE_MASK;
+  return (features[feature / 32] & (1U << (feature % 32))) != 0;
+}
 
-	uint32_t eax, ecx, edx;
-	cpuid(1, NULL, NULL, &ecx, &edx);
-	if (edx & (1 << 15))
-	  feature_set_bit(CMOV);
+attribute_no_stack_protector
+static inline void set_feature_bit(uint32_t *features, int feature)
+{
+  feature &= CPUINFO_FEATURE_MASK;
+  features[feature / 32] |= 1U << (feature % 32);
+}
+
+attribute_no_stack_protector
+static inline void clear_feature_bit(uint32_t *features, int feature)
+{
+  feature &= CPUINFO_FEATURE_MASK;
+  features[feature / 32] &= ~(1U << (feature % 32));
+}
+
+// Decode CPUID features into FEATURES, keeping raw capabilities into HW_FEATURES
+// if it is not NULL. This neither allocates memory nor calls the C library.
+attribute_no_stack_protector
+static void get_features(uint32_t *features, uint32_t *hw_features, int vendor)
+{
+  set_feature_bit(features, CPUINFO_FEATURE_X86);
+
+  uint32_t eax, ebx, ecx = 0, edx;
+  uint32_t cpuid_level;
+  cpuid(0, &cpuid_level, NULL, NULL, NULL);
+
+  cpuid(1, NULL, NULL, &ecx, &edx);
+  if (edx & (1 << 15))
+	feature_set_bit(CMOV);
+  if (edx & (1 << 23))
+	feature_set_bit(MMX);
+  if (edx & (1 << 25))
+	feature_set_bit(SSE);
+  if (edx & (1 << 26))
+	feature_set_bit(SSE2);
+  if (ecx & (1 << 0))
+	feature_set_bit(SSE3);
+  if (ecx & (1 << 9))
+	feature_set_bit(SSSE3);
+  if (ecx & (1 << 19))
+	feature_set_bit(SSE4_1);
+  if (ecx & (1 << 20))
+	feature_set_bit(SSE4_2);
+  if (ecx & (1 << 23))
+	feature_set_bit(POPCNT);
+  if (ecx & (1 << 5))
+	feature_set_bit(VMX);
+  if (edx & (1 << 29))
+	feature_set_bit(TM);
+  if (ecx & (1 << 8))
+	feature_set_bit(TM2);
+  if (ecx & (1 << 7))
+	feature_set_bit(EIST);
+  if (ecx & (1 << 1))
+	feature_set_bit(PCLMULQDQ);
+  if (ecx & (1 << 13))
+	feature_set_bit(CX16);
+  if (ecx & (1 << 22))
+	feature_set_bit(MOVBE);
+  if (edx & (1 << 3))
+	feature_set_bit(PSE);
+  if (edx & (1 << 6))
+	feature_set_bit(PAE);
+  if (ecx & (1 << 25))
+	feature_set_bit(AES);
+  if (ecx & (1 << 26))
+	feature_set_bit(XSAVE);
+  if (ecx & (1 << 27))
+	feature_set_bit(OSXSAVE);
+  if (ecx & (1 << 30))
+	feature_set_bit(RDRAND);
+
+  if (ecx & (1 << 28))
+	feature_set_bit(AVX);
+  if (ecx & (1 << 12))
+	feature_set_bit(FMA);
+  if (ecx & (1 << 29))
+	feature_set_bit(F16C);
+
+  // Structured extended feature flags
+  uint32_t max_subleaf = 0;
+  if (cpuid_level >= 7) {
+	ecx = 0;
+	cpuid(7, &max_subleaf, &ebx, &ecx, &edx);
+	if (ebx & (1 << 3))
+	  feature_set_bit(BMI1);
+	if (ebx & (1 << 4))
+	  feature_set_bit(HLE);
+	if (ebx & (1 << 8))
+	  feature_set_bit(BMI2);
+	if (ebx & (1 << 9))
+	  feature_set_bit(ERMS);
+	if (ebx & (1 << 11))
+	  feature_set_bit(RTM);
+	if (ebx & (1 << 18))
+	  feature_set_bit(RDSEED);
+	if (ebx & (1 << 19))
+	  feature_set_bit(ADX);
+	if (ebx & (1 << 23))
+	  feature_set_bit(CLFLUSHOPT);
+	if (ebx & (1 << 24))
+	  feature_set_bit(CLWB);
+	if (ebx & (1 << 29))
+	  feature_set_bit(SHA);
+	if (ecx & (1 << 5))
+	  feature_set_bit(WAITPKG);
+	if (ecx & (1 << 8))
+	  feature_set_bit(GFNI);
+	if (ecx & (1 << 22))
+	  feature_set_bit(RDPID);
+	if (ecx & (1 << 27))
+	  feature_set_bit(MOVDIRI);
+	if (ecx & (1 << 28))
+	  feature_set_bit(MOVDIR64B);
+	if (edx & (1 << 4))
+	  feature_set_bit(FSRM);
+	if (edx & (1 << 14))
+	  feature_set_bit(SERIALIZE);
+	if (ebx & (1 << 5))
+	  feature_set_bit(AVX2);
+	if (ecx & (1 << 9))
+	  feature_set_bit(VAES);
+	if (ecx & (1 << 10))
+	  feature_set_bit(VPCLMULQDQ);
+	if (ebx & (1 << 16))
+	  feature_set_bit(AVX512F);
+	if (ebx & (1 << 17))
+	  feature_set_bit(AVX512DQ);
+	if (ebx & (1 << 21))
+	  feature_set_bit(AVX512IFMA);
+	if (ebx & (1 << 26))
+	  feature_set_bit(AVX512PF);
+	if (ebx & (1 << 27))
+	  feature_set_bit(AVX512ER);
+	if (ebx & (1 << 28))
+	  feature_set_bit(AVX512CD);
+	if (ebx & (1 << 30))
+	  feature_set_bit(AVX512BW);
+	if (ebx & (1 << 31))
+	  feature_set_bit(AVX512VL);
+	if (ecx & (1 << 1))
+	  feature_set_bit(AVX512VBMI);
+	if (ecx & (1 << 6))
+	  feature_set_bit(AVX512VBMI2);
+	if (ecx & (1 << 11))
+	  feature_set_bit(AVX512VNNI);
+	if (ecx & (1 << 12))
+	  feature_set_bit(AVX512BITALG);
+	if (ecx & (1 << 14))
+	  feature_set_bit(AVX512VPOPCNTDQ);
+	if (edx & (1 << 2))
+	  feature_set_bit(AVX512_4VNNIW);
+	if (edx & (1 << 3))
+	  feature_set_bit(AVX512_4FMAPS);
+	if (edx & (1 << 8))
+	  feature_set_bit(AVX512_VP2INTERSECT);
 	if (edx & (1 << 23))
-	  feature_set_bit(MMX);
+	  feature_set_bit(AVX512_FP16);
+	if (edx & (1 << 24))
+	  feature_set_bit(AMX_TILE);
+	if (edx & (1 << 22))
+	  feature_set_bit(AMX_BF16);
 	if (edx & (1 << 25))
-	  feature_set_bit(SSE);
-	if (edx & (1 << 26))
-	  feature_set_bit(SSE2);
-	if (ecx & (1 << 0))
-	  feature_set_bit(SSE3);
-	if (ecx & (1 << 9))
-	  feature_set_bit(SSSE3);
-	if (ecx & (1 << 19))
-	  feature_set_bit(SSE4_1);
-	if (ecx & (1 << 20))
-	  feature_set_bit(SSE4_2);
-	if (ecx & (1 << 23))
-	  feature_set_bit(POPCNT);
+	  feature_set_bit(AMX_INT8);
+  }
+  if (max_subleaf >= 1) {
+	ecx = 1;
+	cpuid(7, &eax, &ebx, &ecx, &edx);
+	if (eax & (1 << 0))
+	  feature_set_bit(SHA512);
+	if (eax & (1 << 1))
+	  feature_set_bit(SM3);
+	if (eax & (1 << 2))
+	  feature_set_bit(SM4);
+	if (eax & (1 << 10))
+	  feature_set_bit(FZLRM);
+	if (eax & (1 << 11))
+	  feature_set_bit(FSRS);
+	if (eax & (1 << 12))
+	  feature_set_bit(FSRC);
+	if (eax & (1 << 4))
+	  feature_set_bit(AVX_VNNI);
+	if (eax & (1 << 23))
+	  feature_set_bit(AVX_IFMA);
+	if (edx & (1 << 4))
+	  feature_set_bit(AVX_VNNI_INT8);
+	if (edx & (1 << 5))
+	  feature_set_bit(AVX_NE_CONVERT);
+	if (edx & (1 << 10))
+	  feature_set_bit(AVX_VNNI_INT16);
+	if (eax & (1 << 5))
+	  feature_set_bit(AVX512_BF16);
+	if (eax & (1 << 21))
+	  feature_set_bit(AMX_FP16);
+	if (edx & (1 << 8))
+	  feature_set_bit(AMX_COMPLEX);
+	if (edx & (1 << 21))
+	  feature_set_bit(APX_F);
+
+	// AVX10 converged vector ISA (version and vector lengths in leaf 0x24)
+	if ((edx & (1 << 19)) && cpuid_level >= 0x24) {
+	  ecx = 0;
+	  cpuid(0x24, NULL, &ebx, &ecx, NULL);
+	  int avx10_version = ebx & 0xff;
+	  if (avx10_version >= 1)
+		feature_set_bit(AVX10_1);
+	  if (avx10_version >= 2)
+		feature_set_bit(AVX10_2);
+	  if (ebx & (1 << 17))
+		feature_set_bit(AVX10_256);
+	  if (ebx & (1 << 18))
+		feature_set_bit(AVX10_512);
+	}
+  }
+
+  // Processor extended state enumeration
+  if (cpuid_level >= 0xd && feature_get_bit(XSAVE)) {
+	ecx = 1;
+	cpuid(0xd, &eax, NULL, &ecx, NULL);
+	if (eax & (1 << 0))
+	  feature_set_bit(XSAVEOPT);
+	if (eax & (1 << 1))
+	  feature_set_bit(XSAVEC);
+	if (eax & (1 << 2))
+	  feature_set_bit(XGETBV1);
+	if (eax & (1 << 3))
+	  feature_set_bit(XSAVES);
+  }
+
+  cpuid(0x80000000, &eax, NULL, NULL, NULL);
+  if ((eax & 0xffff0000) == 0x80000000 && eax >= 0x80000001) {
+	cpuid(0x80000001, NULL, NULL, &ecx, &edx);
+	if (ecx & (1 << 11))
+	  feature_set_bit(SSE5);
+	if (ecx & (1 << 7))
+	  feature_set_bit(MSSE);
+	if (ecx & (1 << 6))
+	  feature_set_bit(SSE4A);
 	if (ecx & (1 << 5))
-	  feature_set_bit(VMX);
-	if (edx & (1 << 29))
-	  feature_set_bit(TM);
+	  feature_set_bit(ABM);
+	if (ecx & (1 << 2))
+	  feature_set_bit(SVM);
+	if (ecx & (1 << 0))
+	  feature_set_bit(LAHF64);
 	if (ecx & (1 << 8))
-	  feature_set_bit(TM2);
-	if (ecx & (1 << 7))
-	  feature_set_bit(EIST);
+	  feature_set_bit(PREFETCHW);
+	if (ecx & (1 << 21))
+	  feature_set_bit(TBM);
+	if (ecx & (1 << 16))
+	  feature_set_bit(FMA4);
+	if (edx & (1 << 27))
+	  feature_set_bit(RDTSCP);
+	if (edx & (1 << 20))
+	  feature_set_bit(NX);
+	if (edx & (1 << 26))
+	  feature_set_bit(PDPE1GB);
+	if (edx & (1 << 29))
+	  feature_set_bit(LM);
+	if (edx & (1 << 31))
+	  feature_set_bit(3DNOW);
+	if (edx & (1 << 30))
+	  feature_set_bit(3DNOW_PLUS);
+	// XXX not sure they are the same MMX extensions...
+	if (vendor == CPUINFO_VENDOR_AMD && (edx & (1 << 22)))
+	  feature_set_bit(MMX_PLUS);
+	if (vendor == CPUINFO_VENDOR_CYRIX && (edx & (1 << 24)))
+	  feature_set_bit(MMX_PLUS);
+  }
 
-	cpuid(0x80000000, &eax, NULL, NULL, NULL);
-	if ((eax & 0xffff0000) == 0x80000000 && eax >= 0x80000001) {
-	  cpuid(0x80000001, NULL, NULL, &ecx, &edx);
-	  if (ecx & (1 << 11))
-		feature_set_bit(SSE5);
-	  if (ecx & (1 << 7))
-		feature_set_bit(MSSE);
-	  if (ecx & (1 << 6))
-		feature_set_bit(SSE4A);
-	  if (ecx & (1 << 5))
-		feature_set_bit(ABM);
-	  if (ecx & (1 << 2))
-		feature_set_bit(SVM);
-	  if (ecx & (1 << 0))
-		feature_set_bit(LAHF64);
-	  if (edx & (1 << 20))
-		feature_set_bit(NX);
-	  if (edx & (1 << 29))
-		feature_set_bit(LM);
-	  if (edx & (1 << 31))
-		feature_set_bit(3DNOW);
-	  if (edx & (1 << 30))
-		feature_set_bit(3DNOW_PLUS);
-	  // XXX not sure they are the same MMX extensions...
-	  if (cpuinfo_get_vendor(cip) == CPUINFO_VENDOR_AMD && (edx & (1 << 22)))
-		feature_set_bit(MMX_PLUS);
-	  if (cpuinfo_get_vendor(cip) == CPUINFO_VENDOR_CYRIX && (edx & (1 << 24)))
-		feature_set_bit(MMX_PLUS);
-	}
+  if (bsf_clobbers_eflags())
+	feature_set_bit(BSFCC);
 
-	if (bsf_clobbers_eflags())
-	  feature_set_bit(BSFCC);
+  // Keep raw CPUID capabilities, then drop features whose register
+  // state is not saved by the OS (XCR0)
+  int i;
+  if (hw_features) {
+	for (i = 0; i < CPUINFO_FEATURES_SZ_(X86); i++)
+	  hw_features[i] = features[i];
+  }
+  uint64_t xcr0 = get_xcr0();
+  if ((xcr0 & XCR0_AMX_STATE) && (get_xcomp_perm() & (1UL << XFEATURE_XTILEDATA)) == 0)
+	xcr0 &= ~(uint64_t)XCR0_AMX_STATE;
+  for (i = 0; i < sizeof(x86_feature_states) / sizeof(x86_feature_states[0]); i++) {
+	if ((xcr0 & x86_feature_states[i].xcr0) != x86_feature_states[i].xcr0)
+	  clear_feature_bit(features, x86_feature_states[i].feature);
+  }
+}
+
+// Get processor vendor from the cpuid(0) signature, for the features that depend on it
+attribute_no_stack_protector
+static int get_signature_vendor(void)
+{
+  uint32_t ebx, ecx = 0, edx;
+  cpuid(0, NULL, &ebx, &ecx, &edx);
+  if (ebx == 0x68747541 && edx == 0x69746e65 && ecx == 0x444d4163) // "AuthenticAMD"
+	return CPUINFO_VENDOR_AMD;
+  if (ebx == 0x69727943 && edx == 0x736e4978 && ecx == 0x64616574) // "CyrixInstead"
+	return CPUINFO_VENDOR_CYRIX;
+  return CPUINFO_VENDOR_UNKNOWN;
+}
+
+// Fill FEATURES without allocating memory nor calling the C library, returns the feature class
+int cpuinfo_arch_resolver_features(uint32_t *features, unsigned long hwcap)
+{
+  get_features(features, NULL, get_signature_vendor());
+  return CPUINFO_FEATURE_X86;
+}
 
+// Returns 1 if CPU supports the specified feature
+int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
+{
+  if (!cpuinfo_feature_get_bit(cip, CPUINFO_FEATURE_X86)) {
+	x86_cpuinfo_t *p = (x86_cpuinfo_t *)(cip->opaque);
+	uint32_t *features = p->features;
+	get_features(features, p->hw_features, cpuinfo_get_vendor(cip));
 	if (feature_get_bit(LM))
 	  cpuinfo_feature_set_bit(cip, CPUINFO_FEATURE_64BIT);
 
@@ -1203,7 +2350,9 @@ int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
 		feature_get_bit(SSE4A) ||
 		feature_get_bit(SSE4_1) ||
 		feature_get_bit(SSE4_2) ||
-		feature_get_bit(SSE5))
+		feature_get_bit(SSE5) ||
+		feature_get_bit(AVX) ||
+		feature_get_bit(AVX512F))
 	  cpuinfo_feature_set_bit(cip, CPUINFO_FEATURE_SIMD);
 
 	if (feature_get_bit(POPCNT))
@@ -1212,3 +2361,287 @@ int cpuinfo_arch_has_feature(struct cpuinfo *cip, int feature)
 
   return cpuinfo_feature_get_bit(cip, feature);
 }
+
+// Returns 1 if the processor reports the specified feature (raw CPUID)
+int cpuinfo_arch_has_hardware_feature(struct cpuinfo *cip, int feature)
+{
+  cpuinfo_arch_has_feature(cip, feature);
+  if ((feature & CPUINFO_FEATURE_ARCH) != CPUINFO_FEATURE_X86)
+	return cpuinfo_feature_get_bit(cip, feature) != 0;
+  x86_cpuinfo_t *p = (x86_cpuinfo_t *)(cip->opaque);
+  feature &= CPUINFO_FEATURE_MASK;
+  return (p->hw_features[feature / 32] & (1 << (feature % 32))) != 0;
+}
+
+// Returns the name of the feature as reported by the OS, or NULL if it is not reported
+const char *cpuinfo_arch_feature_os_name(int feature, int *linux_version)
+{
+  int i;
+  for (i = 0; i < sizeof(x86_feature_os_names) / sizeof(x86_feature_os_names[0]); i++) {
+	if (x86_feature_os_names[i].feature == feature) {
+	  *linux_version = x86_feature_os_names[i].linux_version;
+	  return x86_feature_os_names[i].name;
+	}
+  }
+  return NULL;
+}
+
+// Get the AT_HWCAP bit for the feature (returns -1 if there is none)
+int cpuinfo_arch_feature_hwcap(int feature, int *hwcap, unsigned long *mask)
+{
+  // x86 AT_HWCAP is cpuid(1).EDX
+  int bit = -1;
+  switch (feature) {
+  case CPUINFO_FEATURE_X86_CMOV:	bit = 15;	break;
+  case CPUINFO_FEATURE_X86_MMX:		bit = 23;	break;
+  case CPUINFO_FEATURE_X86_SSE:		bit = 25;	break;
+  case CPUINFO_FEATURE_X86_SSE2:	bit = 26;	break;
+  case CPUINFO_FEATURE_X86_TM:		bit = 29;	break;
+  }
+  if (bit < 0)
+	return -1;
+  *hwcap = 1;
+  *mask = 1UL << bit;
+  return 0;
+}
+
+/* ========================================================================= */
+/* == Execution-verified Features                                         == */
+/* ========================================================================= */
+
+// Representative instructions of each extension, encoded with .byte for
+// older assemblers. Vector registers are call-clobbered, so only GPR and
+// flags are declared, and AVX probes end with VZEROUPPER.
+
+static void check_hwcap_ssse3(void)
+{
+  __asm__ __volatile__ (".byte 0x66,0x0f,0x38,0x00,0xc0"); // pshufb %xmm0,%xmm0
+}
+
+static void check_hwcap_sse4_1(void)
+{
+  __asm__ __volatile__ (".byte 0x66,0x0f,0x38,0x39,0xc0"); // pminsd %xmm0,%xmm0
+}
+
+static void check_hwcap_sse4_2(void)
+{
+  __asm__ __volatile__ (".byte 0xf2,0x0f,0x38,0xf1,0xc0" : : : "eax", "cc"); // crc32 %eax,%eax
+}
+
+static void check_hwcap_popcnt(void)
+{
+  __asm__ __volatile__ (".byte 0xf3,0x0f,0xb8,0xc0" : : : "eax", "cc"); // popcnt %eax,%eax
+}
+
+static void check_hwcap_movbe(void)
+{
+  __asm__ __volatile__ (".byte 0x0f,0x38,0xf0,0x04,0x24" : : : "eax", "cc"); // movbe (%esp),%eax
+}
+
+static void check_hwcap_aes(void)
+{
+  __asm__ __volatile__ (".byte 0x66,0x0f,0x38,0xdc,0xc0"); // aesenc %xmm0,%xmm0
+}
+
+static void check_hwcap_pclmulqdq(void)
+{
+  __asm__ __volatile__ (".byte 0x66,0x0f,0x3a,0x44,0xc0,0x00"); // pclmulqdq $0,%xmm0,%xmm0
+}
+
+static void check_hwcap_sha(void)
+{
+  __asm__ __volatile__ (".byte 0x0f,0x38,0xcc,0xc0"); // sha256msg1 %xmm0,%xmm0
+}
+
+static void check_hwcap_gfni(void)
+{
+  __asm__ __volatile__ (".byte 0x66,0x0f,0x38,0xcf,0xc0"); // gf2p8mulb %xmm0,%xmm0
+}
+
+static void check_hwcap_rdrand(void)
+{
+  __asm__ __volatile__ (".byte 0x0f,0xc7,0xf0" : : : "eax", "cc"); // rdrand %eax
+}
+
+static void check_hwcap_rdseed(void)
+{
+  __asm__ __volatile__ (".byte 0x0f,0xc7,0xf8" : : : "eax", "cc"); // rdseed %eax
+}
+
+static void check_hwcap_rdpid(void)
+{
+  __asm__ __volatile__ (".byte 0xf3,0x0f,0xc7,0xf8" : : : "eax", "cc"); // rdpid %eax
+}
+
+static void check_hwcap_bmi1(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe2,0x78,0xf2,0xc0" : : : "eax", "cc"); // andn %eax,%eax,%eax
+}
+
+static void check_hwcap_bmi2(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe2,0x7b,0xf5,0xc0" : : : "eax", "cc"); // pdep %eax,%eax,%eax
+}
+
+static void check_hwcap_adx(void)
+{
+  __asm__ __volatile__ (".byte 0x66,0x0f,0x38,0xf6,0xc0" : : : "eax", "cc"); // adcx %eax,%eax
+}
+
+static void check_hwcap_avx(void)
+{
+  __asm__ __volatile__ (".byte 0xc5,0xfc,0x57,0xc0,0xc5,0xf8,0x77"); // vxorps %ymm0,%ymm0,%ymm0; vzeroupper
+}
+
+static void check_hwcap_avx2(void)
+{
+  __asm__ __volatile__ (".byte 0xc5,0xfd,0xfe,0xc0,0xc5,0xf8,0x77"); // vpaddd %ymm0,%ymm0,%ymm0; vzeroupper
+}
+
+static void check_hwcap_fma(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe2,0x79,0xb8,0xc0,0xc5,0xf8,0x77"); // vfmadd231ps %xmm0,%xmm0,%xmm0; vzeroupper
+}
+
+static void check_hwcap_f16c(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe2,0x79,0x13,0xc0,0xc5,0xf8,0x77"); // vcvtph2ps %xmm0,%xmm0; vzeroupper
+}
+
+static void check_hwcap_vaes(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe2,0x7d,0xdc,0xc0,0xc5,0xf8,0x77"); // vaesenc %ymm0,%ymm0,%ymm0; vzeroupper
+}
+
+static void check_hwcap_vpclmulqdq(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe3,0x7d,0x44,0xc0,0x00,0xc5,0xf8,0x77"); // vpclmulqdq $0,%ymm0,%ymm0,%ymm0; vzeroupper
+}
+
+static void check_hwcap_avx_vnni(void)
+{
+  __asm__ __volatile__ (".byte 0xc4,0xe2,0x7d,0x50,0xc0,0xc5,0xf8,0x77"); // {vex} vpdpbusd %ymm0,%ymm0,%ymm0; vzeroupper
+}
+
+static void check_hwcap_avx512f(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf1,0x7d,0x48,0xef,0xc0,0xc5,0xf8,0x77"); // vpxord %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512cd(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0x7d,0x48,0x44,0xc0,0xc5,0xf8,0x77"); // vplzcntd %zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512dq(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf1,0x7c,0x48,0x54,0xc0,0xc5,0xf8,0x77"); // vandps %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512bw(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf1,0x7d,0x48,0xfc,0xc0,0xc5,0xf8,0x77"); // vpaddb %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512vl(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf1,0x7d,0x08,0xef,0xc0,0xc5,0xf8,0x77"); // vpxord %xmm0,%xmm0,%xmm0; vzeroupper
+}
+
+static void check_hwcap_avx512ifma(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0xfd,0x48,0xb4,0xc0,0xc5,0xf8,0x77"); // vpmadd52luq %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512vbmi(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0x7d,0x48,0x8d,0xc0,0xc5,0xf8,0x77"); // vpermb %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512vbmi2(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0xfd,0x48,0x63,0xc0,0xc5,0xf8,0x77"); // vpcompressw %zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512vnni(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0x7d,0x48,0x50,0xc0,0xc5,0xf8,0x77"); // vpdpbusd %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512bitalg(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0x7d,0x48,0x54,0xc0,0xc5,0xf8,0x77"); // vpopcntb %zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512vpopcntdq(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0x7d,0x48,0x55,0xc0,0xc5,0xf8,0x77"); // vpopcntd %zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512_bf16(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf2,0x7e,0x48,0x52,0xc0,0xc5,0xf8,0x77"); // vdpbf16ps %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static void check_hwcap_avx512_fp16(void)
+{
+  __asm__ __volatile__ (".byte 0x62,0xf5,0x7c,0x48,0x58,0xc0,0xc5,0xf8,0x77"); // vaddph %zmm0,%zmm0,%zmm0; vzeroupper
+}
+
+static const struct {
+  int feature;
+  cpuinfo_feature_test_function_t func;
+} x86_feature_probes[] = {
+  { CPUINFO_FEATURE_X86_SSSE3,					check_hwcap_ssse3 },
+  { CPUINFO_FEATURE_X86_SSE4_1,					check_hwcap_sse4_1 },
+  { CPUINFO_FEATURE_X86_SSE4_2,					check_hwcap_sse4_2 },
+  { CPUINFO_FEATURE_X86_POPCNT,					check_hwcap_popcnt },
+  { CPUINFO_FEATURE_X86_MOVBE,					check_hwcap_movbe },
+  { CPUINFO_FEATURE_X86_AES,					check_hwcap_aes },
+  { CPUINFO_FEATURE_X86_PCLMULQDQ,				check_hwcap_pclmulqdq },
+  { CPUINFO_FEATURE_X86_SHA,					check_hwcap_sha },
+  { CPUINFO_FEATURE_X86_GFNI,					check_hwcap_gfni },
+  { CPUINFO_FEATURE_X86_RDRAND,					check_hwcap_rdrand },
+  { CPUINFO_FEATURE_X86_RDSEED,					check_hwcap_rdseed },
+  { CPUINFO_FEATURE_X86_RDPID,					check_hwcap_rdpid },
+  { CPUINFO_FEATURE_X86_BMI1,					check_hwcap_bmi1 },
+  { CPUINFO_FEATURE_X86_BMI2,					check_hwcap_bmi2 },
+  { CPUINFO_FEATURE_X86_ADX,					check_hwcap_adx },
+  { CPUINFO_FEATURE_X86_AVX,					check_hwcap_avx },
+  { CPUINFO_FEATURE_X86_AVX2,					check_hwcap_avx2 },
+  { CPUINFO_FEATURE_X86_FMA,					check_hwcap_fma },
+  { CPUINFO_FEATURE_X86_F16C,					check_hwcap_f16c },
+  { CPUINFO_FEATURE_X86_VAES,					check_hwcap_vaes },
+  { CPUINFO_FEATURE_X86_VPCLMULQDQ,				check_hwcap_vpclmulqdq },
+  { CPUINFO_FEATURE_X86_AVX_VNNI,				check_hwcap_avx_vnni },
+  { CPUINFO_FEATURE_X86_AVX512F,				check_hwcap_avx512f },
+  { CPUINFO_FEATURE_X86_AVX512CD,				check_hwcap_avx512cd },
+  { CPUINFO_FEATURE_X86_AVX512DQ,				check_hwcap_avx512dq },
+  { CPUINFO_FEATURE_X86_AVX512BW,				check_hwcap_avx512bw },
+  { CPUINFO_FEATURE_X86_AVX512VL,				check_hwcap_avx512vl },
+  { CPUINFO_FEATURE_X86_AVX512IFMA,				check_hwcap_avx512ifma },
+  { CPUINFO_FEATURE_X86_AVX512VBMI,				check_hwcap_avx512vbmi },
+  { CPUINFO_FEATURE_X86_AVX512VBMI2,			check_hwcap_avx512vbmi2 },
+  { CPUINFO_FEATURE_X86_AVX512VNNI,				check_hwcap_avx512vnni },
+  { CPUINFO_FEATURE_X86_AVX512BITALG,			check_hwcap_avx512bitalg },
+  { CPUINFO_FEATURE_X86_AVX512VPOPCNTDQ,		check_hwcap_avx512vpopcntdq },
+  { CPUINFO_FEATURE_X86_AVX512_BF16,			check_hwcap_avx512_bf16 },
+  { CPUINFO_FEATURE_X86_AVX512_FP16,			check_hwcap_avx512_fp16 },
+};
+
+// Execute advertised features, returns the number of features that faulted
+int cpuinfo_arch_verify_features(struct cpuinfo *cip)
+{
+  int i, n_faults = 0;
+  for (i = 0; i < sizeof(x86_feature_probes) / sizeof(x86_feature_probes[0]); i++) {
+	int feature = x86_feature_probes[i].feature;
+	if (!cpuinfo_arch_has_feature(cip, feature))
+	  continue;
+	if (!cpuinfo_feature_test_function(x86_feature_probes[i].func)) {
+	  D(bug("feature %s is advertised but faults\n", cpuinfo_string_of_feature(feature)));
+	  cpuinfo_feature_set_faulted(cip, feature);
+	  ++n_faults;
+	}
+  }
+  return n_faults;
+}
@@ -19,6 +19,10 @@
  */
 
 #include "sysdeps.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
 #include "cpuinfo.h"
 
 #define DEBUG 0
@@ -32,6 +36,88 @@ static void print_usage(const char *progname)
   printf("\n");
   printf("   -h --help               print this message\n");
   printf("   -d --debug [FILE]       dump debug information into FILE\n");
+  printf("   -s --status             print hardware / OS status of features\n");
+  printf("   -v --verify             execute advertised features before reporting them\n");
+  printf("   -c --cflags [FILE]      print compiler flags for this processor, or for the\n");
+  printf("                           processor described in FILE (saved output of %s)\n", progname);
+  printf("                           limited to what the compiler $CC accepts\n");
+  printf("   -b --check-binary FILE  check this processor runs the ELF binary FILE, only the\n");
+  printf("                           features it needs fail the check, not the ones it uses\n");
+  printf("      --strict             fail the check on missing features the binary uses too\n");
+  printf("   -m --memory-model       calibrate and print the memory hierarchy model\n");
+}
+
+static const struct {
+  int base;
+  int max;
+} features_bits[] = {
+  { CPUINFO_FEATURE_COMMON + 1, CPUINFO_FEATURE_COMMON_MAX },
+  { CPUINFO_FEATURE_X86, CPUINFO_FEATURE_X86_MAX },
+  { CPUINFO_FEATURE_IA64, CPUINFO_FEATURE_IA64_MAX },
+  { CPUINFO_FEATURE_PPC, CPUINFO_FEATURE_PPC_MAX },
+  { CPUINFO_FEATURE_MIPS, CPUINFO_FEATURE_MIPS_MAX },
+  { -1, 0 }
+};
+
+static void print_cpu_list(FILE *out, const int *cpus, int n_cpus)
+{
+  int i, j;
+  for (i = 0; i < n_cpus; i = j) {
+	for (j = i + 1; j < n_cpus && cpus[j] == cpus[j - 1] + 1; j++)
+	  ;
+	fprintf(out, "%s%d", i > 0 ? "," : "", cpus[i]);
+	if (j - i > 1)
+	  fprintf(out, "-%d", cpus[j - 1]);
+  }
+}
+
+static void print_size(FILE *out, int size)
+{
+  if (size >= 1024) {
+	if ((size % 1024) == 0)
+	  fprintf(out, "%d MB", size / 1024);
+	else
+	  fprintf(out, "%.2f MB", (double)size / 1024.0);
+  }
+  else
+	fprintf(out, "%d KB", size);
+}
+
+static void print_uarch_info(FILE *out, const cpuinfo_uarch_info_t *uip)
+{
+  int i;
+  if (uip->vector_width > 0) {
+	fprintf(out, "  Vector Units: %d-bit", uip->vector_width);
+	if (uip->datapath_width > 0 && uip->datapath_width < uip->vector_width)
+	  fprintf(out, " on %d-bit datapath", uip->datapath_width);
+	if (uip->fma_units > 0)
+	  fprintf(out, ", %d FMA unit%s", uip->fma_units, uip->fma_units > 1 ? "s" : "");
+	if (uip->preferred_vector_width > 0 && uip->preferred_vector_width < uip->vector_width)
+	  fprintf(out, ", prefers %d-bit", uip->preferred_vector_width);
+	fprintf(out, "\n");
+  }
+  if (uip->rob_size > 0) {
+	fprintf(out, "  Out-of-Order Window: %d ROB entries", uip->rob_size);
+	if (uip->load_buffer_size > 0 && uip->store_buffer_size > 0)
+	  fprintf(out, ", %d loads, %d stores", uip->load_buffer_size, uip->store_buffer_size);
+	fprintf(out, "\n");
+  }
+  if (uip->l1_latency > 0) {
+	fprintf(out, "  Load Latency: L1 %d", uip->l1_latency);
+	if (uip->l2_latency > 0)
+	  fprintf(out, ", L2 %d", uip->l2_latency);
+	if (uip->l3_latency > 0)
+	  fprintf(out, ", L3 ~%d", uip->l3_latency);
+	fprintf(out, " cycles\n");
+  }
+  if (uip->slow_insns) {
+	fprintf(out, "  Slow Instructions:");
+	for (i = 0; (1 << i) <= uip->slow_insns; i++) {
+	  if (uip->slow_insns & (1 << i))
+		fprintf(out, " %s", cpuinfo_string_of_slow_insn(1 << i));
+	}
+	fprintf(out, "\n");
+  }
 }
 
 static void print_cpuinfo(struct cpuinfo *cip, FILE *out)
@@ -52,6 +138,19 @@ static void print_cpuinfo(struct cpuinfo *cip, FILE *out)
   }
   fprintf(out, "\n");
 
+  int uarch = cpuinfo_get_uarch(cip);
+  if (uarch != CPUINFO_UARCH_UNKNOWN)
+	fprintf(out, "  Microarchitecture: %s\n", cpuinfo_string_of_uarch(uarch));
+  int x86_level = cpuinfo_get_x86_level(cip);
+  if (x86_level > CPUINFO_X86_LEVEL_NONE)
+	fprintf(out, "  ISA Level: %s\n", cpuinfo_string_of_x86_level(x86_level));
+  const cpuinfo_uarch_info_t *uip = cpuinfo_get_uarch_info(cip);
+  if (uip)
+	print_uarch_info(out, uip);
+  const char *host_id = cpuinfo_get_host_id(cip);
+  if (host_id)
+	fprintf(out, "  Host ID: %s\n", host_id);
+
   int socket = cpuinfo_get_socket(cip);
   fprintf(out, "  Package:");
   if (socket != CPUINFO_SOCKET_UNKNOWN)
@@ -63,6 +162,27 @@ static void print_cpuinfo(struct cpuinfo *cip, FILE *out)
 	fprintf(out, ", %d Threads per Core", n_threads);
   fprintf(out, "\n");
 
+  cpuinfo_cpu_budget_t budget;
+  if (cpuinfo_get_cpu_budget(cip, &budget) == 0) {
+	fprintf(out, "  CPU Budget: %d Processor%s, %d Core%s", budget.n_cpus, budget.n_cpus > 1 ? "s" : "",
+			budget.n_cores, budget.n_cores > 1 ? "s" : "");
+	if (budget.quota > 0)
+	  fprintf(out, ", quota %.2f", budget.quota);
+	fprintf(out, ", %d Worker%s\n", budget.n_workers, budget.n_workers > 1 ? "s" : "");
+  }
+
+  const cpuinfo_virtualizer_info_t *vip = cpuinfo_get_virtualizer_info(cip);
+  if (vip && vip->id != CPUINFO_VIRTUALIZER_NONE) {
+	fprintf(out, "  Virtualizer: %s", cpuinfo_string_of_virtualizer(vip->id));
+	if (vip->has_pvclock)
+	  fprintf(out, ", paravirtual clock");
+	if (vip->tsc_frequency > 0)
+	  fprintf(out, ", TSC %d kHz", vip->tsc_frequency);
+	if (vip->cpuid_cost >= 0)
+	  fprintf(out, ", CPUID %d TSC ticks", vip->cpuid_cost);
+	fprintf(out, "\n");
+  }
+
   fprintf(out, "\n");
   fprintf(out, "Processor Caches\n");
 
@@ -74,33 +194,174 @@ static void print_cpuinfo(struct cpuinfo *cip, FILE *out)
 		fprintf(out, "  Instruction trace cache, %dK uOps", ccdp->size);
 	  else {
 		fprintf(out, "  L%d %s cache, ", ccdp->level, cpuinfo_string_of_cache_type(ccdp->type));
-		if (ccdp->size >= 1024) {
-		  if ((ccdp->size % 1024) == 0)
-			fprintf(out, "%d MB", ccdp->size / 1024);
-		  else
-			fprintf(out, "%.2f MB", (double)ccdp->size / 1024.0);
-		}
-		else
-		  fprintf(out, "%d KB", ccdp->size);
+		print_size(out, ccdp->size);
+		if (ccdp->ways < 0)
+		  fprintf(out, ", fully associative");
+		else if (ccdp->ways > 0)
+		  fprintf(out, ", %d-way", ccdp->ways);
+		if (ccdp->line_size > 0)
+		  fprintf(out, ", %d-byte lines", ccdp->line_size);
+		if (ccdp->sharing > 1)
+		  fprintf(out, ", shared by %d threads", ccdp->sharing);
 	  }
 	  fprintf(out, "\n");
 	}
   }
+  int prefetch_size = cpuinfo_get_prefetch_size(cip);
+  if (prefetch_size > 0)
+	fprintf(out, "  Hardware prefetch, %d bytes\n", prefetch_size);
+
+  cpuinfo_cache_blocking_t blocks[4];
+  int n_blocks = cpuinfo_get_cache_blocking(cip, 0, CPUINFO_PLACEMENT_SPREAD, blocks, sizeof(blocks) / sizeof(blocks[0]));
+  if (n_blocks > 0) {
+	fprintf(out, "\n");
+	fprintf(out, "Cache Blocking, one thread per logical processor\n");
+	for (i = 0; i < n_blocks; i++) {
+	  const cpuinfo_cache_blocking_t *bp = &blocks[i];
+	  fprintf(out, "  L%d: ", bp->level);
+	  print_size(out, bp->capacity / 1024);
+	  fprintf(out, " per thread, streaming ");
+	  print_size(out, bp->block_size[CPUINFO_ACCESS_STREAMING] / 1024);
+	  fprintf(out, ", tiles ");
+	  print_size(out, bp->block_size[CPUINFO_ACCESS_TILES] / 1024);
+	  fprintf(out, ", hash tables ");
+	  print_size(out, bp->block_size[CPUINFO_ACCESS_HASH_TABLE] / 1024);
+	  fprintf(out, "\n");
+	}
+  }
+
+  const cpuinfo_tlb_t *ctp = cpuinfo_get_tlbs(cip);
+  if (ctp && ctp->count > 0) {
+	fprintf(out, "\n");
+	fprintf(out, "Processor TLBs\n");
+	for (i = 0; i < ctp->count; i++) {
+	  const cpuinfo_tlb_descriptor_t *ctdp = &ctp->descriptors[i];
+	  fprintf(out, "  L%d %s TLB, %d entries", ctdp->level,
+			  cpuinfo_string_of_cache_type(ctdp->type), ctdp->entries);
+	  if (ctdp->ways < 0)
+		fprintf(out, ", fully associative");
+	  else if (ctdp->ways > 0)
+		fprintf(out, ", %d-way", ctdp->ways);
+	  fprintf(out, ", ");
+	  for (j = 0; j < 4; j++) {
+		int page_size = ctdp->page_sizes & (1 << j);
+		if (page_size)
+		  fprintf(out, "%s%s", cpuinfo_string_of_page_size(page_size),
+				  (ctdp->page_sizes >> (j + 1)) ? "/" : "");
+	  }
+	  fprintf(out, " pages");
+	  if (ctdp->sharing > 1)
+		fprintf(out, ", shared by %d threads", ctdp->sharing);
+	  fprintf(out, "\n");
+	}
+  }
+
+  cpuinfo_page_info_t pages[16];
+  int n_pages = cpuinfo_get_page_info(cip, -1, pages, sizeof(pages) / sizeof(pages[0]));
+  if (n_pages > 0) {
+	fprintf(out, "\n");
+	fprintf(out, "Memory Pages\n");
+	for (i = 0; i < n_pages; i++) {
+	  const cpuinfo_page_info_t *pp = &pages[i];
+	  fprintf(out, "  ");
+	  if (pp->size >= 1024 * 1024)
+		fprintf(out, "%d GB", pp->size / (1024 * 1024));
+	  else
+		print_size(out, pp->size);
+	  fprintf(out, " pages");
+	  if (pp->flags & CPUINFO_PAGE_BASE)
+		fprintf(out, ", base");
+	  if (pp->nr_pages > 0)
+		fprintf(out, ", %d of %d hugetlb pages free", pp->free_pages, pp->nr_pages);
+	  if (pp->flags & (CPUINFO_PAGE_THP_ALWAYS | CPUINFO_PAGE_THP_MADVISE))
+		fprintf(out, ", transparent (%s%s)", (pp->flags & CPUINFO_PAGE_THP_ALWAYS) ? "always" : "madvise",
+				(pp->flags & CPUINFO_PAGE_THP_DEFRAG) ? ", defrag" : "");
+	  if (!(pp->flags & CPUINFO_PAGE_AVAILABLE))
+		fprintf(out, ", not available");
+	  fprintf(out, "\n");
+	}
+  }
+
+  fprintf(out, "\n");
+  fprintf(out, "Processor Topology\n");
+
+  const cpuinfo_core_complexes_t *cxp = cpuinfo_get_core_complexes(cip);
+  if (cxp) {
+	for (i = 0; i < cxp->count; i++) {
+	  const cpuinfo_core_complex_t *ccxp = &cxp->complexes[i];
+	  fprintf(out, "  Complex %d: %d Core%s, %d Thread%s", i,
+			  ccxp->n_cores, ccxp->n_cores > 1 ? "s" : "",
+			  ccxp->n_cpus, ccxp->n_cpus > 1 ? "s" : "");
+	  if (ccxp->cache_level > 0) {
+		fprintf(out, ", L%d ", ccxp->cache_level);
+		print_size(out, ccxp->cache_size);
+	  }
+	  if (ccxp->node >= 0)
+		fprintf(out, ", Node %d", ccxp->node);
+	  fprintf(out, ", CPUs ");
+	  print_cpu_list(out, ccxp->cpus, ccxp->n_cpus);
+	  fprintf(out, "\n");
+	}
+  }
+
+  // only list logical processors on hybrid systems or with favored cores
+  const cpuinfo_processors_t *psp = cpuinfo_get_processors(cip);
+  if (psp) {
+	for (i = 0; i < psp->count; i++) {
+	  if (psp->processors[i].core_type != CPUINFO_CORE_TYPE_UNKNOWN || psp->processors[i].tier > 0)
+		break;
+	}
+	if (i < psp->count) {
+	  for (i = 0; i < psp->count; i++) {
+		const cpuinfo_processor_t *pp = &psp->processors[i];
+		fprintf(out, "  CPU %d: Package %d, Core %d, %s core", pp->id,
+				pp->package, pp->core, cpuinfo_string_of_core_type(pp->core_type));
+		if (pp->uarch != CPUINFO_UARCH_UNKNOWN)
+		  fprintf(out, " (%s)", cpuinfo_string_of_uarch(pp->uarch));
+		if (pp->native_model >= 0)
+		  fprintf(out, ", native model %06x", pp->native_model);
+		if (pp->capacity >= 0)
+		  fprintf(out, ", capacity %d", pp->capacity);
+		if (pp->highest_perf >= 0)
+		  fprintf(out, ", perf %d/%d", pp->nominal_perf, pp->highest_perf);
+		if (pp->base_frequency > 0)
+		  fprintf(out, ", base %d MHz", pp->base_frequency);
+		fprintf(out, ", tier %d", pp->tier);
+		fprintf(out, "\n");
+	  }
+	}
+  }
+
+  const cpuinfo_xsave_t *xsp = cpuinfo_get_xsave_info(cip);
+  if (xsp && xsp->count > 0) {
+	fprintf(out, "\n");
+	fprintf(out, "Processor Extended State\n");
+	fprintf(out, "  Save area: %d bytes", xsp->size);
+	if (xsp->compacted_size > 0)
+	  fprintf(out, ", %d bytes compacted", xsp->compacted_size);
+	fprintf(out, ", %d bytes max, using %s\n", xsp->max_size, cpuinfo_string_of_xsave_insn(xsp->save_insn));
+	for (i = 0; i < xsp->count; i++) {
+	  const cpuinfo_xsave_component_t *xcp = &xsp->components[i];
+	  fprintf(out, "  %-10s %5d bytes at offset %d%s\n", cpuinfo_string_of_xsave_component(xcp->id),
+			  xcp->size, xcp->offset, xcp->aligned ? ", 64-byte aligned" : "");
+	}
+  }
+
+  cpuinfo_tile_info_t tile_info;
+  if (cpuinfo_get_tile_info(cip, &tile_info) == 0) {
+	fprintf(out, "\n");
+	fprintf(out, "Processor Tiles\n");
+	fprintf(out, "  %d Tiles, %d Rows x %d Bytes, %d KB total, TMUL K %d, N %d bytes",
+			tile_info.max_names, tile_info.max_rows, tile_info.bytes_per_row,
+			tile_info.total_tile_bytes / 1024, tile_info.tmul_maxk, tile_info.tmul_maxn);
+	if (!cpuinfo_request_tile_permission(cip))
+	  fprintf(out, ", not permitted by the OS");
+	fprintf(out, "\n");
+  }
 
   fprintf(out, "\n");
   fprintf(out, "Processor Features\n");
 
-  static const struct {
-	int base;
-	int max;
-  } features_bits[] = {
-	{ CPUINFO_FEATURE_COMMON + 1, CPUINFO_FEATURE_COMMON_MAX },
-	{ CPUINFO_FEATURE_X86, CPUINFO_FEATURE_X86_MAX },
-	{ CPUINFO_FEATURE_IA64, CPUINFO_FEATURE_IA64_MAX },
-	{ CPUINFO_FEATURE_PPC, CPUINFO_FEATURE_PPC_MAX },
-	{ CPUINFO_FEATURE_MIPS, CPUINFO_FEATURE_MIPS_MAX },
-	{ -1, 0 }
-  };
   for (i = 0; features_bits[i].base != -1; i++) {
 	int base = features_bits[i].base;
 	int count = features_bits[i].max - base;
@@ -118,11 +379,709 @@ static void print_cpuinfo(struct cpuinfo *cip, FILE *out)
   }
 }
 
+static void print_feature_status(struct cpuinfo *cip, FILE *out)
+{
+  int i, j;
+
+  fprintf(out, "Processor Features Status\n");
+  fprintf(out, "  %-16s %-8s %-3s %-6s\n", "Feature", "Hardware", "OS", "Usable");
+
+  for (i = 0; features_bits[i].base != -1; i++) {
+	int base = features_bits[i].base;
+	int count = features_bits[i].max - base;
+	for (j = 0; j < count; j++) {
+	  int feature = base + j;
+	  int status = cpuinfo_get_feature_status(cip, feature);
+	  if ((status & CPUINFO_FEATURE_STATUS_HARDWARE) == 0)
+		continue;
+	  const char *name = cpuinfo_string_of_feature(feature);
+	  const char *usable = (status & CPUINFO_FEATURE_STATUS_USABLE) ? "yes" : "no";
+	  if (status & CPUINFO_FEATURE_STATUS_FAULTED)
+		usable = "faults";
+	  fprintf(out, "  %-16s %-8s %-3s %-6s\n", name ? name : "<error>",
+			  "yes", (status & CPUINFO_FEATURE_STATUS_OS) ? "yes" : "no", usable);
+	}
+  }
+}
+
+// Compiler names of x86 features
+static const struct {
+  int feature;
+  const char *gcc;		// GCC and Clang -m<option>
+  const char *llvm;		// LLVM target feature
+} x86_target_features[] = {
+  { CPUINFO_FEATURE_X86_LM,					NULL,				"64bit" },
+  { CPUINFO_FEATURE_X86_CMOV,				NULL,				"cmov" },
+  { CPUINFO_FEATURE_X86_MMX,				"mmx",				"mmx" },
+  { CPUINFO_FEATURE_X86_SSE,				"sse",				"sse" },
+  { CPUINFO_FEATURE_X86_SSE2,				"sse2",				"sse2" },
+  { CPUINFO_FEATURE_X86_SSE3,				"sse3",				"sse3" },
+  { CPUINFO_FEATURE_X86_SSSE3,				"ssse3",			"ssse3" },
+  { CPUINFO_FEATURE_X86_SSE4_1,				"sse4.1",			"sse4.1" },
+  { CPUINFO_FEATURE_X86_SSE4_2,				"sse4.2",			"sse4.2" },
+  { CPUINFO_FEATURE_X86_SSE4A,				"sse4a",			"sse4a" },
+  { CPUINFO_FEATURE_X86_CX16,				"cx16",				"cx16" },
+  { CPUINFO_FEATURE_X86_LAHF64,				"sahf",				"sahf" },
+  { CPUINFO_FEATURE_X86_POPCNT,				"popcnt",			"popcnt" },
+  { CPUINFO_FEATURE_X86_ABM,				"lzcnt",			"lzcnt" },
+  { CPUINFO_FEATURE_X86_MOVBE,				"movbe",			"movbe" },
+  { CPUINFO_FEATURE_X86_PCLMULQDQ,			"pclmul",			"pclmul" },
+  { CPUINFO_FEATURE_X86_AES,				"aes",				"aes" },
+  { CPUINFO_FEATURE_X86_RDRAND,				"rdrnd",			"rdrnd" },
+  { CPUINFO_FEATURE_X86_RDSEED,				"rdseed",			"rdseed" },
+  { CPUINFO_FEATURE_X86_XSAVE,				"xsave",			"xsave" },
+  { CPUINFO_FEATURE_X86_XSAVEOPT,			"xsaveopt",			"xsaveopt" },
+  { CPUINFO_FEATURE_X86_XSAVEC,				"xsavec",			"xsavec" },
+  { CPUINFO_FEATURE_X86_XSAVES,				"xsaves",			"xsaves" },
+  { CPUINFO_FEATURE_X86_AVX,				"avx",				"avx" },
+  { CPUINFO_FEATURE_X86_AVX2,				"avx2",				"avx2" },
+  { CPUINFO_FEATURE_X86_FMA,				"fma",				"fma" },
+  { CPUINFO_FEATURE_X86_FMA4,				"fma4",				"fma4" },
+  { CPUINFO_FEATURE_X86_F16C,				"f16c",				"f16c" },
+  { CPUINFO_FEATURE_X86_BMI1,				"bmi",				"bmi" },
+  { CPUINFO_FEATURE_X86_BMI2,				"bmi2",				"bmi2" },
+  { CPUINFO_FEATURE_X86_TBM,				"tbm",				"tbm" },
+  { CPUINFO_FEATURE_X86_ADX,				"adx",				"adx" },
+  { CPUINFO_FEATURE_X86_SHA,				"sha",				"sha" },
+  { CPUINFO_FEATURE_X86_SHA512,				"sha512",			"sha512" },
+  { CPUINFO_FEATURE_X86_SM3,				"sm3",				"sm3" },
+  { CPUINFO_FEATURE_X86_SM4,				"sm4",				"sm4" },
+  { CPUINFO_FEATURE_X86_VAES,				"vaes",				"vaes" },
+  { CPUINFO_FEATURE_X86_VPCLMULQDQ,			"vpclmulqdq",		"vpclmulqdq" },
+  { CPUINFO_FEATURE_X86_GFNI,				"gfni",				"gfni" },
+  { CPUINFO_FEATURE_X86_RDPID,				"rdpid",			"rdpid" },
+  { CPUINFO_FEATURE_X86_PREFETCHW,			"prfchw",			"prfchw" },
+  { CPUINFO_FEATURE_X86_CLFLUSHOPT,			"clflushopt",		"clflushopt" },
+  { CPUINFO_FEATURE_X86_CLWB,				"clwb",				"clwb" },
+  { CPUINFO_FEATURE_X86_MOVDIRI,			"movdiri",			"movdiri" },
+  { CPUINFO_FEATURE_X86_MOVDIR64B,			"movdir64b",		"movdir64b" },
+  { CPUINFO_FEATURE_X86_SERIALIZE,			"serialize",		"serialize" },
+  { CPUINFO_FEATURE_X86_WAITPKG,			"waitpkg",			"waitpkg" },
+  { CPUINFO_FEATURE_X86_HLE,				"hle",				NULL },
+  { CPUINFO_FEATURE_X86_RTM,				"rtm",				"rtm" },
+  { CPUINFO_FEATURE_X86_AVX_VNNI,			"avxvnni",			"avxvnni" },
+  { CPUINFO_FEATURE_X86_AVX_VNNI_INT8,		"avxvnniint8",		"avxvnniint8" },
+  { CPUINFO_FEATURE_X86_AVX_VNNI_INT16,		"avxvnniint16",		"avxvnniint16" },
+  { CPUINFO_FEATURE_X86_AVX_IFMA,			"avxifma",			"avxifma" },
+  { CPUINFO_FEATURE_X86_AVX_NE_CONVERT,		"avxneconvert",		"avxneconvert" },
+  { CPUINFO_FEATURE_X86_AVX512F,			"avx512f",			"avx512f" },
+  { CPUINFO_FEATURE_X86_AVX512CD,			"avx512cd",			"avx512cd" },
+  { CPUINFO_FEATURE_X86_AVX512DQ,			"avx512dq",			"avx512dq" },
+  { CPUINFO_FEATURE_X86_AVX512BW,			"avx512bw",			"avx512bw" },
+  { CPUINFO_FEATURE_X86_AVX512VL,			"avx512vl",			"avx512vl" },
+  { CPUINFO_FEATURE_X86_AVX512PF,			"avx512pf",			NULL },
+  { CPUINFO_FEATURE_X86_AVX512ER,			"avx512er",			NULL },
+  { CPUINFO_FEATURE_X86_AVX512IFMA,			"avx512ifma",		"avx512ifma" },
+  { CPUINFO_FEATURE_X86_AVX512VBMI,			"avx512vbmi",		"avx512vbmi" },
+  { CPUINFO_FEATURE_X86_AVX512VBMI2,		"avx512vbmi2",		"avx512vbmi2" },
+  { CPUINFO_FEATURE_X86_AVX512VNNI,			"avx512vnni",		"avx512vnni" },
+  { CPUINFO_FEATURE_X86_AVX512BITALG,		"avx512bitalg",		"avx512bitalg" },
+  { CPUINFO_FEATURE_X86_AVX512VPOPCNTDQ,	"avx512vpopcntdq",	"avx512vpopcntdq" },
+  { CPUINFO_FEATURE_X86_AVX512_VP2INTERSECT,"avx512vp2intersect","avx512vp2intersect" },
+  { CPUINFO_FEATURE_X86_AVX512_BF16,		"avx512bf16",		"avx512bf16" },
+  { CPUINFO_FEATURE_X86_AVX512_FP16,		"avx512fp16",		"avx512fp16" },
+  { CPUINFO_FEATURE_X86_AMX_TILE,			"amx-tile",			"amx-tile" },
+  { CPUINFO_FEATURE_X86_AMX_BF16,			"amx-bf16",			"amx-bf16" },
+  { CPUINFO_FEATURE_X86_AMX_INT8,			"amx-int8",			"amx-int8" },
+  { CPUINFO_FEATURE_X86_AMX_FP16,			"amx-fp16",			"amx-fp16" },
+  { CPUINFO_FEATURE_X86_AMX_COMPLEX,		"amx-complex",		"amx-complex" },
+  { -1, NULL, NULL }
+};
+
+// Compiler names of x86 microarchitectures, as known to -mtune, and the closest older
+// microarchitecture to tune for if the compiler does not know it yet
+static const struct {
+  int uarch;
+  const char *name;
+  int fallback;
+} x86_target_cpus[] = {
+  { CPUINFO_UARCH_NETBURST,			"nocona",			-1 },
+  { CPUINFO_UARCH_CORE2,			"core2",			-1 },
+  { CPUINFO_UARCH_PENRYN,			"core2",			-1 },
+  { CPUINFO_UARCH_NEHALEM,			"nehalem",			CPUINFO_UARCH_CORE2 },
+  { CPUINFO_UARCH_WESTMERE,			"westmere",			CPUINFO_UARCH_NEHALEM },
+  { CPUINFO_UARCH_SANDY_BRIDGE,		"sandybridge",		CPUINFO_UARCH_WESTMERE },
+  { CPUINFO_UARCH_IVY_BRIDGE,		"ivybridge",		CPUINFO_UARCH_SANDY_BRIDGE },
+  { CPUINFO_UARCH_HASWELL,			"haswell",			CPUINFO_UARCH_IVY_BRIDGE },
+  { CPUINFO_UARCH_BROADWELL,		"broadwell",		CPUINFO_UARCH_HASWELL },
+  { CPUINFO_UARCH_SKYLAKE,			"skylake",			CPUINFO_UARCH_BROADWELL },
+  { CPUINFO_UARCH_SKYLAKE_SP,		"skylake-avx512",	CPUINFO_UARCH_SKYLAKE },
+  { CPUINFO_UARCH_CASCADE_LAKE,		"cascadelake",		CPUINFO_UARCH_SKYLAKE_SP },
+  { CPUINFO_UARCH_COOPER_LAKE,		"cooperlake",		CPUINFO_UARCH_CASCADE_LAKE },
+  { CPUINFO_UARCH_CANNON_LAKE,		"cannonlake",		CPUINFO_UARCH_SKYLAKE },
+  { CPUINFO_UARCH_ICE_LAKE,			"icelake-client",	CPUINFO_UARCH_CANNON_LAKE },
+  { CPUINFO_UARCH_ICE_LAKE_SP,		"icelake-server",	CPUINFO_UARCH_CASCADE_LAKE },
+  { CPUINFO_UARCH_TIGER_LAKE,		"tigerlake",		CPUINFO_UARCH_ICE_LAKE },
+  { CPUINFO_UARCH_ROCKET_LAKE,		"rocketlake",		CPUINFO_UARCH_ICE_LAKE },
+  { CPUINFO_UARCH_SAPPHIRE_RAPIDS,	"sapphirerapids",	CPUINFO_UARCH_ICE_LAKE_SP },
+  { CPUINFO_UARCH_EMERALD_RAPIDS,	"emeraldrapids",	CPUINFO_UARCH_SAPPHIRE_RAPIDS },
+  { CPUINFO_UARCH_GRANITE_RAPIDS,	"graniterapids",	CPUINFO_UARCH_SAPPHIRE_RAPIDS },
+  { CPUINFO_UARCH_GOLDEN_COVE,		"alderlake",		CPUINFO_UARCH_ICE_LAKE },
+  { CPUINFO_UARCH_RAPTOR_COVE,		"raptorlake",		CPUINFO_UARCH_GOLDEN_COVE },
+  { CPUINFO_UARCH_REDWOOD_COVE,		"meteorlake",		CPUINFO_UARCH_RAPTOR_COVE },
+  { CPUINFO_UARCH_LION_COVE,		"arrowlake",		CPUINFO_UARCH_REDWOOD_COVE },
+  { CPUINFO_UARCH_BONNELL,			"bonnell",			-1 },
+  { CPUINFO_UARCH_SALTWELL,			"bonnell",			-1 },
+  { CPUINFO_UARCH_SILVERMONT,		"silvermont",		CPUINFO_UARCH_BONNELL },
+  { CPUINFO_UARCH_AIRMONT,			"silvermont",		CPUINFO_UARCH_BONNELL },
+  { CPUINFO_UARCH_GOLDMONT,			"goldmont",			CPUINFO_UARCH_SILVERMONT },
+  { CPUINFO_UARCH_GOLDMONT_PLUS,	"goldmont-plus",	CPUINFO_UARCH_GOLDMONT },
+  { CPUINFO_UARCH_TREMONT,			"tremont",			CPUINFO_UARCH_GOLDMONT_PLUS },
+  { CPUINFO_UARCH_GRACEMONT,		"alderlake",		CPUINFO_UARCH_TREMONT },
+  { CPUINFO_UARCH_CRESTMONT,		"sierraforest",		CPUINFO_UARCH_GRACEMONT },
+  { CPUINFO_UARCH_SKYMONT,			"arrowlake",		CPUINFO_UARCH_CRESTMONT },
+  { CPUINFO_UARCH_KNIGHTS_LANDING,	"knl",				CPUINFO_UARCH_HASWELL },
+  { CPUINFO_UARCH_KNIGHTS_MILL,		"knm",				CPUINFO_UARCH_KNIGHTS_LANDING },
+  { CPUINFO_UARCH_K8,				"k8",				-1 },
+  { CPUINFO_UARCH_K10,				"amdfam10",			CPUINFO_UARCH_K8 },
+  { CPUINFO_UARCH_BOBCAT,			"btver1",			CPUINFO_UARCH_K10 },
+  { CPUINFO_UARCH_BULLDOZER,		"bdver1",			CPUINFO_UARCH_K10 },
+  { CPUINFO_UARCH_PILEDRIVER,		"bdver2",			CPUINFO_UARCH_BULLDOZER },
+  { CPUINFO_UARCH_STEAMROLLER,		"bdver3",			CPUINFO_UARCH_PILEDRIVER },
+  { CPUINFO_UARCH_EXCAVATOR,		"bdver4",			CPUINFO_UARCH_STEAMROLLER },
+  { CPUINFO_UARCH_JAGUAR,			"btver2",			CPUINFO_UARCH_BOBCAT },
+  { CPUINFO_UARCH_PUMA,				"btver2",			CPUINFO_UARCH_BOBCAT },
+  { CPUINFO_UARCH_ZEN,				"znver1",			CPUINFO_UARCH_EXCAVATOR },
+  { CPUINFO_UARCH_ZEN_PLUS,			"znver1",			CPUINFO_UARCH_EXCAVATOR },
+  { CPUINFO_UARCH_ZEN2,				"znver2",			CPUINFO_UARCH_ZEN },
+  { CPUINFO_UARCH_ZEN3,				"znver3",			CPUINFO_UARCH_ZEN2 },
+  { CPUINFO_UARCH_ZEN4,				"znver4",			CPUINFO_UARCH_ZEN3 },
+  { CPUINFO_UARCH_ZEN5,				"znver5",			CPUINFO_UARCH_ZEN4 },
+  { -1, NULL, -1 }
+};
+
+// Processor targeted by the compiler flags
+#define N_X86_FEATURES (CPUINFO_FEATURE_X86_MAX - CPUINFO_FEATURE_X86)
+typedef struct {
+  int uarch;
+  char features[N_X86_FEATURES];
+} x86_target_t;
+
+static void get_host_target(struct cpuinfo *cip, x86_target_t *tp)
+{
+  int i;
+  // programs built for the host are expected to request AMX tile data too
+  cpuinfo_request_tile_permission(cip);
+  tp->uarch = cpuinfo_get_uarch(cip);
+  for (i = 0; i < N_X86_FEATURES; i++)
+	tp->features[i] = cpuinfo_has_feature(cip, CPUINFO_FEATURE_X86 + i) != 0;
+}
+
+// Read target from the output of cpuinfo saved into FILENAME
+static int read_target(const char *filename, x86_target_t *tp)
+{
+  FILE *fp = fopen(filename, "r");
+  if (fp == NULL)
+	return -1;
+
+  int i, in_features = 0;
+  char line[256], name[64];
+  tp->uarch = CPUINFO_UARCH_UNKNOWN;
+  memset(tp->features, 0, sizeof(tp->features));
+  while (fgets(line, sizeof(line), fp)) {
+	if (strncmp(line, "Processor Features", 18) == 0)
+	  in_features = 1;
+	else if (line[0] != ' ')
+	  in_features = 0;
+	else if (strncmp(line, "  Microarchitecture: ", 21) == 0) {
+	  line[strcspn(line, "\n")] = '\0';
+	  for (i = 0; x86_target_cpus[i].name != NULL; i++) {
+		if (strcmp(cpuinfo_string_of_uarch(x86_target_cpus[i].uarch), line + 21) == 0)
+		  tp->uarch = x86_target_cpus[i].uarch;
+	  }
+	}
+	else if (in_features && sscanf(line, " %63s", name) == 1) {
+	  for (i = 0; i < N_X86_FEATURES; i++) {
+		const char *feature_name = cpuinfo_string_of_feature(CPUINFO_FEATURE_X86 + i);
+		if (feature_name && strcmp(feature_name, name) == 0)
+		  tp->features[i] = 1;
+	  }
+	}
+  }
+  fclose(fp);
+
+  // "[x86]" heads the x86-specific features
+  return tp->features[0] ? 0 : -1;
+}
+
+static int has_target_feature(const x86_target_t *tp, int feature)
+{
+  return tp->features[feature - CPUINFO_FEATURE_X86];
+}
+
+static int get_target_level(const x86_target_t *tp)
+{
+  int i, level = CPUINFO_X86_LEVEL_V4;
+  for (i = 1; i < N_X86_FEATURES; i++) {
+	int feature_level = cpuinfo_x86_level_of_feature(CPUINFO_FEATURE_X86 + i);
+	if (feature_level != CPUINFO_X86_LEVEL_NONE && feature_level <= level && !tp->features[i])
+	  level = feature_level - 1;
+  }
+  return level;
+}
+
+#define MAX_COMPILER_ARGS 64
+
+// Returns 1 if the C compiler ($CC, or cc) accepts the N_FLAGS flags of FLAGS together
+// $CC is split at blanks, e.g. "ccache gcc -m32", but it is not run through a shell
+static int compiler_accepts(char **flags, int n_flags)
+{
+  const char *cc = getenv("CC");
+  if (cc == NULL || *cc == '\0')
+	cc = "cc";
+  char cc_args[1024];
+  if (snprintf(cc_args, sizeof(cc_args), "%s", cc) >= sizeof(cc_args))
+	return 0;
+
+  char *argv[MAX_COMPILER_ARGS];
+  int i, argc = 0;
+  char *arg;
+  for (arg = strtok(cc_args, " \t"); arg != NULL; arg = strtok(NULL, " \t")) {
+	if (argc >= MAX_COMPILER_ARGS - 5)
+	  return 0;
+	argv[argc++] = arg;
+  }
+  if (argc == 0 || argc + n_flags > MAX_COMPILER_ARGS - 5)
+	return 0;
+  for (i = 0; i < n_flags; i++)
+	argv[argc++] = flags[i];
+  argv[argc++] = "-E";
+  argv[argc++] = "-x";
+  argv[argc++] = "c";
+  argv[argc++] = "/dev/null";
+  argv[argc] = NULL;
+
+  fflush(NULL);
+  pid_t pid = fork();
+  if (pid < 0)
+	return 0;
+  if (pid == 0) {
+	int fd = open("/dev/null", O_WRONLY);
+	if (fd >= 0) {
+	  dup2(fd, STDOUT_FILENO);
+	  dup2(fd, STDERR_FILENO);
+	}
+	execvp(argv[0], argv);
+	_exit(127);
+  }
+  int status;
+  while (waitpid(pid, &status, 0) < 0) {
+	if (errno != EINTR)
+	  return 0;
+  }
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// Mark into ACCEPTED which of the N_FLAGS flags of FLAGS the C compiler accepts, checking
+// them all at once first and only splitting the set when the compiler rejects it
+static void compiler_filter(char **flags, int n_flags, char *accepted)
+{
+  int i;
+  if (n_flags <= 0)
+	return;
+  if (compiler_accepts(flags, n_flags)) {
+	for (i = 0; i < n_flags; i++)
+	  accepted[i] = 1;
+	return;
+  }
+  if (n_flags == 1) {
+	accepted[0] = 0;
+	return;
+  }
+  int half = n_flags / 2;
+  compiler_filter(flags, half, accepted);
+  compiler_filter(flags + half, n_flags - half, accepted + half);
+}
+
+// Returns the -mtune name of UARCH, or of the closest older microarchitecture the compiler knows
+static const char *get_tune_name(int uarch, int check_compiler)
+{
+  int i;
+  while (uarch >= 0) {
+	for (i = 0; x86_target_cpus[i].name != NULL; i++) {
+	  if (x86_target_cpus[i].uarch == uarch)
+		break;
+	}
+	const char *name = x86_target_cpus[i].name;
+	if (name == NULL)
+	  return NULL;
+	char flag[64], *flags[1] = { flag };
+	snprintf(flag, sizeof(flag), "-mtune=%s", name);
+	if (!check_compiler || compiler_accepts(flags, 1))
+	  return name;
+	uarch = x86_target_cpus[i].fallback;
+  }
+  return "generic";
+}
+
+// Print GCC/Clang flags and LLVM target features, as shell variables
+static void print_cflags(struct cpuinfo *cip, const x86_target_t *tp, FILE *out)
+{
+  int i;
+  int level = get_target_level(tp);
+
+  // drop flags the installed compiler does not know, unless there is no compiler to ask
+  int check_compiler = compiler_accepts(NULL, 0);
+
+  fprintf(out, "TARGET_CFLAGS=\"");
+  if (level > CPUINFO_X86_LEVEL_NONE)
+	fprintf(out, "-march=%s", cpuinfo_string_of_x86_level(level));
+  const char *tune = get_tune_name(tp->uarch, check_compiler);
+  if (tune)
+	fprintf(out, " -mtune=%s", tune);
+  // only name the features that the -march level does not imply
+  char flag_names[N_X86_FEATURES][32], *flags[N_X86_FEATURES], accepted[N_X86_FEATURES];
+  int n_flags = 0;
+  for (i = 0; x86_target_features[i].feature != -1 && n_flags < N_X86_FEATURES; i++) {
+	int feature = x86_target_features[i].feature;
+	if (x86_target_features[i].gcc && has_target_feature(tp, feature)
+		&& (cpuinfo_x86_level_of_feature(feature) == CPUINFO_X86_LEVEL_NONE
+			|| cpuinfo_x86_level_of_feature(feature) > level)) {
+	  snprintf(flag_names[n_flags], sizeof(flag_names[n_flags]), "-m%s", x86_target_features[i].gcc);
+	  flags[n_flags] = flag_names[n_flags];
+	  accepted[n_flags] = 1;
+	  n_flags++;
+	}
+  }
+  if (check_compiler)
+	compiler_filter(flags, n_flags, accepted);
+  for (i = 0; i < n_flags; i++) {
+	if (accepted[i])
+	  fprintf(out, " %s", flags[i]);
+  }
+  const cpuinfo_uarch_info_t *uip = cpuinfo_lookup_uarch_info(cip, tp->uarch);
+  if (uip && uip->preferred_vector_width > 0 && uip->preferred_vector_width < uip->vector_width
+	  && has_target_feature(tp, CPUINFO_FEATURE_X86_AVX512F))
+	fprintf(out, " -mprefer-vector-width=%d", uip->preferred_vector_width);
+  fprintf(out, "\"\n");
+
+  fprintf(out, "TARGET_LLVM_FEATURES=\"");
+  const char *sep = "";
+  for (i = 0; x86_target_features[i].feature != -1; i++) {
+	if (x86_target_features[i].llvm == NULL)
+	  continue;
+	fprintf(out, "%s%c%s", sep, has_target_feature(tp, x86_target_features[i].feature) ? '+' : '-',
+			x86_target_features[i].llvm);
+	sep = ",";
+  }
+  fprintf(out, "\"\n");
+}
+
+// x86 ISA requirements recorded into ELF GNU property notes
+#define NT_GNU_PROPERTY_TYPE_0					5
+#define GNU_PROPERTY_X86_FEATURE_2_NEEDED		0xc0008001
+#define GNU_PROPERTY_X86_ISA_1_NEEDED			0xc0008002
+#define GNU_PROPERTY_X86_FEATURE_2_USED			0xc0010001
+#define GNU_PROPERTY_X86_ISA_1_USED				0xc0010002
+
+static const struct {
+  uint32_t mask;
+  const char *name;
+  int feature;
+} x86_property_features[] = {
+  { 1 << 0,		"x86",			-1 },
+  { 1 << 1,		"x87",			-1 },
+  { 1 << 2,		"mmx",			CPUINFO_FEATURE_X86_MMX },
+  { 1 << 3,		"xmm",			CPUINFO_FEATURE_X86_SSE },
+  { 1 << 4,		"ymm",			CPUINFO_FEATURE_X86_AVX },
+  { 1 << 5,		"zmm",			CPUINFO_FEATURE_X86_AVX512F },
+  { 1 << 6,		"fxsr",			-1 },
+  { 1 << 7,		"xsave",		CPUINFO_FEATURE_X86_XSAVE },
+  { 1 << 8,		"xsaveopt",		CPUINFO_FEATURE_X86_XSAVEOPT },
+  { 1 << 9,		"xsavec",		CPUINFO_FEATURE_X86_XSAVEC },
+  { 1 << 10,	"tmm",			CPUINFO_FEATURE_X86_AMX_TILE },
+  { 1 << 11,	"mask",			CPUINFO_FEATURE_X86_AVX512F },
+  { 0, NULL, -1 }
+};
+
+typedef struct {
+  FILE *fp;
+  int is_64bit;
+  int is_big_endian;
+  int has_properties;
+  uint32_t isa_needed;				// GNU_PROPERTY_X86_ISA_1_* bits
+  uint32_t isa_used;
+  uint32_t features_needed;			// GNU_PROPERTY_X86_FEATURE_2_* bits
+  uint32_t features_used;
+} elf_file_t;
+
+static uint32_t elf_get32(const elf_file_t *ep, const uint8_t *p)
+{
+  if (ep->is_big_endian)
+	return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t elf_get16(const elf_file_t *ep, const uint8_t *p)
+{
+  return ep->is_big_endian ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+}
+
+// Get 32-bit field (ELF32) or 64-bit field (ELF64) at offset OFFSET32 or OFFSET64
+static uint64_t elf_get_addr(const elf_file_t *ep, const uint8_t *p, int offset32, int offset64)
+{
+  if (!ep->is_64bit)
+	return elf_get32(ep, p + offset32);
+  uint64_t lo = elf_get32(ep, p + offset64), hi = elf_get32(ep, p + offset64 + 4);
+  return ep->is_big_endian ? (lo << 32) | hi : (hi << 32) | lo;
+}
+
+static int elf_read(elf_file_t *ep, uint64_t offset, void *buf, size_t size)
+{
+  if (fseek(ep->fp, offset, SEEK_SET) < 0 || fread(buf, 1, size, ep->fp) != size)
+	return -1;
+  return 0;
+}
+
+// Parse notes of SIZE bytes at OFFSET, aligned to ALIGN bytes
+static int elf_parse_notes(elf_file_t *ep, uint64_t offset, uint64_t size, uint64_t align)
+{
+  if (size > (1 << 20))
+	return -1;
+  uint8_t *notes = malloc(size);
+  if (notes == NULL)
+	return -1;
+  if (elf_read(ep, offset, notes, size) < 0) {
+	free(notes);
+	return -1;
+  }
+
+  if (align < 4)
+	align = 4;
+  uint64_t pr_align = ep->is_64bit ? 8 : 4;
+#define ALIGN_UP(N, A) (((N) + (A) - 1) & ~((uint64_t)(A) - 1))
+  uint64_t pos = 0;
+  while (pos + 12 <= size) {
+	uint32_t namesz = elf_get32(ep, notes + pos);
+	uint32_t descsz = elf_get32(ep, notes + pos + 4);
+	uint32_t type = elf_get32(ep, notes + pos + 8);
+	uint64_t desc = pos + 12 + ALIGN_UP(namesz, 4);
+	if (desc > size || descsz > size - desc)
+	  break;
+	if (type == NT_GNU_PROPERTY_TYPE_0 && namesz == 4 && memcmp(notes + pos + 12, "GNU", 4) == 0) {
+	  uint64_t pr = desc;
+	  while (pr + 8 <= desc + descsz) {
+		uint32_t pr_type = elf_get32(ep, notes + pr);
+		uint32_t pr_datasz = elf_get32(ep, notes + pr + 4);
+		if (pr_datasz > desc + descsz - pr - 8)
+		  break;
+		if (pr_datasz == 4) {
+		  uint32_t value = elf_get32(ep, notes + pr + 8);
+		  switch (pr_type) {
+		  case GNU_PROPERTY_X86_ISA_1_NEEDED:		ep->isa_needed |= value;		break;
+		  case GNU_PROPERTY_X86_ISA_1_USED:			ep->isa_used |= value;			break;
+		  case GNU_PROPERTY_X86_FEATURE_2_NEEDED:	ep->features_needed |= value;	break;
+		  case GNU_PROPERTY_X86_FEATURE_2_USED:		ep->features_used |= value;		break;
+		  }
+		  ep->has_properties = 1;
+		}
+		pr += ALIGN_UP(8 + pr_datasz, pr_align);
+	  }
+	}
+	pos = ALIGN_UP(desc + descsz, align);
+  }
+#undef ALIGN_UP
+
+  free(notes);
+  return 0;
+}
+
+// Collect x86 properties from SHT_NOTE sections, or PT_NOTE segments if there are no sections
+static int elf_read_properties(elf_file_t *ep)
+{
+  uint8_t ehdr[64];
+  if (elf_read(ep, 0, ehdr, 16) < 0 || memcmp(ehdr, "\177ELF", 4) != 0)
+	return -1;
+  if (ehdr[4] != 1 && ehdr[4] != 2)
+	return -1;
+  ep->is_64bit = ehdr[4] == 2;
+  ep->is_big_endian = ehdr[5] == 2;
+  if (elf_read(ep, 0, ehdr, ep->is_64bit ? 64 : 52) < 0)
+	return -1;
+
+  int machine = elf_get16(ep, ehdr + 18);
+  if (machine != 3 && machine != 62)	// EM_386, EM_X86_64
+	return -1;
+
+  int i;
+  uint8_t hdr[64];
+  uint64_t shoff = elf_get_addr(ep, ehdr, 32, 40);
+  int shentsize = elf_get16(ep, ehdr + (ep->is_64bit ? 58 : 46));
+  int shnum = elf_get16(ep, ehdr + (ep->is_64bit ? 60 : 48));
+  if (shoff && shnum > 0 && shentsize <= sizeof(hdr)) {
+	for (i = 0; i < shnum; i++) {
+	  if (elf_read(ep, shoff + (uint64_t)i * shentsize, hdr, shentsize) < 0)
+		return -1;
+	  if (elf_get32(ep, hdr + 4) == 7)	// SHT_NOTE
+		elf_parse_notes(ep, elf_get_addr(ep, hdr, 16, 24), elf_get_addr(ep, hdr, 20, 32), elf_get_addr(ep, hdr, 32, 48));
+	}
+	return 0;
+  }
+
+  uint64_t phoff = elf_get_addr(ep, ehdr, 28, 32);
+  int phentsize = elf_get16(ep, ehdr + (ep->is_64bit ? 54 : 42));
+  int phnum = elf_get16(ep, ehdr + (ep->is_64bit ? 56 : 44));
+  if (phoff && phnum > 0 && phentsize <= sizeof(hdr)) {
+	for (i = 0; i < phnum; i++) {
+	  if (elf_read(ep, phoff + (uint64_t)i * phentsize, hdr, phentsize) < 0)
+		return -1;
+	  if (elf_get32(ep, hdr) == 4)		// PT_NOTE
+		elf_parse_notes(ep, elf_get_addr(ep, hdr, 4, 8), elf_get_addr(ep, hdr, 16, 32), elf_get_addr(ep, hdr, 28, 48));
+	}
+  }
+  return 0;
+}
+
+// Returns the highest x86-64 level of GNU_PROPERTY_X86_ISA_1_* bits ISA
+static int get_property_level(uint32_t isa)
+{
+  int level = CPUINFO_X86_LEVEL_NONE;
+  if (isa & (1 << 0))
+	level = CPUINFO_X86_LEVEL_V1;
+  if (isa & (1 << 1))
+	level = CPUINFO_X86_LEVEL_V2;
+  if (isa & (1 << 2))
+	level = CPUINFO_X86_LEVEL_V3;
+  if (isa & (1 << 3))
+	level = CPUINFO_X86_LEVEL_V4;
+  return level;
+}
+
+static void print_property_features(FILE *out, const char *label, uint32_t features)
+{
+  int i;
+  fprintf(out, "  %s:", label);
+  for (i = 0; x86_property_features[i].name != NULL; i++) {
+	if (features & x86_property_features[i].mask)
+	  fprintf(out, " %s", x86_property_features[i].name);
+  }
+  fprintf(out, "\n");
+}
+
+// Print the features of ISA and FEATURES bits that TP lacks, returns their number
+static int print_missing_features(FILE *out, const char *label, const x86_target_t *tp, uint32_t isa, uint32_t features)
+{
+  int i, n_missing = 0, level = get_property_level(isa);
+  char missing[N_X86_FEATURES];
+  memset(missing, 0, sizeof(missing));
+  for (i = 1; i < N_X86_FEATURES; i++) {
+	int feature_level = cpuinfo_x86_level_of_feature(CPUINFO_FEATURE_X86 + i);
+	if (feature_level != CPUINFO_X86_LEVEL_NONE && feature_level <= level)
+	  missing[i] = !tp->features[i];
+  }
+  for (i = 0; x86_property_features[i].name != NULL; i++) {
+	int feature = x86_property_features[i].feature;
+	if ((features & x86_property_features[i].mask) && feature >= 0)
+	  missing[feature - CPUINFO_FEATURE_X86] = !has_target_feature(tp, feature);
+  }
+
+  fprintf(out, "  %s:", label);
+  for (i = 1; i < N_X86_FEATURES; i++) {
+	if (missing[i]) {
+	  fprintf(out, " %s", cpuinfo_string_of_feature(CPUINFO_FEATURE_X86 + i));
+	  n_missing++;
+	}
+  }
+  fprintf(out, "%s\n", n_missing ? "" : " none");
+  return n_missing;
+}
+
+// Check the host processor has the features recorded into binary FILENAME, returns the
+// number of missing features the binary needs, or uses if STRICT, or -1 on error
+static int check_binary(struct cpuinfo *cip, const char *filename, int strict, FILE *out)
+{
+  elf_file_t elf;
+  memset(&elf, 0, sizeof(elf));
+  if ((elf.fp = fopen(filename, "rb")) == NULL)
+	return -1;
+  int ret = elf_read_properties(&elf);
+  fclose(elf.fp);
+  if (ret < 0)
+	return -1;
+
+  fprintf(out, "Binary Requirements\n");
+  fprintf(out, "  File: %s\n", filename);
+  if (!elf.has_properties) {
+	fprintf(out, "  No x86 ISA properties recorded\n");
+	return 0;
+  }
+
+  x86_target_t host;
+  get_host_target(cip, &host);
+  int n_needed = 0, n_used = 0;
+  if (elf.isa_needed || elf.features_needed) {
+	fprintf(out, "  ISA Level Needed: %s\n", cpuinfo_string_of_x86_level(get_property_level(elf.isa_needed)));
+	if (elf.features_needed)
+	  print_property_features(out, "Registers Needed", elf.features_needed);
+	n_needed = print_missing_features(out, "Missing Needed Features", &host, elf.isa_needed, elf.features_needed);
+  }
+  // features used may be guarded by a run-time check in the binary
+  if (elf.isa_used || elf.features_used) {
+	fprintf(out, "  ISA Level Used: %s\n", cpuinfo_string_of_x86_level(get_property_level(elf.isa_used)));
+	if (elf.features_used)
+	  print_property_features(out, "Registers Used", elf.features_used);
+	n_used = print_missing_features(out, "Missing Used Features", &host, elf.isa_used, elf.features_used);
+  }
+  // features used include the ones needed
+  return strict && n_used > n_needed ? n_used : n_needed;
+}
+
+static void print_memory_level(FILE *out, const cpuinfo_memory_level_t *lp)
+{
+  if (lp->level > 0) {
+	fprintf(out, "  L%d: ", lp->level);
+	print_size(out, lp->size / 1024);
+	fprintf(out, " per thread, ");
+  }
+  else
+	fprintf(out, "  Memory: ");
+  fprintf(out, "%.1f ns, %.1f GB/s\n", lp->latency, lp->bandwidth);
+}
+
+static void print_memory_model(struct cpuinfo *cip, FILE *out)
+{
+  static const int n_threads[] = { 1, 0 };
+  static const unsigned long working_sets[] = { 16 << 10, 256 << 10, 4 << 20, 48 << 20, 1 << 30 };
+  int i, j, n;
+
+  for (i = 0; i < sizeof(n_threads) / sizeof(n_threads[0]); i++) {
+	cpuinfo_memory_model_t *mp = cpuinfo_memory_model_new(cip, n_threads[i], CPUINFO_PLACEMENT_SPREAD);
+	if (mp == NULL)
+	  continue;
+	cpuinfo_memory_model_calibrate(mp);
+	if (i > 0)
+	  fprintf(out, "\n");
+	fprintf(out, "Memory Hierarchy, %s%s\n", n_threads[i] ? "single thread" : "one thread per logical processor",
+			cpuinfo_memory_model_is_calibrated(mp) ? ", calibrated" : "");
+	cpuinfo_memory_level_t levels[8];
+	n = cpuinfo_memory_model_get_levels(mp, levels, sizeof(levels) / sizeof(levels[0]));
+	for (j = 0; j < n; j++)
+	  print_memory_level(out, &levels[j]);
+	for (j = 0; j < sizeof(working_sets) / sizeof(working_sets[0]); j++) {
+	  cpuinfo_memory_cost_t random, streaming;
+	  if (cpuinfo_memory_model_get_cost(mp, working_sets[j], CPUINFO_ACCESS_HASH_TABLE, &random) < 0 ||
+		  cpuinfo_memory_model_get_cost(mp, working_sets[j], CPUINFO_ACCESS_STREAMING, &streaming) < 0)
+		continue;
+	  fprintf(out, "  ");
+	  print_size(out, working_sets[j] / 1024);
+	  fprintf(out, " working set: random %.1f ns, streaming %.1f GB/s\n", random.latency, streaming.bandwidth);
+	}
+	cpuinfo_memory_model_destroy(mp);
+  }
+}
+
 int main(int argc, char *argv[])
 {
   int i;
   FILE *out;
   const char *out_filename = NULL;
+  int print_status = 0;
+  int verify_features = 0;
+  int print_flags = 0;
+  int print_memory = 0;
+  const char *target_filename = NULL;
+  const char *binary_filename = NULL;
+  int strict_binary = 0;
 
   for (i = 1; i < argc; i++) {
 	const char *arg = argv[i];
@@ -132,6 +1091,27 @@ int main(int argc, char *argv[])
 	  else
 		out_filename = "-"; /* stdout */
 	}
+	else if (strcmp(arg, "-s") == 0 || strcmp(arg, "--status") == 0)
+	  print_status = 1;
+	else if (strcmp(arg, "-v") == 0 || strcmp(arg, "--verify") == 0)
+	  verify_features = 1;
+	else if (strcmp(arg, "-c") == 0 || strcmp(arg, "--cflags") == 0) {
+	  print_flags = 1;
+	  if (i + 1 < argc && argv[i + 1][0] != '-')
+		target_filename = argv[++i];
+	}
+	else if (strcmp(arg, "-b") == 0 || strcmp(arg, "--check-binary") == 0) {
+	  if (++i < argc)
+		binary_filename = argv[i];
+	  else {
+		print_usage(argv[0]);
+		return 1;
+	  }
+	}
+	else if (strcmp(arg, "--strict") == 0)
+	  strict_binary = 1;
+	else if (strcmp(arg, "-m") == 0 || strcmp(arg, "--memory-model") == 0)
+	  print_memory = 1;
 	else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
 	  print_usage(argv[0]);
 	  return 0;
@@ -156,7 +1136,45 @@ int main(int argc, char *argv[])
   if (out_filename)
 	cpuinfo_set_debug_file(out);
 
-  print_cpuinfo(cip, out);
+  if (verify_features) {
+	int n_faults = cpuinfo_verify_features(cip);
+	if (n_faults > 0)
+	  fprintf(stderr, "WARNING: disabled %d advertised feature%s that fault%s when executed\n",
+			  n_faults, n_faults > 1 ? "s" : "", n_faults > 1 ? "" : "s");
+  }
+
+  int status = 0;
+  if (binary_filename) {
+	int n_missing = -1;
+	if (cpuinfo_get_x86_level(cip) < 0)
+	  fprintf(stderr, "ERROR: binaries can only be checked on x86 processors\n");
+	else if ((n_missing = check_binary(cip, binary_filename, strict_binary, out)) < 0)
+	  fprintf(stderr, "ERROR: could not read x86 ELF binary '%s'\n", binary_filename);
+	if (n_missing != 0)
+	  status = n_missing < 0 ? 3 : 4;
+  }
+  else if (print_flags) {
+	x86_target_t target;
+	if (target_filename) {
+	  if (read_target(target_filename, &target) < 0) {
+		fprintf(stderr, "ERROR: could not read x86 processor description from '%s'\n", target_filename);
+		return 3;
+	  }
+	}
+	else if (cpuinfo_get_x86_level(cip) < 0) {
+	  fprintf(stderr, "ERROR: compiler flags are only available for x86 processors\n");
+	  return 3;
+	}
+	else
+	  get_host_target(cip, &target);
+	print_cflags(cip, &target, out);
+  }
+  else if (print_memory)
+	print_memory_model(cip, out);
+  else if (print_status)
+	print_feature_status(cip, out);
+  else
+	print_cpuinfo(cip, out);
 
   if (out_filename) { /* debug mode */
 	fprintf(out, "\n### DEBUGGING INFORMATION ###\n\n");
@@ -168,5 +1186,5 @@ int main(int argc, char *argv[])
 
   cpuinfo_destroy(cip);
 
-  return 0;
+  return status;
 }
@@ -21,6 +21,8 @@
 #ifndef CPUINFO_H
 #define CPUINFO_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -60,7 +62,8 @@ typedef enum {
   CPUINFO_VENDOR_SIS,
   CPUINFO_VENDOR_TRANSMETA,
   CPUINFO_VENDOR_UMC,
-  CPUINFO_VENDOR_PASEMI
+  CPUINFO_VENDOR_PASEMI,
+  CPUINFO_VENDOR_HYGON
 } cpuinfo_vendor_t;
 
 // Get processor vendor ID 
@@ -69,6 +72,77 @@ extern int cpuinfo_get_vendor(cpuinfo_t *cip);
 // Get processor name
 extern const char *cpuinfo_get_model(cpuinfo_t *cip);
 
+// Get host identifier, a hash of the processor signature and features (16 hex digits)
+extern const char *cpuinfo_get_host_id(cpuinfo_t *cip);
+
+// Processor microarchitecture (of the current core on hybrid processors)
+typedef enum {
+  CPUINFO_UARCH_UNKNOWN,
+
+  CPUINFO_UARCH_P5 = CPUINFO_CLASS('I'),
+  CPUINFO_UARCH_P6,
+  CPUINFO_UARCH_PENTIUM_M,
+  CPUINFO_UARCH_NETBURST,
+  CPUINFO_UARCH_CORE,
+  CPUINFO_UARCH_CORE2,
+  CPUINFO_UARCH_PENRYN,
+  CPUINFO_UARCH_NEHALEM,
+  CPUINFO_UARCH_WESTMERE,
+  CPUINFO_UARCH_SANDY_BRIDGE,
+  CPUINFO_UARCH_IVY_BRIDGE,
+  CPUINFO_UARCH_HASWELL,
+  CPUINFO_UARCH_BROADWELL,
+  CPUINFO_UARCH_SKYLAKE,
+  CPUINFO_UARCH_SKYLAKE_SP,
+  CPUINFO_UARCH_CASCADE_LAKE,
+  CPUINFO_UARCH_COOPER_LAKE,
+  CPUINFO_UARCH_CANNON_LAKE,
+  CPUINFO_UARCH_ICE_LAKE,
+  CPUINFO_UARCH_ICE_LAKE_SP,
+  CPUINFO_UARCH_TIGER_LAKE,
+  CPUINFO_UARCH_ROCKET_LAKE,
+  CPUINFO_UARCH_SAPPHIRE_RAPIDS,
+  CPUINFO_UARCH_EMERALD_RAPIDS,
+  CPUINFO_UARCH_GRANITE_RAPIDS,
+  CPUINFO_UARCH_GOLDEN_COVE,		// Alder Lake performance cores
+  CPUINFO_UARCH_RAPTOR_COVE,		// Raptor Lake performance cores
+  CPUINFO_UARCH_REDWOOD_COVE,		// Meteor Lake performance cores
+  CPUINFO_UARCH_LION_COVE,			// Lunar Lake and Arrow Lake performance cores
+  CPUINFO_UARCH_BONNELL,
+  CPUINFO_UARCH_SALTWELL,
+  CPUINFO_UARCH_SILVERMONT,
+  CPUINFO_UARCH_AIRMONT,
+  CPUINFO_UARCH_GOLDMONT,
+  CPUINFO_UARCH_GOLDMONT_PLUS,
+  CPUINFO_UARCH_TREMONT,
+  CPUINFO_UARCH_GRACEMONT,
+  CPUINFO_UARCH_CRESTMONT,
+  CPUINFO_UARCH_SKYMONT,
+  CPUINFO_UARCH_KNIGHTS_LANDING,
+  CPUINFO_UARCH_KNIGHTS_MILL,
+
+  CPUINFO_UARCH_K6 = CPUINFO_CLASS('A'),
+  CPUINFO_UARCH_K7,
+  CPUINFO_UARCH_K8,
+  CPUINFO_UARCH_K10,
+  CPUINFO_UARCH_BOBCAT,
+  CPUINFO_UARCH_BULLDOZER,
+  CPUINFO_UARCH_PILEDRIVER,
+  CPUINFO_UARCH_STEAMROLLER,
+  CPUINFO_UARCH_EXCAVATOR,
+  CPUINFO_UARCH_JAGUAR,
+  CPUINFO_UARCH_PUMA,
+  CPUINFO_UARCH_ZEN,
+  CPUINFO_UARCH_ZEN_PLUS,
+  CPUINFO_UARCH_ZEN2,
+  CPUINFO_UARCH_ZEN3,
+  CPUINFO_UARCH_ZEN4,
+  CPUINFO_UARCH_ZEN5
+} cpuinfo_uarch_t;
+
+// Get processor microarchitecture
+extern int cpuinfo_get_uarch(cpuinfo_t *cip);
+
 // Processor socket
 typedef enum {
   CPUINFO_SOCKET_UNKNOWN,
@@ -115,6 +189,9 @@ typedef struct {
   int type;		// cache type (above)
   int level;	// cache level
   int size;		// cache size in KB
+  int sharing;	// number of logical processors sharing the cache (0 if unknown)
+  int line_size;	// line size in bytes (0 if unknown)
+  int ways;		// associativity (-1 if fully associative, 0 if unknown)
 } cpuinfo_cache_descriptor_t;
 
 typedef struct {
@@ -125,6 +202,360 @@ typedef struct {
 // Get cache information (returns read-only descriptors)
 extern const cpuinfo_cache_t *cpuinfo_get_caches(cpuinfo_t *cip);
 
+// Get cache of LEVEL and TYPE, data caches fall back to the unified cache of LEVEL (NULL if there is none)
+extern const cpuinfo_cache_descriptor_t *cpuinfo_get_cache(cpuinfo_t *cip, int level, int type);
+
+// Get number of bytes fetched by the hardware prefetcher at once (0 if unknown)
+extern int cpuinfo_get_prefetch_size(cpuinfo_t *cip);
+
+// Placements of a group of threads onto logical processors
+typedef enum {
+  CPUINFO_PLACEMENT_SPREAD,		// as few threads per cache as possible, e.g. one per core first
+  CPUINFO_PLACEMENT_COMPACT		// fill SMT siblings and shared caches first
+} cpuinfo_placement_t;
+
+// Data access patterns of blocked algorithms
+typedef enum {
+  CPUINFO_ACCESS_STREAMING,		// sequential passes over a block
+  CPUINFO_ACCESS_TILES,			// 2-D tiles of one or more arrays
+  CPUINFO_ACCESS_HASH_TABLE,	// random accesses into a table partition
+  CPUINFO_ACCESS_MAX
+} cpuinfo_access_pattern_t;
+
+typedef struct {
+  int level;					// cache level
+  int line_size;				// line size in bytes (64 if unknown)
+  int ways;						// associativity (-1 if fully associative, 0 if unknown)
+  int threads;					// threads of the placement sharing the cache
+  unsigned long capacity;		// capacity available to each thread, in bytes
+  unsigned long block_size[CPUINFO_ACCESS_MAX];	// recommended block size per access pattern, in bytes
+} cpuinfo_cache_blocking_t;
+
+// Get data cache blocking parameters, from level 1 up, for each of N_THREADS threads placed as
+// PLACEMENT (N_THREADS <= 0 for all online processors), returns the number of levels stored into BLOCKS
+extern int cpuinfo_get_cache_blocking(cpuinfo_t *cip, int n_threads, int placement, cpuinfo_cache_blocking_t *blocks, int n);
+
+// Get edge, in elements of ELEM_SIZE bytes, of square tiles such that tiles of N_ARRAYS arrays fit into the block of BP
+extern int cpuinfo_get_tile_edge(const cpuinfo_cache_blocking_t *bp, int n_arrays, int elem_size);
+
+/* ========================================================================= */
+/* == Processor TLB Information                                           == */
+/* ========================================================================= */
+
+typedef enum {
+  CPUINFO_PAGE_SIZE_4K	= 1 << 0,
+  CPUINFO_PAGE_SIZE_2M	= 1 << 1,
+  CPUINFO_PAGE_SIZE_4M	= 1 << 2,
+  CPUINFO_PAGE_SIZE_1G	= 1 << 3
+} cpuinfo_page_size_t;
+
+typedef struct {
+  int type;			// TLB type (CPUINFO_CACHE_TYPE_{CODE,DATA,UNIFIED})
+  int level;		// TLB level
+  int page_sizes;	// supported page sizes (mask of CPUINFO_PAGE_SIZE_*)
+  int entries;		// number of entries
+  int ways;			// associativity (-1 if fully associative, 0 if unknown)
+  int sharing;		// number of logical processors sharing the TLB (0 if unknown)
+} cpuinfo_tlb_descriptor_t;
+
+typedef struct {
+  int count;		// number of TLB descriptors
+  const cpuinfo_tlb_descriptor_t *descriptors;
+} cpuinfo_tlb_t;
+
+// Get TLB information (returns read-only descriptors)
+extern const cpuinfo_tlb_t *cpuinfo_get_tlbs(cpuinfo_t *cip);
+
+// Get memory covered by the data TLBs for pages of PAGE_SIZE, in KB (0 if unknown)
+extern unsigned long cpuinfo_get_tlb_reach(cpuinfo_t *cip, int page_size);
+
+/* ========================================================================= */
+/* == Processor Topology Information                                      == */
+/* ========================================================================= */
+
+typedef struct {
+  int n_cpus;		// number of logical processors
+  const int *cpus;	// logical processor numbers
+  int n_cores;		// number of physical cores
+  int cache_level;	// level of the shared last-level cache
+  int cache_size;	// size of the shared last-level cache in KB
+  int node;			// NUMA node (-1 if unknown)
+} cpuinfo_core_complex_t;
+
+typedef struct {
+  int count;		// number of core complexes
+  const cpuinfo_core_complex_t *complexes;
+} cpuinfo_core_complexes_t;
+
+// Get groups of cores sharing a last-level cache (returns read-only descriptors)
+extern const cpuinfo_core_complexes_t *cpuinfo_get_core_complexes(cpuinfo_t *cip);
+
+// Processor core type
+typedef enum {
+  CPUINFO_CORE_TYPE_UNKNOWN,
+  CPUINFO_CORE_TYPE_PERFORMANCE,
+  CPUINFO_CORE_TYPE_EFFICIENCY
+} cpuinfo_core_type_t;
+
+typedef struct {
+  int id;			// logical processor number
+  int package;		// physical package ID
+  int core;			// core ID within the package
+  int core_type;	// core type (above)
+  int native_model;	// native model ID (-1 if unknown)
+  int uarch;		// core microarchitecture
+  int capacity;		// relative capacity, 1024 for the fastest cores (-1 if unknown)
+  int highest_perf;	// highest performance level (-1 if unknown)
+  int nominal_perf;	// guaranteed performance level (-1 if unknown)
+  int base_frequency;	// guaranteed frequency in MHz (-1 if unknown)
+  int max_frequency;	// maximum frequency in MHz (-1 if unknown)
+  int tier;			// performance tier, 0 for the fastest processors
+} cpuinfo_processor_t;
+
+typedef struct {
+  int count;		// number of logical processors
+  const cpuinfo_processor_t *processors;
+} cpuinfo_processors_t;
+
+// Get online logical processors information (returns read-only descriptors)
+extern const cpuinfo_processors_t *cpuinfo_get_processors(cpuinfo_t *cip);
+
+// Get the N fastest logical processors, returns the number of processors stored into CPUS
+extern int cpuinfo_get_fastest_cpus(cpuinfo_t *cip, int *cpus, int n);
+
+// Returns a new cpuinfo descriptor for the specified logical processor
+extern cpuinfo_t *cpuinfo_new_for_cpu(int cpu);
+
+typedef struct {
+  int n_cpus;		// logical processors the process may run on
+  int n_cores;		// physical cores of these logical processors
+  double quota;		// CPU time quota in processors (0 if unlimited)
+  int n_workers;	// recommended number of worker threads
+} cpuinfo_cpu_budget_t;
+
+// Get the processors the calling process may use, honouring its affinity, cgroup cpuset and
+// cgroup CPU quota (evaluated on each call)
+extern int cpuinfo_get_cpu_budget(cpuinfo_t *cip, cpuinfo_cpu_budget_t *bp);
+
+/* ========================================================================= */
+/* == Memory Pages Information                                            == */
+/* ========================================================================= */
+
+typedef enum {
+  CPUINFO_PAGE_HARDWARE		= 1 << 0,	// supported by the processor
+  CPUINFO_PAGE_BASE			= 1 << 1,	// base page size of the OS
+  CPUINFO_PAGE_HUGETLB		= 1 << 2,	// free pages in the hugetlbfs pool
+  CPUINFO_PAGE_THP_MADVISE	= 1 << 3,	// transparent huge pages for madvise(MADV_HUGEPAGE) regions
+  CPUINFO_PAGE_THP_ALWAYS	= 1 << 4,	// transparent huge pages for all anonymous mappings
+  CPUINFO_PAGE_THP_DEFRAG	= 1 << 5,	// page faults compact memory to get transparent huge pages
+  CPUINFO_PAGE_AVAILABLE	= 1 << 6	// pages of this size can be allocated now
+} cpuinfo_page_flags_t;
+
+typedef struct {
+  int size;			// page size in KB
+  int flags;		// CPUINFO_PAGE_* flags
+  int nr_pages;		// number of pages in the hugetlbfs pool
+  int free_pages;	// number of free pages in the hugetlbfs pool
+} cpuinfo_page_info_t;
+
+// Get page sizes on NUMA node NODE (-1 for all nodes), returns the number of page sizes stored into PAGES
+// or -1 if NODE does not exist
+extern int cpuinfo_get_page_info(cpuinfo_t *cip, int node, cpuinfo_page_info_t *pages, int n);
+
+// Get distance from NUMA node FROM to the memory of node TO, 10 being local (-1 if unknown)
+extern int cpuinfo_get_node_distance(cpuinfo_t *cip, int from, int to);
+
+/* ========================================================================= */
+/* == Memory Hierarchy Model                                              == */
+/* ========================================================================= */
+
+typedef struct cpuinfo_memory_model cpuinfo_memory_model_t;
+
+typedef struct {
+  int level;			// cache level, 0 for main memory
+  unsigned long size;	// capacity available to each thread in bytes (0 for main memory)
+  double latency;		// load-to-use latency in ns
+  double bandwidth;		// read bandwidth available to each thread in GB/s
+} cpuinfo_memory_level_t;
+
+typedef struct {
+  int level;			// level holding the working set, 0 for main memory
+  double latency;		// expected latency of an access in ns
+  double bandwidth;		// expected read bandwidth available to each thread in GB/s
+} cpuinfo_memory_cost_t;
+
+// Returns a new memory hierarchy model for N_THREADS threads placed as PLACEMENT (N_THREADS <= 0
+// for all online processors), estimated from the caches, TLBs and NUMA distances
+extern cpuinfo_memory_model_t *cpuinfo_memory_model_new(cpuinfo_t *cip, int n_threads, int placement);
+
+// Release memory hierarchy model
+extern void cpuinfo_memory_model_destroy(cpuinfo_memory_model_t *mp);
+
+// Refine latencies and bandwidths by timing accesses on this processor (takes a fraction of a second,
+// results are shared by all models of the process)
+extern int cpuinfo_memory_model_calibrate(cpuinfo_memory_model_t *mp);
+
+// Returns 1 if the model was calibrated
+extern int cpuinfo_memory_model_is_calibrated(const cpuinfo_memory_model_t *mp);
+
+// Get levels of the model, caches first then main memory, returns the number of levels stored into LEVELS
+extern int cpuinfo_memory_model_get_levels(const cpuinfo_memory_model_t *mp, cpuinfo_memory_level_t *levels, int n);
+
+// Get expected cost of accesses following PATTERN into a working set of WORKING_SET bytes, random
+// accesses (CPUINFO_ACCESS_HASH_TABLE) also pay for TLB misses
+extern int cpuinfo_memory_model_get_cost(const cpuinfo_memory_model_t *mp, unsigned long working_set, int pattern, cpuinfo_memory_cost_t *cp);
+
+/* ========================================================================= */
+/* == Processor Tiles Information                                         == */
+/* ========================================================================= */
+
+// AMX tile palette 1 geometry
+typedef struct {
+  int max_palette;		// highest supported palette ID
+  int total_tile_bytes;	// size of all tile registers in bytes
+  int bytes_per_tile;	// size of a tile register in bytes
+  int bytes_per_row;	// maximum size of a tile row in bytes
+  int max_names;		// number of tile registers
+  int max_rows;			// maximum number of rows in a tile
+  int tmul_maxk;		// maximum K dimension (rows) of TMUL operations
+  int tmul_maxn;		// maximum N dimension (bytes per row) of TMUL operations
+} cpuinfo_tile_info_t;
+
+// Get AMX tile palette information (returns -1 if tiles are not supported)
+extern int cpuinfo_get_tile_info(cpuinfo_t *cip, cpuinfo_tile_info_t *tip);
+
+// Request permission to use AMX tile data (returns 1 if tiles are usable)
+// AMX features are not reported as usable until permission is granted
+extern int cpuinfo_request_tile_permission(cpuinfo_t *cip);
+
+/* ========================================================================= */
+/* == Processor Extended State Information                                == */
+/* ========================================================================= */
+
+// Extended state components (XSAVE feature set)
+typedef enum {
+  CPUINFO_XSAVE_COMPONENT_X87,
+  CPUINFO_XSAVE_COMPONENT_SSE,
+  CPUINFO_XSAVE_COMPONENT_AVX,
+  CPUINFO_XSAVE_COMPONENT_BNDREGS,
+  CPUINFO_XSAVE_COMPONENT_BNDCSR,
+  CPUINFO_XSAVE_COMPONENT_OPMASK,
+  CPUINFO_XSAVE_COMPONENT_ZMM_HI256,
+  CPUINFO_XSAVE_COMPONENT_HI16_ZMM,
+  CPUINFO_XSAVE_COMPONENT_PT,
+  CPUINFO_XSAVE_COMPONENT_PKRU,
+  CPUINFO_XSAVE_COMPONENT_PASID,
+  CPUINFO_XSAVE_COMPONENT_CET_U,
+  CPUINFO_XSAVE_COMPONENT_CET_S,
+  CPUINFO_XSAVE_COMPONENT_HDC,
+  CPUINFO_XSAVE_COMPONENT_UINTR,
+  CPUINFO_XSAVE_COMPONENT_LBR,
+  CPUINFO_XSAVE_COMPONENT_HWP,
+  CPUINFO_XSAVE_COMPONENT_TILECFG,
+  CPUINFO_XSAVE_COMPONENT_TILEDATA,
+  CPUINFO_XSAVE_COMPONENT_APX
+} cpuinfo_xsave_component_id_t;
+
+// Instructions to save the extended state
+typedef enum {
+  CPUINFO_XSAVE_INSN_NONE,
+  CPUINFO_XSAVE_INSN_FXSAVE,
+  CPUINFO_XSAVE_INSN_XSAVE,
+  CPUINFO_XSAVE_INSN_XSAVEOPT,
+  CPUINFO_XSAVE_INSN_XSAVEC
+} cpuinfo_xsave_insn_t;
+
+typedef struct {
+  int id;			// state component number (XCR0 bit)
+  int size;			// size in bytes
+  int offset;		// offset in the standard format save area
+  int aligned;		// 64-byte aligned in the compacted format save area
+} cpuinfo_xsave_component_t;
+
+typedef struct {
+  int count;			// number of components enabled by the OS
+  const cpuinfo_xsave_component_t *components;
+  int size;				// size of the standard format save area
+  int compacted_size;	// size of the compacted format save area (0 if unsupported)
+  int max_size;			// size of the save area for all supported components
+  int save_insn;		// cheapest user-level save instruction
+} cpuinfo_xsave_t;
+
+// Get extended state components enabled by the OS (returns read-only descriptors)
+extern const cpuinfo_xsave_t *cpuinfo_get_xsave_info(cpuinfo_t *cip);
+
+/* ========================================================================= */
+/* == Virtualization Information                                          == */
+/* ========================================================================= */
+
+typedef enum {
+  CPUINFO_VIRTUALIZER_NONE,
+  CPUINFO_VIRTUALIZER_UNKNOWN,
+  CPUINFO_VIRTUALIZER_KVM,
+  CPUINFO_VIRTUALIZER_XEN,
+  CPUINFO_VIRTUALIZER_HYPERV,
+  CPUINFO_VIRTUALIZER_VMWARE,
+  CPUINFO_VIRTUALIZER_VIRTUALBOX,
+  CPUINFO_VIRTUALIZER_PARALLELS,
+  CPUINFO_VIRTUALIZER_QEMU,
+  CPUINFO_VIRTUALIZER_BHYVE,
+  CPUINFO_VIRTUALIZER_ACRN
+} cpuinfo_virtualizer_t;
+
+typedef struct {
+  int id;				// virtualizer (CPUINFO_VIRTUALIZER_NONE on bare metal)
+  int tsc_frequency;	// TSC frequency in kHz reported by the virtualizer (0 if unknown)
+  int apic_frequency;	// local APIC timer frequency in kHz (0 if unknown)
+  int has_pvclock;		// paravirtual clock available
+  int cpuid_cost;		// cost of one CPUID instruction in TSC ticks (-1 if unknown)
+} cpuinfo_virtualizer_info_t;
+
+// Get virtualizer the program is running under
+extern int cpuinfo_get_virtualizer(cpuinfo_t *cip);
+
+// Get virtualizer and paravirtual timing information (returns read-only descriptor)
+extern const cpuinfo_virtualizer_info_t *cpuinfo_get_virtualizer_info(cpuinfo_t *cip);
+
+/* ========================================================================= */
+/* == Microarchitecture Characteristics                                   == */
+/* ========================================================================= */
+
+// Instructions that are slower than their architectural description suggests
+typedef enum {
+  CPUINFO_SLOW_UNALIGNED		= 1 << 0,	// unaligned vector loads are slower than aligned ones
+  CPUINFO_SLOW_DIV64			= 1 << 1,	// 64-bit integer division is much slower than 32-bit
+  CPUINFO_SLOW_GATHER			= 1 << 2,	// vector gathers are slower than scalar loads
+  CPUINFO_SLOW_SCATTER			= 1 << 3,	// vector scatters are slower than scalar stores
+  CPUINFO_SLOW_PDEP_PEXT		= 1 << 4,	// PDEP/PEXT are microcoded
+  CPUINFO_SLOW_AVX512_FREQ		= 1 << 5,	// heavy 512-bit instructions lower the core frequency
+  CPUINFO_SLOW_SHORT_REP_MOVSB	= 1 << 6	// REP MOVSB has a high startup cost for short copies
+} cpuinfo_slow_insn_t;
+
+// Performance characteristics, all fields are 0 if unknown
+typedef struct {
+  int uarch;					// microarchitecture
+  int vector_width;				// widest vector registers, in bits
+  int datapath_width;			// width of the vector execution units, in bits
+  int preferred_vector_width;	// vector width code should be tuned for, in bits
+  int fma_units;				// number of vector FMA units
+  int load_units;				// number of loads per cycle
+  int store_units;				// number of stores per cycle
+  int rob_size;					// reorder buffer entries
+  int load_buffer_size;			// load buffer entries
+  int store_buffer_size;		// store buffer entries
+  int l1_latency;				// L1 data cache load-to-use latency, in cycles
+  int l2_latency;				// L2 cache latency, in cycles
+  int l3_latency;				// typical L3 cache latency, in cycles
+  int rep_movsb_threshold;		// size in bytes from which REP MOVSB beats vector copies
+  int slow_insns;				// slow instructions (cpuinfo_slow_insn_t flags)
+} cpuinfo_uarch_info_t;
+
+// Get performance characteristics of the processor (returns read-only descriptor, or NULL if unknown)
+extern const cpuinfo_uarch_info_t *cpuinfo_get_uarch_info(cpuinfo_t *cip);
+
+// Get performance characteristics of microarchitecture UARCH (e.g. the uarch of a hybrid core)
+extern const cpuinfo_uarch_info_t *cpuinfo_lookup_uarch_info(cpuinfo_t *cip, int uarch);
+
 /* ========================================================================= */
 /* == Processor Features Information                                      == */
 /* ========================================================================= */
@@ -165,6 +596,86 @@ typedef enum {
   CPUINFO_FEATURE_X86_TM2,
   CPUINFO_FEATURE_X86_EIST,
   CPUINFO_FEATURE_X86_NX,
+  CPUINFO_FEATURE_X86_CX16,
+  CPUINFO_FEATURE_X86_MOVBE,
+  CPUINFO_FEATURE_X86_PCLMULQDQ,
+  CPUINFO_FEATURE_X86_AES,
+  CPUINFO_FEATURE_X86_RDRAND,
+  CPUINFO_FEATURE_X86_RDSEED,
+  CPUINFO_FEATURE_X86_XSAVE,
+  CPUINFO_FEATURE_X86_OSXSAVE,
+  CPUINFO_FEATURE_X86_XSAVEOPT,
+  CPUINFO_FEATURE_X86_XSAVEC,
+  CPUINFO_FEATURE_X86_XGETBV1,
+  CPUINFO_FEATURE_X86_XSAVES,
+  CPUINFO_FEATURE_X86_AVX,
+  CPUINFO_FEATURE_X86_AVX2,
+  CPUINFO_FEATURE_X86_FMA,
+  CPUINFO_FEATURE_X86_FMA4,
+  CPUINFO_FEATURE_X86_F16C,
+  CPUINFO_FEATURE_X86_BMI1,
+  CPUINFO_FEATURE_X86_BMI2,
+  CPUINFO_FEATURE_X86_TBM,
+  CPUINFO_FEATURE_X86_ADX,
+  CPUINFO_FEATURE_X86_SHA,
+  CPUINFO_FEATURE_X86_SHA512,
+  CPUINFO_FEATURE_X86_SM3,
+  CPUINFO_FEATURE_X86_SM4,
+  CPUINFO_FEATURE_X86_VAES,
+  CPUINFO_FEATURE_X86_VPCLMULQDQ,
+  CPUINFO_FEATURE_X86_GFNI,
+  CPUINFO_FEATURE_X86_ERMS,
+  CPUINFO_FEATURE_X86_FSRM,
+  CPUINFO_FEATURE_X86_FZLRM,
+  CPUINFO_FEATURE_X86_FSRS,
+  CPUINFO_FEATURE_X86_FSRC,
+  CPUINFO_FEATURE_X86_RDTSCP,
+  CPUINFO_FEATURE_X86_RDPID,
+  CPUINFO_FEATURE_X86_PREFETCHW,
+  CPUINFO_FEATURE_X86_CLFLUSHOPT,
+  CPUINFO_FEATURE_X86_CLWB,
+  CPUINFO_FEATURE_X86_MOVDIRI,
+  CPUINFO_FEATURE_X86_MOVDIR64B,
+  CPUINFO_FEATURE_X86_SERIALIZE,
+  CPUINFO_FEATURE_X86_WAITPKG,
+  CPUINFO_FEATURE_X86_HLE,
+  CPUINFO_FEATURE_X86_RTM,
+  CPUINFO_FEATURE_X86_AVX_VNNI,
+  CPUINFO_FEATURE_X86_AVX_VNNI_INT8,
+  CPUINFO_FEATURE_X86_AVX_VNNI_INT16,
+  CPUINFO_FEATURE_X86_AVX_IFMA,
+  CPUINFO_FEATURE_X86_AVX_NE_CONVERT,
+  CPUINFO_FEATURE_X86_AVX512F,
+  CPUINFO_FEATURE_X86_AVX512CD,
+  CPUINFO_FEATURE_X86_AVX512DQ,
+  CPUINFO_FEATURE_X86_AVX512BW,
+  CPUINFO_FEATURE_X86_AVX512VL,
+  CPUINFO_FEATURE_X86_AVX512PF,
+  CPUINFO_FEATURE_X86_AVX512ER,
+  CPUINFO_FEATURE_X86_AVX512IFMA,
+  CPUINFO_FEATURE_X86_AVX512VBMI,
+  CPUINFO_FEATURE_X86_AVX512VBMI2,
+  CPUINFO_FEATURE_X86_AVX512VNNI,
+  CPUINFO_FEATURE_X86_AVX512BITALG,
+  CPUINFO_FEATURE_X86_AVX512VPOPCNTDQ,
+  CPUINFO_FEATURE_X86_AVX512_4VNNIW,
+  CPUINFO_FEATURE_X86_AVX512_4FMAPS,
+  CPUINFO_FEATURE_X86_AVX512_VP2INTERSECT,
+  CPUINFO_FEATURE_X86_AVX512_BF16,
+  CPUINFO_FEATURE_X86_AVX512_FP16,
+  CPUINFO_FEATURE_X86_AVX10_1,
+  CPUINFO_FEATURE_X86_AVX10_2,
+  CPUINFO_FEATURE_X86_AVX10_256,
+  CPUINFO_FEATURE_X86_AVX10_512,
+  CPUINFO_FEATURE_X86_APX_F,
+  CPUINFO_FEATURE_X86_AMX_TILE,
+  CPUINFO_FEATURE_X86_AMX_BF16,
+  CPUINFO_FEATURE_X86_AMX_INT8,
+  CPUINFO_FEATURE_X86_AMX_FP16,
+  CPUINFO_FEATURE_X86_AMX_COMPLEX,
+  CPUINFO_FEATURE_X86_PSE,
+  CPUINFO_FEATURE_X86_PAE,
+  CPUINFO_FEATURE_X86_PDPE1GB,
   CPUINFO_FEATURE_X86_MAX,
 
   CPUINFO_FEATURE_IA64	= CPUINFO_CLASS('I'),
@@ -193,13 +704,122 @@ typedef enum {
 // Returns 1 if CPU supports the specified feature
 extern int cpuinfo_has_feature(cpuinfo_t *cip, int feature);
 
+// Feature status flags
+typedef enum {
+  CPUINFO_FEATURE_STATUS_HARDWARE	= 1 << 0,	// reported by the processor
+  CPUINFO_FEATURE_STATUS_OS			= 1 << 1,	// not disabled by the OS
+  CPUINFO_FEATURE_STATUS_USABLE		= 1 << 2,	// both of the above, and did not fault
+  CPUINFO_FEATURE_STATUS_FAULTED	= 1 << 3	// faulted in cpuinfo_verify_features()
+} cpuinfo_feature_status_t;
+
+// Returns the feature status flags, reconciling the processor and OS views
+extern int cpuinfo_get_feature_status(cpuinfo_t *cip, int feature);
+
+// Execute advertised features to make sure they don't fault, returns the number of features disabled
+extern int cpuinfo_verify_features(cpuinfo_t *cip);
+
+// x86-64 microarchitecture levels (x86-64 psABI), each level includes the previous ones
+typedef enum {
+  CPUINFO_X86_LEVEL_NONE,		// no long mode
+  CPUINFO_X86_LEVEL_V1,			// CMOV, CX8, FPU, FXSR, MMX, SCE, SSE, SSE2
+  CPUINFO_X86_LEVEL_V2,			// CMPXCHG16B, LAHF/SAHF, POPCNT, SSE3, SSSE3, SSE4.1, SSE4.2
+  CPUINFO_X86_LEVEL_V3,			// AVX, AVX2, BMI1, BMI2, F16C, FMA, LZCNT, MOVBE, OSXSAVE
+  CPUINFO_X86_LEVEL_V4			// AVX512F, AVX512BW, AVX512CD, AVX512DQ, AVX512VL
+} cpuinfo_x86_level_t;
+
+// Get the highest x86-64 level usable on the processor (returns -1 if it is not x86)
+extern int cpuinfo_get_x86_level(cpuinfo_t *cip);
+
+// Returns the x86-64 level that requires FEATURE, or CPUINFO_X86_LEVEL_NONE if there is none
+extern int cpuinfo_x86_level_of_feature(int feature);
+
 // Utility functions to convert IDs
 extern const char *cpuinfo_string_of_vendor(int vendor);
 extern const char *cpuinfo_string_of_socket(int socket);
+extern const char *cpuinfo_string_of_uarch(int uarch);
 extern const char *cpuinfo_string_of_cache_type(int cache_type);
+extern const char *cpuinfo_string_of_page_size(int page_size);
+extern const char *cpuinfo_string_of_core_type(int core_type);
+extern const char *cpuinfo_string_of_xsave_component(int component);
+extern const char *cpuinfo_string_of_xsave_insn(int insn);
+extern const char *cpuinfo_string_of_virtualizer(int virtualizer);
+extern const char *cpuinfo_string_of_slow_insn(int slow_insn);
+extern const char *cpuinfo_string_of_x86_level(int level);
 extern const char *cpuinfo_string_of_feature(int feature);
 extern const char *cpuinfo_string_of_feature_detail(int feature);
 
+/* ========================================================================= */
+/* == Function Dispatch                                                   == */
+/* ========================================================================= */
+
+// Maximum number of features a function variant may require
+#define CPUINFO_DISPATCH_MAX_FEATURES 8
+
+// Generic function pointer, to be cast back to the actual function type
+typedef void (*cpuinfo_function_t)(void);
+
+// Function variant, usable if all the required features are
+typedef struct {
+  const char *name;								// variant name (e.g. "avx2")
+  int priority;									// usable variant of highest priority is selected
+  int features[CPUINFO_DISPATCH_MAX_FEATURES];	// required features, zero-terminated
+  cpuinfo_function_t function;					// implementation of the function
+  const void *table;							// implementations of a kernel family
+} cpuinfo_dispatch_variant_t;
+
+// Dispatched function or kernel family
+typedef struct {
+  const char *name;								// function or kernel family name
+  const cpuinfo_dispatch_variant_t *variants;	// variants, terminated by a NULL name
+  const cpuinfo_dispatch_variant_t *selected;	// selected variant, NULL until resolved
+} cpuinfo_dispatch_t;
+
+// Returns 1 if all features required by the variant are usable (CIP may be NULL)
+extern int cpuinfo_dispatch_is_usable(cpuinfo_t *cip, const cpuinfo_dispatch_variant_t *vp);
+
+// Select the usable variant of highest priority, returns its index or -1 if none is usable (CIP may be NULL)
+extern int cpuinfo_dispatch_resolve(cpuinfo_t *cip, cpuinfo_dispatch_t *dp);
+
+// Returns the function of the selected variant, resolving it first if needed (CIP may be NULL)
+extern cpuinfo_function_t cpuinfo_dispatch_get_function(cpuinfo_t *cip, cpuinfo_dispatch_t *dp);
+
+// Returns the table of the selected variant, resolving it first if needed (CIP may be NULL)
+extern const void *cpuinfo_dispatch_get_table(cpuinfo_t *cip, cpuinfo_dispatch_t *dp);
+
+// Returns the name of the selected variant, or NULL if it is not resolved
+extern const char *cpuinfo_dispatch_get_variant(const cpuinfo_dispatch_t *dp);
+
+// Workload run to time a variant, FUNCTION and TABLE are those of the variant
+typedef void (*cpuinfo_tune_workload_t)(cpuinfo_function_t function, const void *table, void *data);
+
+// Select the usable variant that runs WORKLOAD fastest on this processor, returns its index or -1
+// if none is usable (CIP may be NULL). Results of named dispatchers are saved per host into the
+// file named by CPUINFO_TUNE_CACHE, or else $XDG_CACHE_HOME/cpuinfo-tune, so that later runs on
+// matching hosts skip the measurement.
+extern int cpuinfo_dispatch_tune(cpuinfo_t *cip, cpuinfo_dispatch_t *dp,
+								 cpuinfo_tune_workload_t workload, void *data);
+
+// Same as cpuinfo_dispatch_tune() with results saved per workload, as the best variant may differ
+// between workloads. KEY names the workload and its size (e.g. "crc-4k", NULL for "default").
+extern int cpuinfo_dispatch_tune_key(cpuinfo_t *cip, cpuinfo_dispatch_t *dp, const char *key,
+									 cpuinfo_tune_workload_t workload, void *data);
+
+// Number of 64-bit words filled by cpuinfo_resolver_features()
+#define CPUINFO_RESOLVER_WORDS ((CPUINFO_FEATURE_MASK + 1) / 64)
+
+// Fill BITS with the usable features of the processor, bit N standing for feature N of the
+// returned class (e.g. CPUINFO_FEATURE_X86), or returns -1. This neither allocates memory nor
+// calls the C library, so it is safe in IFUNC resolvers and constructors. HWCAP is the AT_HWCAP
+// value passed to IFUNC resolvers, PowerPC features are derived from it. In static executables,
+// resolvers run before thread-local storage is set up: the resolver calling this function must
+// be built without the stack protector (e.g. __attribute__((no_stack_protector))), as is this
+// function.
+extern int cpuinfo_resolver_features(uint64_t *bits, unsigned long hwcap);
+
+// Returns 1 if BITS filled by cpuinfo_resolver_features() has FEATURE
+#define CPUINFO_RESOLVER_HAS_FEATURE(BITS, FEATURE) \
+		((int)(((BITS)[((FEATURE) & CPUINFO_FEATURE_MASK) / 64] >> ((FEATURE) & 63)) & 1))
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,21 @@
 #define attribute_hidden
 #endif
 
+// Code run before thread-local storage is set up (e.g. IFUNC resolvers of static executables),
+// the stack protector canary is read from there
+#if defined __has_attribute
+#if __has_attribute(no_stack_protector)
+#define attribute_no_stack_protector __attribute__((no_stack_protector))
+#endif
+#endif
+#ifndef attribute_no_stack_protector
+#if defined __GNUC__ && !defined __clang__ && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 4))
+#define attribute_no_stack_protector __attribute__((optimize("no-stack-protector")))
+#else
+#define attribute_no_stack_protector
+#endif
+#endif
+
 // Boolean types
 #ifndef __cplusplus
 #ifdef HAVE_STDBOOL_H